@@ -16,31 +16,148 @@
  * @author Cedric Hammes
  * @since  09/03/2024
  */
+#include <algorithm>
+#include <chrono>
+#include <cxxopts.hpp>
 #include <fstream>
 #include <iostream>
-#include <sstream>
+#include <libdebug/coverage.hpp>
+#include <libdebug/profiler.hpp>
+#include <spdlog/spdlog.h>
 #include <string>
-#include <unistd.h>
 
-void readMemoryMaps(int pid) {
-    std::ifstream file("/proc/" + std::to_string(pid) + "/status");
-    std::string line;
-    while(std::getline(file, line)) {
-        std::istringstream lineStream(line);
-        std::string name, value;
+/**
+ * This function attaches to the specified process and samples its threads at the specified rate. The aggregated
+ * stacks are written in the folded format, which is read by flame graph tools.
+ *
+ * @param process_id  The id of the target process
+ * @param rate        The count of samples per second
+ * @param duration    The time to profile
+ * @param output_path The file for the folded stacks, standard output when empty
+ * @return            The exit code
+ * @author            Cedric Hammes
+ * @since             16/10/2026
+ */
+auto profile_process(libdebug::platform::TaskId process_id, std::size_t rate, std::chrono::seconds duration,
+                     const std::string& output_path) -> int {
+    auto process_context = libdebug::ProcessContext {process_id};
+    spdlog::info("Attached to {} threads of process {} in {} us", process_context.get_threads().size(), process_id,
+                 process_context.get_attach_latency().count());
+
+    auto profiler = libdebug::Profiler {process_context};
+    const auto interval = std::chrono::microseconds {1000000 / std::max<std::size_t>(rate, 1)};
+    if(const auto result = profiler.run(interval, duration); result.is_error()) {
+        spdlog::error("Unable to profile process {}: {}", process_id, result.get_error());
+        return EXIT_FAILURE;
+    }
+    spdlog::info("Took {} samples with {} stacks, {} ns per thread sample", profiler.get_sample_count(),
+                 profiler.get_stack_count(), profiler.get_sample_overhead().count());
 
-        lineStream >> name >> value;
-        name = name.substr(0, name.length() - 1);
-        std::cout << "Name: " << name << std::endl;
-        std::cout << "Value: " << value << std::endl;
-        std::cout << std::endl;
+    if(output_path.empty()) {
+        profiler.write_folded(std::cout);
+        return EXIT_SUCCESS;
     }
 
-    file.close();
+    std::ofstream output_file {output_path};
+    if(!output_file) {
+        spdlog::error("Unable to open output file {}", output_path);
+        return EXIT_FAILURE;
+    }
+    profiler.write_folded(output_file);
+    return EXIT_SUCCESS;
 }
 
-auto main(int argc, char* argv[]) -> int {
-    int pid = getpid();
-    readMemoryMaps(pid);
+/**
+ * This function attaches to the specified process and collects its code coverage with one-shot breakpoints at the
+ * functions or basic blocks of the executable and its libraries. The remaining breakpoints are removed afterward and
+ * the covered blocks are written in the drcov format.
+ *
+ * @param process_id  The id of the target process
+ * @param mode        Whether functions or basic blocks are covered
+ * @param duration    The time to collect coverage
+ * @param output_path The file for the coverage, drcov.<pid>.log when empty
+ * @return            The exit code
+ * @author            Cedric Hammes
+ * @since             16/10/2026
+ */
+auto cover_process(libdebug::platform::TaskId process_id, libdebug::CoverageMode mode, std::chrono::seconds duration,
+                   const std::string& output_path) -> int {
+    auto process_context = libdebug::ProcessContext {process_id};
+    spdlog::info("Attached to {} threads of process {} in {} us", process_context.get_threads().size(), process_id,
+                 process_context.get_attach_latency().count());
+
+    auto coverage = libdebug::Coverage {process_context};
+    const auto install_start_time = std::chrono::steady_clock::now();
+    if(const auto result = coverage.install(mode); result.is_error()) {
+        spdlog::error("Unable to cover process {}: {}", process_id, result.get_error());
+        return EXIT_FAILURE;
+    }
+    const auto install_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - install_start_time);
+    spdlog::info("Installed {} breakpoints in {} modules in {} ms", coverage.get_blocks().size(),
+                 coverage.get_modules().size(), install_time.count());
+
+    if(const auto result = coverage.run(duration); result.is_error()) {
+        spdlog::error("Unable to cover process {}: {}", process_id, result.get_error());
+        return EXIT_FAILURE;
+    }
+
+    if(const auto result = coverage.uninstall(); result.is_error()) {
+        spdlog::error("Unable to cover process {}: {}", process_id, result.get_error());
+        return EXIT_FAILURE;
+    }
+    spdlog::info("Covered {} of {} blocks", coverage.get_covered_count(), coverage.get_blocks().size());
+
+    const auto file_path = output_path.empty() ? fmt::format("drcov.{}.log", process_id) : output_path;
+    std::ofstream output_file {file_path, std::ios::binary};
+    if(!output_file) {
+        spdlog::error("Unable to open output file {}", file_path);
+        return EXIT_FAILURE;
+    }
+    coverage.write_drcov(output_file);
     return EXIT_SUCCESS;
+}
+
+auto main(int argc, char* argv[]) -> int {
+    cxxopts::Options options {"chronos-debugger", "Debugger based on libdebug"};
+    options.add_options()("command", "The command to execute (profile, coverage)", cxxopts::value<std::string>())(
+            "pid", "The id of the target process", cxxopts::value<libdebug::platform::TaskId>())(
+            "r,rate", "The count of samples per second", cxxopts::value<std::size_t>()->default_value("99"))(
+            "d,duration", "The time to run in seconds", cxxopts::value<std::size_t>()->default_value("10"))(
+            "o,output", "The file for the folded stacks or coverage", cxxopts::value<std::string>()->default_value(""))(
+            "b,blocks", "Cover basic blocks instead of functions", cxxopts::value<bool>()->default_value("false"))(
+            "h,help", "Print the usage");
+    options.parse_positional({"command", "pid"});
+    options.positional_help("<command> <pid>");
+
+    try {
+        const auto arguments = options.parse(argc, argv);
+        if(arguments.count("help") > 0 || arguments.count("command") == 0) {
+            std::cout << options.help() << std::endl;
+            return EXIT_SUCCESS;
+        }
+
+        const auto command = arguments["command"].as<std::string>();
+        if((command != "profile" && command != "coverage") || arguments.count("pid") == 0) {
+            spdlog::error("Unknown command '{}', usage: chronos-debugger <profile|coverage> <pid>", command);
+            return EXIT_FAILURE;
+        }
+
+        if(command == "coverage") {
+            const auto mode = arguments["blocks"].as<bool>() ? libdebug::CoverageMode::BASIC_BLOCKS
+                                                             : libdebug::CoverageMode::FUNCTIONS;
+            return cover_process(arguments["pid"].as<libdebug::platform::TaskId>(), mode,
+                                 std::chrono::seconds {arguments["duration"].as<std::size_t>()},
+                                 arguments["output"].as<std::string>());
+        }
+
+        return profile_process(arguments["pid"].as<libdebug::platform::TaskId>(),
+                               arguments["rate"].as<std::size_t>(),
+                               std::chrono::seconds {arguments["duration"].as<std::size_t>()},
+                               arguments["output"].as<std::string>());
+    }
+    catch(const std::exception& exception) {
+        spdlog::error("{}", exception.what());
+        return EXIT_FAILURE;
+    }
 }
\ No newline at end of file
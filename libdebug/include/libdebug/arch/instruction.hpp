@@ -0,0 +1,87 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#pragma once
+#include <array>
+#include <cstdint>
+#include <kstd/result.hpp>
+#include <kstd/types.hpp>
+#include <span>
+
+namespace libdebug::arch {
+    static constexpr std::size_t max_instruction_size = 15;
+
+    /**
+     * This structure is describing the layout of a single decoded instruction. Offsets are relative to the first
+     * byte of the instruction, an offset of zero means that the instruction has no such field.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct Instruction final {
+        std::size_t size;
+        std::size_t opcode_offset;
+        kstd::u8 opcode_map;
+        kstd::u8 opcode;
+        std::size_t modrm_offset;
+        std::size_t displacement_offset;
+        std::size_t relative_offset;
+        std::size_t relative_size;
+    };
+
+    /**
+     * This structure is an instruction rewritten to be executed at another address than the original one. Relative
+     * branches with an 8-bit displacement are widened, so the relocated code can be larger than the original one.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct RelocatedInstruction final {
+        std::array<kstd::u8, max_instruction_size + 4> code;
+        std::size_t size;
+        std::size_t original_size;
+        bool is_call;
+    };
+
+    /**
+     * This function decodes the length and the layout of the first instruction in the specified code. Only the
+     * fields required to move the instruction are decoded, the operands are not interpreted.
+     *
+     * @param code The code starting with the instruction
+     * @return     The decoded instruction or an error
+     * @author     Cedric Hammes
+     * @since      16/10/2026
+     */
+    [[nodiscard]] auto decode_instruction(std::span<const kstd::u8> code) noexcept -> kstd::Result<Instruction>;
+
+    /**
+     * This function rewrites the first instruction in the specified code, so executing it at the target address has
+     * the same effect as executing it at the source address. RIP-relative operands and relative branch targets are
+     * adjusted to the new location.
+     *
+     * @param code The code starting with the instruction
+     * @param from The original address of the instruction
+     * @param to   The address the instruction is executed at
+     * @return     The relocated instruction or an error, when the instruction can't be moved
+     * @author     Cedric Hammes
+     * @since      16/10/2026
+     */
+    [[nodiscard]] auto relocate_instruction(std::span<const kstd::u8> code, std::intptr_t from,
+                                            std::intptr_t to) noexcept -> kstd::Result<RelocatedInstruction>;
+}// namespace libdebug::arch
\ No newline at end of file
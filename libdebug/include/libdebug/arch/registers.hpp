@@ -18,7 +18,232 @@
  */
 
 #pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <kstd/types.hpp>
+
+#ifdef PLATFORM_WINDOWS
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else
+#include <sys/user.h>
+#endif
 
 namespace libdebug::arch {
+#ifdef PLATFORM_WINDOWS
+    using GeneralRegisters = CONTEXT;
+#else
+    using GeneralRegisters = user_regs_struct;
+#endif
+
+    /**
+     * This function returns the instruction pointer of the specified registers.
+     *
+     * @param registers The general-purpose registers
+     * @return          The instruction pointer
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    [[nodiscard]] constexpr auto get_instruction_pointer(const GeneralRegisters& registers) noexcept -> std::intptr_t {
+#if defined(ARCH_X86_64) && defined(PLATFORM_WINDOWS)
+        return static_cast<std::intptr_t>(registers.Rip);
+#elif defined(ARCH_X86_64)
+        return static_cast<std::intptr_t>(registers.rip);
+#elif defined(ARCH_ARM64)
+        return static_cast<std::intptr_t>(registers.pc);
+#endif
+    }
+
+    /**
+     * This function sets the instruction pointer of the specified registers.
+     *
+     * @param registers The general-purpose registers
+     * @param address   The new instruction pointer
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    constexpr auto set_instruction_pointer(GeneralRegisters& registers, std::intptr_t address) noexcept -> void {
+#if defined(ARCH_X86_64) && defined(PLATFORM_WINDOWS)
+        registers.Rip = static_cast<DWORD64>(address);
+#elif defined(ARCH_X86_64)
+        registers.rip = static_cast<kstd::u64>(address);
+#elif defined(ARCH_ARM64)
+        registers.pc = static_cast<kstd::u64>(address);
+#endif
+    }
+
+    /**
+     * This function returns the stack pointer of the specified registers.
+     *
+     * @param registers The general-purpose registers
+     * @return          The stack pointer
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    [[nodiscard]] constexpr auto get_stack_pointer(const GeneralRegisters& registers) noexcept -> std::intptr_t {
+#if defined(ARCH_X86_64) && defined(PLATFORM_WINDOWS)
+        return static_cast<std::intptr_t>(registers.Rsp);
+#elif defined(ARCH_X86_64)
+        return static_cast<std::intptr_t>(registers.rsp);
+#elif defined(ARCH_ARM64)
+        return static_cast<std::intptr_t>(registers.sp);
+#endif
+    }
+
+    /**
+     * This function returns the frame pointer of the specified registers.
+     *
+     * @param registers The general-purpose registers
+     * @return          The frame pointer
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    [[nodiscard]] constexpr auto get_frame_pointer(const GeneralRegisters& registers) noexcept -> std::intptr_t {
+#if defined(ARCH_X86_64) && defined(PLATFORM_WINDOWS)
+        return static_cast<std::intptr_t>(registers.Rbp);
+#elif defined(ARCH_X86_64)
+        return static_cast<std::intptr_t>(registers.rbp);
+#elif defined(ARCH_ARM64)
+        return static_cast<std::intptr_t>(registers.regs[29]);
+#endif
+    }
+
+    /**
+     * This function returns the specified integer argument of a function, which was just called with the
+     * specified registers. Only the arguments passed in registers by the calling convention are supported.
+     *
+     * @param registers The general-purpose registers
+     * @param index     The index of the argument
+     * @return          The value of the argument
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    [[nodiscard]] constexpr auto get_argument(const GeneralRegisters& registers, std::size_t index) noexcept
+            -> kstd::u64 {
+#if defined(ARCH_X86_64) && defined(PLATFORM_WINDOWS)
+        const kstd::u64 arguments[] {registers.Rcx, registers.Rdx, registers.R8, registers.R9};
+        return index < 4 ? arguments[index] : 0;
+#elif defined(ARCH_X86_64)
+        const kstd::u64 arguments[] {registers.rdi, registers.rsi, registers.rdx,
+                                     registers.rcx, registers.r8,  registers.r9};
+        return index < 6 ? arguments[index] : 0;
+#elif defined(ARCH_ARM64)
+        return index < 8 ? registers.regs[index] : 0;
+#endif
+    }
+
+    /**
+     * This function returns the integer return value of a function, which just returned with the specified
+     * registers.
+     *
+     * @param registers The general-purpose registers
+     * @return          The return value
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    [[nodiscard]] constexpr auto get_return_value(const GeneralRegisters& registers) noexcept -> kstd::u64 {
+#if defined(ARCH_X86_64) && defined(PLATFORM_WINDOWS)
+        return registers.Rax;
+#elif defined(ARCH_X86_64)
+        return registers.rax;
+#elif defined(ARCH_ARM64)
+        return registers.regs[0];
+#endif
+    }
+
+    static constexpr std::size_t syscall_argument_count = 6;
+
+    /**
+     * This function returns the number of the syscall, which is entered or left by a thread with the specified
+     * registers.
+     *
+     * @param registers The general-purpose registers
+     * @return          The number of the syscall
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    [[nodiscard]] constexpr auto get_syscall_number(const GeneralRegisters& registers) noexcept -> kstd::u64 {
+#if defined(ARCH_X86_64) && defined(PLATFORM_WINDOWS)
+        return registers.Rax;
+#elif defined(ARCH_X86_64)
+        return registers.orig_rax;
+#elif defined(ARCH_ARM64)
+        return registers.regs[8];
+#endif
+    }
+
+    /**
+     * This function returns the arguments of the syscall, which is entered by a thread with the specified registers.
+     * The syscall calling convention differs from the function calling convention in the fourth argument on x86_64.
+     *
+     * @param registers The general-purpose registers
+     * @return          The arguments of the syscall
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    [[nodiscard]] constexpr auto get_syscall_arguments(const GeneralRegisters& registers) noexcept
+            -> std::array<kstd::u64, syscall_argument_count> {
+#if defined(ARCH_X86_64) && defined(PLATFORM_WINDOWS)
+        return {registers.R10, registers.Rdx, registers.R8, registers.R9, 0, 0};
+#elif defined(ARCH_X86_64)
+        return {registers.rdi, registers.rsi, registers.rdx, registers.r10, registers.r8, registers.r9};
+#elif defined(ARCH_ARM64)
+        return {registers.regs[0], registers.regs[1], registers.regs[2],
+                registers.regs[3], registers.regs[4], registers.regs[5]};
+#endif
+    }
+
+#ifdef ARCH_X86_64
+    static constexpr std::size_t extended_state_header_offset = 512;
+    static constexpr std::size_t extended_state_header_size = 64;
+
+    /**
+     * This enum is describing the state components of the XSAVE area. The value of every component is its bit in
+     * the state-component bitmap of the XSAVE header.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    enum class ExtendedStateComponent : kstd::u8 {
+        X87 = 0,
+        SSE = 1,
+        AVX = 2,
+        OPMASK = 5,
+        ZMM_HI256 = 6,
+        HI16_ZMM = 7
+    };
+
+    /**
+     * This structure is describing the location of a single state component in the standard format of the XSAVE
+     * area. A size of zero means that the component isn't supported by the CPU.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct ExtendedStateLayout final {
+        std::size_t offset;
+        std::size_t size;
+    };
+
+    /**
+     * This function returns the location of the specified state component in the XSAVE area. The locations of the
+     * extended components are enumerated by the CPU.
+     *
+     * @param component The state component
+     * @return          The location of the component
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    [[nodiscard]] auto get_extended_state_layout(ExtendedStateComponent component) noexcept -> ExtendedStateLayout;
 
-}
\ No newline at end of file
+    /**
+     * This function returns the size of the XSAVE area with all state components supported by the CPU.
+     *
+     * @return The size of the XSAVE area
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    [[nodiscard]] auto get_max_extended_state_size() noexcept -> std::size_t;
+#endif
+}// namespace libdebug::arch
\ No newline at end of file
@@ -0,0 +1,338 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#pragma once
+#include <cstdint>
+#include <iterator>
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <kstd/types.hpp>
+#include <vector>
+
+namespace libdebug {
+    /**
+     * This class is representing a single process being debugged by this application. This context can be initialized
+     * by starting a subprocess that is being debugged or attach to an existing process.
+     *
+     * @author Cedric Hammes
+     * @since  13/03/2024
+     */
+    class ProcessContext;
+
+    /**
+     * This class is representing a single breakpoint on some address. This is used by the debug context to handle
+     * breakpoints.
+     *
+     * @author Cedric Hammes
+     * @since  09/03/2024
+     */
+    class Breakpoint final {
+        std::intptr_t _address;
+        bool _enabled;
+        kstd::u8 _saved_data;
+
+        friend class ProcessContext;
+
+    public:
+        // TODO: Different values for different architectures
+        static constexpr kstd::u8 interrupt_instruction = 0xCC;
+
+        /**
+         * This constructor constructs an empty breakpoint
+         *
+         * @author Cedric Hammes
+         * @since  09/03/2024
+         */
+        explicit Breakpoint(std::intptr_t target_address) noexcept;
+        ~Breakpoint() noexcept = default;
+        KSTD_DEFAULT_MOVE_COPY(Breakpoint, Breakpoint);
+
+        /**
+         * This function enables the breakpoint by replacing the instruction at the specified address and saving the
+         * original data in this class. All threads share the address space, so the memory is patched once for the
+         * whole process. Enabling an enabled breakpoint does nothing, so the saved data is never overwritten with the
+         * interrupt instruction.
+         *
+         * @param process_context The context of the process owning the breakpoint
+         * @return                Void or an error
+         * @author                Cedric Hammes
+         * @since                 09/03/2024
+         */
+        [[nodiscard]] auto enable(ProcessContext& process_context) noexcept -> kstd::Result<void>;
+
+        /**
+         * This function disables the breakpoint by replacing the inserted instruction at the specified address with the
+         * original data saved. Disabling a disabled breakpoint does nothing.
+         *
+         * @param process_context The context of the process owning the breakpoint
+         * @return                Void or an error
+         * @author                Cedric Hammes
+         * @since                 09/03/2024
+         */
+        [[nodiscard]] auto disable(ProcessContext& process_context) noexcept -> kstd::Result<void>;
+
+        /**
+         * This method returns the address to the breakpoint
+         *
+         * @return The breakpoint address
+         * @author Cedric Hammes
+         * @since  09/03/2024
+         */
+        [[nodiscard]] inline auto get_address() const noexcept -> std::intptr_t {
+            return _address;
+        }
+
+        /**
+         * This method returns whether the breakpoint was enabled or not
+         *
+         * @return Whether the breakpoint was enabled or not
+         * @author Cedric Hammes
+         * @since  09/03/2024
+         */
+        [[nodiscard]] inline auto is_enabled() const noexcept -> bool {
+            return _enabled;
+        }
+    };
+
+    /**
+     * This enum is representing the access which triggers a hardware breakpoint. The values are the encoding of the
+     * access in the debug control register.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    enum class HardwareBreakpointType : kstd::u8 {
+        EXECUTE = 0b00,
+        WRITE = 0b01,
+        READ_WRITE = 0b11
+    };
+
+    /**
+     * This structure is representing a single hardware breakpoint or watchpoint, which is programmed into the debug
+     * registers of a thread instead of patching the memory. Execute breakpoints always have a size of 1, watchpoints
+     * have a size of 1, 2, 4 or 8 bytes and must be aligned to their size.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct HardwareBreakpoint final {
+        static constexpr std::size_t slot_count = 4;
+
+        std::intptr_t address;
+        HardwareBreakpointType type;
+        kstd::u8 size;
+    };
+
+    /**
+     * This class is the index of all breakpoints of a process. It's an open-addressing hash table with linear probing,
+     * which stores the addresses separately from the breakpoints. Checking whether the address of a trap is one of our
+     * breakpoints only touches the address array, which is mostly a single cache line.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class BreakpointTable final {
+        static constexpr std::intptr_t empty_address = -1;
+
+        std::vector<std::intptr_t> _addresses;
+        std::vector<Breakpoint> _breakpoints;
+        std::size_t _size;
+
+        [[nodiscard]] auto get_home_slot(std::intptr_t address) const noexcept -> std::size_t;
+        [[nodiscard]] auto find_slot(std::intptr_t address) const noexcept -> std::size_t;
+        auto grow() noexcept -> void;
+
+    public:
+        template<typename T>
+        class Iterator final {
+            const std::vector<std::intptr_t>* _addresses;
+            T* _breakpoints;
+            std::size_t _slot;
+
+            inline auto skip_empty_slots() noexcept -> void {
+                while(_slot < _addresses->size() && (*_addresses)[_slot] == empty_address) {
+                    ++_slot;
+                }
+            }
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::remove_const_t<T>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = T*;
+            using reference = T&;
+
+            Iterator() noexcept ://NOLINT
+                    _addresses {nullptr},
+                    _breakpoints {nullptr},
+                    _slot {0} {
+            }
+
+            Iterator(const std::vector<std::intptr_t>* addresses, T* breakpoints, std::size_t slot) noexcept ://NOLINT
+                    _addresses {addresses},
+                    _breakpoints {breakpoints},
+                    _slot {slot} {
+                skip_empty_slots();
+            }
+
+            [[nodiscard]] inline auto operator*() const noexcept -> T& {
+                return _breakpoints[_slot];
+            }
+
+            [[nodiscard]] inline auto operator->() const noexcept -> T* {
+                return &_breakpoints[_slot];
+            }
+
+            inline auto operator++() noexcept -> Iterator& {
+                ++_slot;
+                skip_empty_slots();
+                return *this;
+            }
+
+            inline auto operator++(int) noexcept -> Iterator {
+                auto previous = *this;
+                ++*this;
+                return previous;
+            }
+
+            [[nodiscard]] inline auto operator==(const Iterator& other) const noexcept -> bool {
+                return _slot == other._slot;
+            }
+        };
+
+        using iterator = Iterator<Breakpoint>;
+        using const_iterator = Iterator<const Breakpoint>;
+
+        BreakpointTable() noexcept;
+        ~BreakpointTable() noexcept = default;
+        KSTD_DEFAULT_MOVE_COPY(BreakpointTable, BreakpointTable);
+
+        /**
+         * This function returns the breakpoint at the specified address or a null pointer when no breakpoint is set at
+         * the address. This is the lookup of the trap hot path.
+         *
+         * @param address The address of the breakpoint
+         * @return        The breakpoint or nullptr
+         * @author        Cedric Hammes
+         * @since         16/10/2026
+         */
+        [[nodiscard]] auto find(std::intptr_t address) noexcept -> Breakpoint*;
+
+        /**
+         * This function returns the breakpoint at the specified address or a null pointer when no breakpoint is set at
+         * the address. This is the lookup of the trap hot path.
+         *
+         * @param address The address of the breakpoint
+         * @return        The breakpoint or nullptr
+         * @author        Cedric Hammes
+         * @since         16/10/2026
+         */
+        [[nodiscard]] auto find(std::intptr_t address) const noexcept -> const Breakpoint*;
+
+        /**
+         * This function returns the breakpoint at the specified address and throws an std::out_of_range exception
+         * when no breakpoint is set at the address.
+         *
+         * @param address The address of the breakpoint
+         * @return        The breakpoint
+         * @author        Cedric Hammes
+         * @since         16/10/2026
+         */
+        [[nodiscard]] auto at(std::intptr_t address) const -> const Breakpoint&;
+
+        /**
+         * This function inserts the specified breakpoint, when no breakpoint is set at the address of it.
+         *
+         * @param breakpoint The breakpoint to insert
+         * @return           Whether the breakpoint was inserted
+         * @author           Cedric Hammes
+         * @since            16/10/2026
+         */
+        auto insert(const Breakpoint& breakpoint) noexcept -> bool;
+
+        /**
+         * This function removes the breakpoint at the specified address. The following entries of the probe sequence
+         * are shifted back, so no tombstones are slowing down later lookups.
+         *
+         * @param address The address of the breakpoint
+         * @return        Whether a breakpoint was removed
+         * @author        Cedric Hammes
+         * @since         16/10/2026
+         */
+        auto erase(std::intptr_t address) noexcept -> bool;
+
+        /**
+         * This function removes all breakpoints from the table.
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        auto clear() noexcept -> void;
+
+        /**
+         * This method returns whether a breakpoint is set at the specified address.
+         *
+         * @param address The address of the breakpoint
+         * @return        Whether a breakpoint is set
+         * @author        Cedric Hammes
+         * @since         16/10/2026
+         */
+        [[nodiscard]] inline auto contains(std::intptr_t address) const noexcept -> bool {
+            return find(address) != nullptr;
+        }
+
+        /**
+         * This method returns the count of breakpoints in the table.
+         *
+         * @return The count of breakpoints
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto size() const noexcept -> std::size_t {
+            return _size;
+        }
+
+        /**
+         * This method returns whether the table contains no breakpoints.
+         *
+         * @return Whether the table is empty
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto empty() const noexcept -> bool {
+            return _size == 0;
+        }
+
+        [[nodiscard]] inline auto begin() noexcept -> iterator {
+            return {&_addresses, _breakpoints.data(), 0};
+        }
+
+        [[nodiscard]] inline auto end() noexcept -> iterator {
+            return {&_addresses, _breakpoints.data(), _addresses.size()};
+        }
+
+        [[nodiscard]] inline auto begin() const noexcept -> const_iterator {
+            return {&_addresses, _breakpoints.data(), 0};
+        }
+
+        [[nodiscard]] inline auto end() const noexcept -> const_iterator {
+            return {&_addresses, _breakpoints.data(), _addresses.size()};
+        }
+    };
+}// namespace libdebug
@@ -0,0 +1,66 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#pragma once
+#include <filesystem>
+#include <kstd/result.hpp>
+#include <kstd/types.hpp>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace libdebug {
+    static constexpr kstd::u32 cache_version = 3;
+
+    /**
+     * This function returns the GNU build-id of the specified ELF executable as a hexadecimal string. The build-id
+     * identifies the content of the executable, so it is used as the key of the cache files.
+     *
+     * @param executable The data of the executable
+     * @return           The build-id or no value, when the executable has no build-id
+     * @author           Cedric Hammes
+     * @since            16/10/2026
+     */
+    [[nodiscard]] auto read_build_id(std::span<const kstd::u8> executable) noexcept -> std::optional<std::string>;
+
+    /**
+     * This function returns the default directory of the cache files, which is the libdebug directory in the cache
+     * directory of the user.
+     *
+     * @return The cache directory or no value, when the user has no cache directory
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    [[nodiscard]] auto get_cache_directory() noexcept -> std::optional<std::filesystem::path>;
+
+    /**
+     * This function writes the specified parts into the cache file at the specified path. The file is written into a
+     * temporary file first and renamed afterward, so readers never map a partially written cache file.
+     *
+     * @param path  The path of the cache file
+     * @param parts The parts of the content of the file
+     * @return      Void or an error
+     * @author      Cedric Hammes
+     * @since       16/10/2026
+     */
+    [[nodiscard]] auto write_cache_file(const std::filesystem::path& path,
+                                        std::span<const std::span<const kstd::u8>> parts) noexcept
+            -> kstd::Result<void>;
+}// namespace libdebug
\ No newline at end of file
@@ -0,0 +1,190 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#pragma once
+#include "libdebug/process.hpp"
+#include <chrono>
+#include <cstdint>
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <kstd/types.hpp>
+#include <ostream>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace libdebug {
+    /**
+     * This enum is describing where the coverage breakpoints are placed. Basic blocks are found by decoding the
+     * functions, they start at the function entries, at the targets of relative branches and behind branches.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    enum class CoverageMode : kstd::u8 {
+        FUNCTIONS = 0,
+        BASIC_BLOCKS = 1
+    };
+
+    /**
+     * This structure is describing a mapped file, which contains coverage blocks. The module spans all mappings of
+     * the file.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct CoverageModule final {
+        std::string path;
+        std::intptr_t begin;
+        std::intptr_t end;
+    };
+
+    /**
+     * This structure is describing a single block with a coverage breakpoint. The size is the size of the code up to
+     * the next branch or the next block.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct CoverageBlock final {
+        std::intptr_t address;
+        kstd::u16 size;
+        kstd::u16 module_id;
+    };
+
+    /**
+     * This class collects the code coverage of a process with one-shot breakpoints. The breakpoints are tracepoints
+     * with a hit budget of one, so each breakpoint restores the original code on its first hit and the covered code
+     * runs at full speed afterward. The blocks are found with the ELF symbols of the executable and of the libraries
+     * mapped when the breakpoints are installed. A block is marked as covered by the tracepoint callback of the
+     * process on its hit, so the process refers to the coverage until it's uninstalled.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class Coverage final {
+        ProcessContext* _process_context;
+        std::vector<CoverageModule> _modules;
+        std::vector<CoverageBlock> _blocks;
+        std::vector<bool> _covered_blocks;
+        std::size_t _covered_count;
+        bool _is_installed;
+
+        auto find_blocks(kstd::u16 module_id, std::intptr_t file_address, CoverageMode mode) noexcept -> void;
+        auto cover_block(std::intptr_t address) noexcept -> void;
+        auto remove_tracepoint_callback() noexcept -> void;
+
+    public:
+        /**
+         * This constructor creates a coverage without blocks for the specified process.
+         *
+         * @param process_context The process
+         * @author                Cedric Hammes
+         * @since                 16/10/2026
+         */
+        explicit Coverage(ProcessContext& process_context) noexcept;
+        ~Coverage() noexcept;
+        KSTD_NO_MOVE_COPY(Coverage, Coverage);
+
+        /**
+         * This function finds the blocks of all mapped files with executable code and adds the one-shot breakpoints
+         * in a single batch. Files without symbols are skipped, blocks which can't be patched are dropped.
+         *
+         * @param mode Whether functions or basic blocks are covered
+         * @return     Void or an error
+         * @author     Cedric Hammes
+         * @since      16/10/2026
+         */
+        [[nodiscard]] auto install(CoverageMode mode) noexcept -> kstd::Result<void>;
+
+        /**
+         * This function runs the process until the specified duration is elapsed or the process exited. Stopped
+         * threads are resumed first, the signals of the process are delivered to their thread.
+         *
+         * @param duration The time to collect coverage
+         * @return         Void or an error
+         * @author         Cedric Hammes
+         * @since          16/10/2026
+         */
+        [[nodiscard]] auto run(std::chrono::milliseconds duration) noexcept -> kstd::Result<void>;
+
+        /**
+         * This function stops all threads of the running process, removes the breakpoints of the blocks which weren't
+         * hit yet and resumes the threads. Afterward the process can be detached without leaving breakpoints behind.
+         *
+         * @return Void or an error
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto uninstall() noexcept -> kstd::Result<void>;
+
+        /**
+         * This function writes the covered blocks in the drcov format version 2, with a text module table followed
+         * by the binary table of the blocks. The blocks are written relative to the begin of their module.
+         *
+         * @param stream The stream to write into
+         * @author       Cedric Hammes
+         * @since        16/10/2026
+         */
+        auto write_drcov(std::ostream& stream) const noexcept -> void;
+
+        /**
+         * This function returns whether the block at the specified address was hit.
+         *
+         * @param address The address of the block
+         * @return        Whether the block was hit, false when no block is at the address
+         * @author        Cedric Hammes
+         * @since         16/10/2026
+         */
+        [[nodiscard]] auto is_covered(std::intptr_t address) const noexcept -> bool;
+
+        /**
+         * This function returns the count of blocks, which were hit.
+         *
+         * @return The count of covered blocks
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_covered_count() const noexcept -> std::size_t {
+            return _covered_count;
+        }
+
+        /**
+         * This function returns the blocks with a breakpoint, sorted by address.
+         *
+         * @return The blocks
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_blocks() const noexcept -> std::span<const CoverageBlock> {
+            return _blocks;
+        }
+
+        /**
+         * This function returns the modules containing the blocks, the index of a module is its id.
+         *
+         * @return The modules
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_modules() const noexcept -> std::span<const CoverageModule> {
+            return _modules;
+        }
+    };
+}// namespace libdebug
\ No newline at end of file
@@ -0,0 +1,175 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#pragma once
+#include "libdebug/platform/platform.hpp"
+#include <cstdint>
+#include <filesystem>
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <kstd/types.hpp>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace libdebug {
+    /**
+     * This structure is describing a single position in the source code. The file name is valid as long as the line
+     * table exists.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct SourceLocation final {
+        std::string_view file;
+        kstd::u32 line;
+        kstd::u32 column;
+    };
+
+    /**
+     * This class is the index over the DWARF line programs of a single ELF executable. The compilation units are
+     * located with the .debug_aranges section and a scan over the root entries of the units, the line program of a
+     * unit is only decoded when a lookup hits the unit. Units without any known range are only decoded when a lookup
+     * misses all known ranges.
+     *
+     * When a cache directory is specified, the address ranges and the line program offsets of the units are stored in
+     * a cache file keyed by the build-id of the executable, so later line tables skip the scan over the units.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class LineTable final {
+        struct Section final {
+            std::size_t offset;
+            std::size_t size;
+        };
+
+        struct DecodedUnit final {
+            std::vector<kstd::u64> addresses;
+            std::vector<kstd::u32> lines;
+            std::vector<kstd::u16> columns;
+            std::vector<kstd::u16> file_indices;
+            std::vector<kstd::u8> flags;
+        };
+
+        struct Unit final {
+            kstd::u64 line_offset;
+            std::unique_ptr<DecodedUnit> decoded;
+            std::vector<std::string> files;
+        };
+
+        struct AddressRange final {
+            kstd::u64 begin;
+            kstd::u64 end;
+            std::size_t unit_index;
+        };
+
+        platform::FileMapping _mapping;
+        Section _debug_info;
+        Section _debug_abbrev;
+        Section _debug_aranges;
+        Section _debug_ranges;
+        Section _debug_rnglists;
+        Section _debug_line;
+        Section _debug_line_str;
+        Section _debug_str;
+        std::vector<Unit> _units;
+        std::vector<AddressRange> _ranges;
+        std::vector<std::size_t> _unranged_units;
+        bool _indexed;
+        std::intptr_t _load_bias;
+        std::optional<std::filesystem::path> _cache_path;
+
+        [[nodiscard]] auto get_section_data(const Section& section) const noexcept -> std::span<const kstd::u8>;
+        [[nodiscard]] auto build_index() noexcept -> kstd::Result<void>;
+        [[nodiscard]] auto index_unranged_units() noexcept -> kstd::Result<void>;
+        [[nodiscard]] auto load_cache(const std::filesystem::path& path) noexcept -> bool;
+        [[nodiscard]] auto write_cache(const std::filesystem::path& path) const noexcept -> kstd::Result<void>;
+        [[nodiscard]] auto read_files(Unit& unit) const noexcept -> kstd::Result<void>;
+        [[nodiscard]] auto decode_unit(Unit& unit) const noexcept -> kstd::Result<DecodedUnit*>;
+
+    public:
+        /**
+         * This constructor maps the specified ELF executable and locates the DWARF sections. No debug information is
+         * read before the first lookup.
+         *
+         * @param path            The path to the executable
+         * @param cache_directory The directory of the cache files or no value to disable the cache
+         * @author                Cedric Hammes
+         * @since                 16/10/2026
+         */
+        explicit LineTable(const std::filesystem::path& path,
+                           const std::optional<std::filesystem::path>& cache_directory = {});
+        ~LineTable() noexcept = default;
+        KSTD_DEFAULT_MOVE(LineTable, LineTable);
+        KSTD_NO_COPY(LineTable, LineTable);
+
+        /**
+         * This function returns the source location of the instruction at the specified address in the process.
+         * Only the compilation unit containing the address is decoded.
+         *
+         * @param address The address in the process
+         * @return        The location, no value when the address has no line information or an error
+         * @author        Cedric Hammes
+         * @since         16/10/2026
+         */
+        [[nodiscard]] auto find_location(std::intptr_t address) noexcept
+                -> kstd::Result<std::optional<SourceLocation>>;
+
+        /**
+         * This function returns the addresses of the statements at the specified line in the process. The file is
+         * matched by its path or the end of its path, when the line has no code the next line with code is used.
+         * Only the compilation units referencing the file are decoded.
+         *
+         * @param file The path of the source file
+         * @param line The line in the file
+         * @return     The addresses or an error
+         * @author     Cedric Hammes
+         * @since      16/10/2026
+         */
+        [[nodiscard]] auto find_addresses(std::string_view file, kstd::u32 line) noexcept
+                -> kstd::Result<std::vector<std::intptr_t>>;
+
+        /**
+         * This function sets the difference between the addresses in the process and the addresses in the
+         * executable, which is non-zero for position-independent executables.
+         *
+         * @param load_bias The load bias
+         * @author          Cedric Hammes
+         * @since           16/10/2026
+         */
+        inline auto set_load_bias(std::intptr_t load_bias) noexcept -> void {
+            _load_bias = load_bias;
+        }
+
+        /**
+         * This function returns whether the executable contains a line table.
+         *
+         * @return Whether line information is available
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto has_line_information() const noexcept -> bool {
+            return _debug_line.size != 0;
+        }
+    };
+}// namespace libdebug
\ No newline at end of file
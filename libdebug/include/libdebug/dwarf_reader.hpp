@@ -0,0 +1,150 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#pragma once
+#include <cstring>
+#include <kstd/types.hpp>
+#include <span>
+#include <string_view>
+
+namespace libdebug {
+    /**
+     * This class reads the encoded values of a DWARF section. Reads behind the end of the data mark the reader as
+     * failed and return zero, so a structure only has to be validated once after it was read.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class DwarfReader final {
+        std::span<const kstd::u8> _data;
+        std::size_t _offset;
+        bool _failed;
+
+    public:
+        DwarfReader(std::span<const kstd::u8> data, std::size_t offset) noexcept ://NOLINT
+                _data {data},
+                _offset {offset},
+                _failed {offset > data.size()} {
+        }
+
+        template<typename T>
+        [[nodiscard]] auto read() noexcept -> T {
+            T value {};
+            if(_failed || _data.size() - _offset < sizeof(T)) {
+                _failed = true;
+                return value;
+            }
+            std::memcpy(&value, _data.data() + _offset, sizeof(T));
+            _offset += sizeof(T);
+            return value;
+        }
+
+        [[nodiscard]] auto read_uleb128() noexcept -> kstd::u64 {
+            kstd::u64 value = 0;
+            for(std::size_t shift = 0;; shift += 7) {
+                const auto byte = read<kstd::u8>();
+                if(shift < 64) {
+                    value |= static_cast<kstd::u64>(byte & 0x7F) << shift;
+                }
+
+                if((byte & 0x80) == 0 || _failed) {
+                    return value;
+                }
+            }
+        }
+
+        [[nodiscard]] auto read_sleb128() noexcept -> kstd::i64 {
+            kstd::u64 value = 0;
+            std::size_t shift = 0;
+            kstd::u8 byte = 0;
+            do {
+                byte = read<kstd::u8>();
+                if(shift < 64) {
+                    value |= static_cast<kstd::u64>(byte & 0x7F) << shift;
+                }
+                shift += 7;
+            } while((byte & 0x80) != 0 && !_failed);
+
+            if(shift < 64 && (byte & 0x40) != 0) {
+                value |= ~kstd::u64 {0} << shift;
+            }
+            return static_cast<kstd::i64>(value);
+        }
+
+        [[nodiscard]] auto read_string() noexcept -> std::string_view {
+            if(_failed) {
+                return {};
+            }
+
+            const auto* begin = _data.data() + _offset;
+            const auto* end = static_cast<const kstd::u8*>(std::memchr(begin, 0, _data.size() - _offset));
+            if(end == nullptr) {
+                _failed = true;
+                return {};
+            }
+            _offset += static_cast<std::size_t>(end - begin) + 1;
+            return {reinterpret_cast<const char*>(begin), static_cast<std::size_t>(end - begin)};
+        }
+
+        [[nodiscard]] auto read_unit_length(bool& is_64_bit) noexcept -> kstd::u64 {
+            const auto length = read<kstd::u32>();
+            is_64_bit = length == 0xFFFFFFFF;
+            return is_64_bit ? read<kstd::u64>() : length;
+        }
+
+        [[nodiscard]] auto read_offset(bool is_64_bit) noexcept -> kstd::u64 {
+            return is_64_bit ? read<kstd::u64>() : read<kstd::u32>();
+        }
+
+        [[nodiscard]] auto read_address(std::size_t size) noexcept -> kstd::u64 {
+            switch(size) {
+                case 1: return read<kstd::u8>();
+                case 2: return read<kstd::u16>();
+                case 4: return read<kstd::u32>();
+                case 8: return read<kstd::u64>();
+                default: _failed = true; return 0;
+            }
+        }
+
+        auto skip(kstd::u64 size) noexcept -> void {
+            if(_failed || _data.size() - _offset < size) {
+                _failed = true;
+                return;
+            }
+            _offset += static_cast<std::size_t>(size);
+        }
+
+        auto fail() noexcept -> void {
+            _failed = true;
+        }
+
+        inline auto set_offset(std::size_t offset) noexcept -> void {
+            _offset = offset;
+            _failed = _failed || offset > _data.size();
+        }
+
+        [[nodiscard]] inline auto get_offset() const noexcept -> std::size_t {
+            return _offset;
+        }
+
+        [[nodiscard]] inline auto is_failed() const noexcept -> bool {
+            return _failed;
+        }
+    };
+}// namespace libdebug
\ No newline at end of file
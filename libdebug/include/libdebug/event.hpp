@@ -0,0 +1,313 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#pragma once
+#include "libdebug/arch/registers.hpp"
+#include "libdebug/platform/platform.hpp"
+#include "libdebug/signal.hpp"
+#include <array>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <kstd/defaults.hpp>
+#include <kstd/types.hpp>
+#include <mutex>
+#include <optional>
+#include <semaphore>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace libdebug {
+    /**
+     * This enum is naming the values of the event type in the process event. The enum is unscoped, so the values are
+     * converting implicitly into the integer event type of the event.
+     *
+     * @author Cedric Hammes
+     * @since  17/10/2026
+     */
+    enum ProcessEventType : kstd::u8 {
+        CREATE_THREAD = 0,
+        DELETE_THREAD = 1,
+        SIGNAL = 2,
+        CREATE_PROCESS = 3,
+        SYSCALL_ENTER = 4,
+        SYSCALL_EXIT = 5
+    };
+
+    struct ProcessEvent final {
+        kstd::u8 event_type;
+        union {
+            // Create Thread Event (Event Type = 0) TODO: add PEB to variables
+            struct {
+                platform::TaskId process_id;
+                platform::TaskId thread_id;
+#ifdef PLATFORM_WINDOWS
+                HANDLE thread_handle;
+#endif
+            } create_thread_event;
+
+            // Delete Thread Event (Event Type = 1)
+            struct {
+                platform::TaskId process_id;
+                platform::TaskId thread_id;
+            } delete_thread_event;
+
+            // Signal Event (Event Type = 2), the exit status is only set when the thread exited
+            struct {
+                platform::TaskId process_id;
+                platform::TaskId thread_id;
+                SignalInfo signal_info;
+                bool is_exit;
+                int exit_status;
+            } signal_event;
+
+            // Create Process Event (Event Type = 3)
+            struct {
+                platform::TaskId process_id;
+                platform::TaskId child_process_id;
+            } create_process_event;
+
+            // Syscall Enter and Syscall Exit Event (Event Type = 4 and 5), the return value is only set on exit
+            struct {
+                platform::TaskId process_id;
+                platform::TaskId thread_id;
+                kstd::u64 number;
+                std::array<kstd::u64, arch::syscall_argument_count> arguments;
+                kstd::i64 return_value;
+            } syscall_event;
+
+            // TODO: Exception event
+            // TODO: Breakpoint hit event
+            // TODO: Process exit event
+        };
+    };
+
+    using EventCallback = std::function<void(const ProcessEvent& event, void*)>;
+
+    /**
+     * This enum is describing what happens with an event, when the event queue is full.
+     *
+     * BLOCK: The producer waits until the consumer made space for the event
+     * DROP: The event is dropped and counted
+     * COALESCE: The event is kept back and replaced by newer events of the same type and thread until space is
+     *           available, so only the latest event of a burst reaches the consumer
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    enum class BackpressurePolicy : kstd::u8 {
+        BLOCK = 0,
+        DROP = 1,
+        COALESCE = 2
+    };
+
+    /**
+     * This class is a bounded lock-free ring buffer of process events with a single producer and a single consumer.
+     * The producer is the thread tracing the process, the consumer is the thread executing the event callbacks.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class EventQueue final {
+        std::vector<ProcessEvent> _slots;
+        std::size_t _mask;
+        BackpressurePolicy _policy;
+        alignas(64) std::atomic<std::size_t> _head;
+        alignas(64) std::atomic<std::size_t> _tail;
+        std::counting_semaphore<> _free_slots;
+        std::counting_semaphore<> _used_slots;
+        std::mutex _held_mutex;
+        std::deque<ProcessEvent> _held_events;
+        std::atomic<std::size_t> _held_count;
+        std::atomic<std::size_t> _dropped_count;
+        std::atomic<std::size_t> _coalesced_count;
+
+        auto write_slot(const ProcessEvent& event) noexcept -> void;
+        [[nodiscard]] auto read_slot(ProcessEvent& event) noexcept -> bool;
+        auto hold_event(const ProcessEvent& event) noexcept -> void;
+        auto flush_held_events() noexcept -> void;
+
+    public:
+        /**
+         * This constructor creates an empty event queue. The capacity is rounded up to the next power of two.
+         *
+         * @param capacity The minimal count of events in the queue
+         * @param policy   The policy for events pushed into the full queue
+         * @author         Cedric Hammes
+         * @since          16/10/2026
+         */
+        EventQueue(std::size_t capacity, BackpressurePolicy policy) noexcept;
+        ~EventQueue() noexcept = default;
+        KSTD_NO_MOVE_COPY(EventQueue, EventQueue);
+
+        /**
+         * This function pushes the specified event into the queue. This function is only called by the producer.
+         *
+         * @param event The event
+         * @return      Whether the event was queued, false when the event was dropped or held back
+         * @author      Cedric Hammes
+         * @since       16/10/2026
+         */
+        auto push(const ProcessEvent& event) noexcept -> bool;
+
+        /**
+         * This function queues the held back events of the coalesce policy, as long as space is available. This
+         * function is only called by the producer.
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        auto flush() noexcept -> void;
+
+        /**
+         * This function takes the oldest event out of the queue and waits for an event, when the queue is empty.
+         * The held back events of the coalesce policy are taken once the queue got empty. This function is only
+         * called by the consumer.
+         *
+         * @param event The event to write into
+         * @return      Whether an event was taken, false when the queue is closed and empty
+         * @author      Cedric Hammes
+         * @since       16/10/2026
+         */
+        [[nodiscard]] auto pop(ProcessEvent& event) noexcept -> bool;
+
+        /**
+         * This function closes the queue, so the consumer stops waiting after the last event. The held back events are
+         * taken by the consumer before. This function is only called by the producer.
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        auto close() noexcept -> void;
+
+        /**
+         * This function returns the count of events in the queue.
+         *
+         * @return The count of queued events
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto size() const noexcept -> std::size_t {
+            return _tail.load(std::memory_order_acquire) - _head.load(std::memory_order_acquire);
+        }
+
+        /**
+         * This function returns the maximal count of events in the queue.
+         *
+         * @return The capacity
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_capacity() const noexcept -> std::size_t {
+            return _slots.size();
+        }
+
+        /**
+         * This function returns the policy for events pushed into the full queue.
+         *
+         * @return The backpressure policy
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_policy() const noexcept -> BackpressurePolicy {
+            return _policy;
+        }
+
+        /**
+         * This function returns the count of events dropped by the drop policy.
+         *
+         * @return The count of dropped events
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_dropped_count() const noexcept -> std::size_t {
+            return _dropped_count.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * This function returns the count of events replaced by newer events with the coalesce policy.
+         *
+         * @return The count of coalesced events
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_coalesced_count() const noexcept -> std::size_t {
+            return _coalesced_count.load(std::memory_order_relaxed);
+        }
+    };
+
+    /**
+     * This class executes the event callbacks of a process on an own consumer thread, so slow callbacks don't extend
+     * the time the process stays stopped. The events are passed to the consumer through an event queue.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class EventDispatcher final {
+        std::vector<std::pair<const EventCallback, void*>> _callbacks;
+        EventQueue _queue;
+        std::thread _consumer_thread;
+
+    public:
+        /**
+         * This constructor creates the event queue and starts the consumer thread.
+         *
+         * @param callbacks The callbacks executed for each event
+         * @param capacity  The minimal count of events in the queue
+         * @param policy    The policy for events pushed into the full queue
+         * @author          Cedric Hammes
+         * @since           16/10/2026
+         */
+        EventDispatcher(std::vector<std::pair<const EventCallback, void*>> callbacks, std::size_t capacity,
+                        BackpressurePolicy policy) noexcept;
+
+        /**
+         * This destructor closes the event queue and waits until the consumer thread executed the callbacks for all
+         * queued events.
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        ~EventDispatcher() noexcept;
+        KSTD_NO_MOVE_COPY(EventDispatcher, EventDispatcher);
+
+        /**
+         * This function passes the specified event to the consumer thread.
+         *
+         * @param event The event to dispatch
+         * @author      Cedric Hammes
+         * @since       16/10/2026
+         */
+        inline auto dispatch(const ProcessEvent& event) noexcept -> void {
+            _queue.push(event);
+        }
+
+        /**
+         * This function returns the event queue between the tracing thread and the consumer thread.
+         *
+         * @return The event queue
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_queue() const noexcept -> const EventQueue& {
+            return _queue;
+        }
+    };
+}// namespace libdebug
\ No newline at end of file
@@ -0,0 +1,179 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#pragma once
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <kstd/defaults.hpp>
+#include <kstd/types.hpp>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace libdebug {
+    /**
+     * This structure is representing a single read of a scatter/gather memory read. The memory at the target address
+     * is copied into the buffer, the size of the buffer is the count of bytes read.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct MemoryReadRequest final {
+        std::intptr_t address;
+        std::span<kstd::u8> buffer;
+    };
+
+    /**
+     * This structure is representing a single write of a scatter/gather memory write. The data is copied to the
+     * memory at the target address.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct MemoryWriteRequest final {
+        std::intptr_t address;
+        std::span<const kstd::u8> data;
+    };
+
+    /**
+     * This class is a read-through cache over the memory of the target process, keyed by the address of the page.
+     * The cache is only valid while the process is stopped, so the process context invalidates it every time a
+     * thread is resumed or the memory is written.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class MemoryCache final {
+    public:
+        static constexpr std::size_t page_size = 4096;
+        using Page = std::array<kstd::u8, page_size>;
+
+    private:
+        std::unordered_map<std::intptr_t, std::size_t> _page_slots;
+        std::deque<Page> _pages;
+        std::vector<std::size_t> _free_slots;
+        std::size_t _used_pages;
+        std::size_t _hit_count;
+        std::size_t _miss_count;
+
+    public:
+        MemoryCache() noexcept;
+        ~MemoryCache() noexcept = default;
+        KSTD_DEFAULT_MOVE(MemoryCache, MemoryCache);
+        KSTD_NO_COPY(MemoryCache, MemoryCache);
+
+        /**
+         * This function returns the cached content of the specified page and counts a hit, or returns a null pointer
+         * and counts a miss when the page is not cached.
+         *
+         * @param page_address The page-aligned address of the page
+         * @return             The content of the page or nullptr
+         * @author             Cedric Hammes
+         * @since              16/10/2026
+         */
+        [[nodiscard]] auto find_page(std::intptr_t page_address) noexcept -> const Page*;
+
+        /**
+         * This function allocates a slot for the specified page and returns it, so the caller can fill it with the
+         * content of the page. The address of the returned page stays stable until the page is removed.
+         *
+         * @param page_address The page-aligned address of the page
+         * @return             The slot of the page
+         * @author             Cedric Hammes
+         * @since              16/10/2026
+         */
+        [[nodiscard]] auto insert_page(std::intptr_t page_address) noexcept -> Page&;
+
+        /**
+         * This function removes all cached pages overlapping the specified memory range.
+         *
+         * @param address The address of the memory range
+         * @param size    The size of the memory range
+         * @author        Cedric Hammes
+         * @since         16/10/2026
+         */
+        auto invalidate(std::intptr_t address, std::size_t size) noexcept -> void;
+
+        /**
+         * This function removes all cached pages. The allocated slots are kept for reuse.
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        auto invalidate() noexcept -> void;
+
+        /**
+         * This method returns whether the specified page is cached without counting a hit or miss.
+         *
+         * @param page_address The page-aligned address of the page
+         * @return             Whether the page is cached
+         * @author             Cedric Hammes
+         * @since              16/10/2026
+         */
+        [[nodiscard]] inline auto contains(std::intptr_t page_address) const noexcept -> bool {
+            return _page_slots.contains(page_address);
+        }
+
+        /**
+         * This method returns the count of page lookups which were served from the cache.
+         *
+         * @return The count of cache hits
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_hit_count() const noexcept -> std::size_t {
+            return _hit_count;
+        }
+
+        /**
+         * This method returns the count of page lookups which had to read the memory of the process.
+         *
+         * @return The count of cache misses
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_miss_count() const noexcept -> std::size_t {
+            return _miss_count;
+        }
+
+        /**
+         * This method returns the count of currently cached pages.
+         *
+         * @return The count of cached pages
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_page_count() const noexcept -> std::size_t {
+            return _page_slots.size();
+        }
+
+        /**
+         * This function returns the page-aligned address of the page containing the specified address.
+         *
+         * @param address The address
+         * @return        The address of the page
+         * @author        Cedric Hammes
+         * @since         16/10/2026
+         */
+        [[nodiscard]] static constexpr auto get_page_address(std::intptr_t address) noexcept -> std::intptr_t {
+            return address & ~static_cast<std::intptr_t>(page_size - 1);
+        }
+    };
+}// namespace libdebug
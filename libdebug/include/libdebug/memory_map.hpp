@@ -0,0 +1,167 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#pragma once
+#include "libdebug/platform/platform.hpp"
+#include <cstdint>
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <kstd/types.hpp>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace libdebug {
+    /**
+     * This enum is representing the access permissions of a memory region. The values are flags, so the permissions
+     * of a region are a combination of them.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    enum class MemoryPermission : kstd::u8 {
+        READ = 0b0001,
+        WRITE = 0b0010,
+        EXECUTE = 0b0100,
+        SHARED = 0b1000
+    };
+
+    /**
+     * This structure is describing a single mapped memory region of a process. The path is empty for anonymous
+     * mappings and is valid until the memory map is refreshed.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct MemoryRegion final {
+        std::intptr_t begin;
+        std::intptr_t end;
+        kstd::u64 offset;
+        kstd::u8 permissions;
+        std::string_view path;
+
+        /**
+         * This function returns whether the region has the specified permission.
+         *
+         * @param permission The permission
+         * @return           Whether the region has the permission
+         * @author           Cedric Hammes
+         * @since            16/10/2026
+         */
+        [[nodiscard]] constexpr auto has_permission(MemoryPermission permission) const noexcept -> bool {
+            return (permissions & static_cast<kstd::u8>(permission)) != 0;
+        }
+    };
+
+    /**
+     * This class is the map of the address space of a process. The whole map is read into a single buffer and the
+     * regions are kept in a flat array sorted by address, the paths are not copied out of the buffer. The map is
+     * only refreshed when it was invalidated, a refresh only parses the lines behind the first changed byte.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class MemoryMap final {
+        struct Region final {
+            std::uintptr_t end;
+            kstd::u64 offset;
+            kstd::u32 path_offset;
+            kstd::u32 path_size;
+            kstd::u32 line_end;
+            kstd::u8 permissions;
+        };
+
+        std::vector<char> _buffer;
+        std::vector<char> _next_buffer;
+        std::vector<std::uintptr_t> _region_begins;
+        std::vector<Region> _regions;
+        bool _stale;
+
+        [[nodiscard]] auto parse_regions(std::size_t offset) noexcept -> kstd::Result<void>;
+
+    public:
+        MemoryMap() noexcept;
+        ~MemoryMap() noexcept = default;
+        KSTD_DEFAULT_MOVE(MemoryMap, MemoryMap);
+        KSTD_NO_COPY(MemoryMap, MemoryMap);
+
+        /**
+         * This function reads the memory map of the specified process. Regions in front of the first change since
+         * the last refresh are kept without parsing them again.
+         *
+         * @param process_id The id of the process
+         * @return           Void or an error
+         * @author           Cedric Hammes
+         * @since            16/10/2026
+         */
+        [[nodiscard]] auto refresh(platform::TaskId process_id) noexcept -> kstd::Result<void>;
+
+        /**
+         * This function returns the region containing the specified address.
+         *
+         * @param address The address
+         * @return        The region or no value, when the address is not mapped
+         * @author        Cedric Hammes
+         * @since         16/10/2026
+         */
+        [[nodiscard]] auto find_region(std::intptr_t address) const noexcept -> std::optional<MemoryRegion>;
+
+        /**
+         * This function returns the region at the specified index, the regions are sorted by address.
+         *
+         * @param index The index of the region
+         * @return      The region
+         * @author      Cedric Hammes
+         * @since       16/10/2026
+         */
+        [[nodiscard]] auto get_region(std::size_t index) const noexcept -> MemoryRegion;
+
+        /**
+         * This function marks the memory map as stale, so it is refreshed before it is used the next time.
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        inline auto invalidate() noexcept -> void {
+            _stale = true;
+        }
+
+        /**
+         * This function returns whether the memory map was invalidated since the last refresh.
+         *
+         * @return Whether the memory map is stale
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto is_stale() const noexcept -> bool {
+            return _stale;
+        }
+
+        /**
+         * This function returns the count of regions in the memory map.
+         *
+         * @return The count of regions
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto size() const noexcept -> std::size_t {
+            return _regions.size();
+        }
+    };
+}// namespace libdebug
\ No newline at end of file
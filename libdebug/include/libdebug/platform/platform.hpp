@@ -18,7 +18,11 @@
  */
 
 #pragma once
+#include <filesystem>
+#include <kstd/defaults.hpp>
 #include <kstd/result.hpp>
+#include <kstd/types.hpp>
+#include <span>
 
 #ifdef PLATFORM_WINDOWS
 #define WIN32_LEAN_AND_MEAN
@@ -37,6 +41,118 @@ namespace libdebug::platform {
     using TaskId = pid_t;
 #endif
 
+    /**
+     * This class owns a single file handle and closes it when being destroyed. The ownership can be moved, but not
+     * copied.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class OwnedHandle final {
+        FileHandle _handle;
+
+    public:
+        /**
+         * This constructor creates an owned handle which doesn't own any handle.
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        OwnedHandle() noexcept;
+
+        /**
+         * This constructor takes the ownership over the specified handle.
+         *
+         * @param handle The handle to own
+         * @author       Cedric Hammes
+         * @since        16/10/2026
+         */
+        explicit OwnedHandle(FileHandle handle) noexcept;
+        ~OwnedHandle() noexcept;
+        KSTD_NO_COPY(OwnedHandle, OwnedHandle);
+
+        OwnedHandle(OwnedHandle&& other) noexcept;
+        auto operator=(OwnedHandle&& other) noexcept -> OwnedHandle&;
+
+        /**
+         * This method returns the owned handle
+         *
+         * @return The owned handle
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get() const noexcept -> FileHandle {
+            return _handle;
+        }
+
+        /**
+         * This method returns whether this object owns a valid handle
+         *
+         * @return Whether the handle is valid
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto is_valid() const noexcept -> bool;
+    };
+
+    /**
+     * This class owns a read-only mapping of a whole file into the memory of the debugger and unmaps it when being
+     * destroyed. The ownership can be moved, but not copied.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class FileMapping final {
+        const kstd::u8* _data;
+        std::size_t _size;
+
+    public:
+        /**
+         * This constructor creates a file mapping which doesn't own any mapping.
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        FileMapping() noexcept;
+
+        /**
+         * This constructor takes the ownership over the specified mapped memory.
+         *
+         * @param data The address of the mapping
+         * @param size The size of the mapping
+         * @author     Cedric Hammes
+         * @since      16/10/2026
+         */
+        FileMapping(const kstd::u8* data, std::size_t size) noexcept;
+        ~FileMapping() noexcept;
+        KSTD_NO_COPY(FileMapping, FileMapping);
+
+        FileMapping(FileMapping&& other) noexcept;
+        auto operator=(FileMapping&& other) noexcept -> FileMapping&;
+
+        /**
+         * This method returns the content of the mapped file
+         *
+         * @return The mapped memory
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_data() const noexcept -> std::span<const kstd::u8> {
+            return {_data, _size};
+        }
+    };
+
+    /**
+     * This function maps the whole specified file read-only into the memory of the debugger. The pages are loaded
+     * by the operating system when they are accessed first.
+     *
+     * @param path The path to the file
+     * @return     The mapping of the file or an error
+     * @author     Cedric Hammes
+     * @since      16/10/2026
+     */
+    [[nodiscard]] auto map_file(const std::filesystem::path& path) noexcept -> kstd::Result<FileMapping>;
+
     /**
      * This function returns the last thrown error in this program. This is being used to print the error thrown by the
      * System API to the user.
@@ -0,0 +1,169 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#pragma once
+#include "libdebug/platform/platform.hpp"
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <kstd/defaults.hpp>
+#include <optional>
+#include <string>
+#include <unordered_set>
+
+namespace libdebug::platform {
+    /**
+     * This structure is representing a single state change (stop, exit etc.) of a traced task, as reported by the
+     * operating system.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct TaskStatus final {
+        TaskId task_id;
+        int status;
+    };
+
+    using TaskFilter = std::function<bool(TaskId task_id)>;
+
+    /**
+     * This class is the event-driven wait backend of libdebug. Instead of polling every task, it sleeps on a signalfd
+     * for SIGCHLD, peeks the available state changes and only reaps the ones of registered tasks. Other children of
+     * the application are never reaped. State changes of tasks which are not requested by the current caller are
+     * kept pending, so multiple process contexts can share the backend without stealing each other's events.
+     *
+     * The waiter has to be set up before the first wait. The setup blocks SIGCHLD in the calling thread and checks
+     * that it is blocked in all threads of the application, otherwise the kernel may deliver the signal to a thread
+     * which is not waiting on the signalfd and the wakeup is lost. This is a precondition for embedding libdebug:
+     * multithreaded applications have to block SIGCHLD before starting their threads, threads started afterward
+     * inherit the blocked signal. A failed setup can be repeated after the signal was blocked.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class TaskWaiter final {
+        FileHandle _signal_handle;
+        std::unordered_set<TaskId> _tasks;
+        std::deque<TaskStatus> _pending_statuses;
+
+        TaskWaiter();
+
+        [[nodiscard]] auto reap(TaskId task_id) noexcept -> kstd::Result<bool>;
+        [[nodiscard]] auto collect_registered() noexcept -> kstd::Result<std::size_t>;
+
+    public:
+        ~TaskWaiter() noexcept;
+        KSTD_NO_COPY(TaskWaiter, TaskWaiter);
+
+        /**
+         * This function returns the process-wide instance of the task waiter. It is created on the first call.
+         *
+         * @return The task waiter instance
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] static auto get_instance() -> TaskWaiter&;
+
+        /**
+         * This function sets up the waiter. SIGCHLD is blocked in the calling thread and the signalfd is created.
+         * SIGCHLD has to be blocked in all other threads of the application before, otherwise an error is returned.
+         * The setup can be repeated after a failure, it does nothing after a successful setup.
+         *
+         * @return Void or an error
+         * @author Cedric Hammes
+         * @since  17/10/2026
+         */
+        [[nodiscard]] auto setup() noexcept -> kstd::Result<void>;
+
+        /**
+         * This function blocks until a task accepted by the specified filter changes its state or the timeout is
+         * elapsed. No CPU time is consumed while waiting.
+         *
+         * @param filter  The filter selecting the tasks of the caller
+         * @param timeout The maximum time to wait, or no value to wait infinitely
+         * @return        The status of the task, no value when the timeout is elapsed or an error
+         * @author        Cedric Hammes
+         * @since         16/10/2026
+         */
+        [[nodiscard]] auto wait(const TaskFilter& filter, std::optional<std::chrono::milliseconds> timeout) noexcept
+                -> kstd::Result<std::optional<TaskStatus>>;
+
+        /**
+         * This function registers the specified traced task, so its state changes are reaped by the waiter. Tasks
+         * are unregistered automatically after their exit was reaped.
+         *
+         * @param task_id The id of the task
+         * @author        Cedric Hammes
+         * @since         16/10/2026
+         */
+        auto add_task(TaskId task_id) noexcept -> void;
+
+        /**
+         * This function unregisters the specified task, like after it was detached. The pending statuses of the task
+         * are discarded.
+         *
+         * @param task_id The id of the task
+         * @author        Cedric Hammes
+         * @since         16/10/2026
+         */
+        auto remove_task(TaskId task_id) noexcept -> void;
+
+        /**
+         * This function reaps all state changes of the registered tasks which are currently available without
+         * blocking and appends them to the pending statuses. The cost scales with the count of state changes, not with
+         * the count of registered tasks. This also resets the readiness of the signalfd.
+         *
+         * @return The count of collected statuses or an error
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto collect() noexcept -> kstd::Result<std::size_t>;
+
+        /**
+         * This function removes all pending statuses of tasks accepted by the specified filter.
+         *
+         * @param filter The filter selecting the discarded tasks
+         * @author       Cedric Hammes
+         * @since        16/10/2026
+         */
+        auto discard(const TaskFilter& filter) noexcept -> void;
+
+        /**
+         * This function appends the specified status to the pending statuses, so it is returned by a later wait.
+         * This is used to hand back statuses which were consumed by an internal wait of the caller.
+         *
+         * @param task_status The status to hand back
+         * @author            Cedric Hammes
+         * @since             16/10/2026
+         */
+        auto push(const TaskStatus& task_status) noexcept -> void;
+
+        /**
+         * This function returns the handle which gets readable when a traced task changes its state. This can be used
+         * to integrate the waiter in an existing event loop. The handle is only valid after the setup.
+         *
+         * @return The handle of the signalfd
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_handle() const noexcept -> FileHandle {
+            return _signal_handle;
+        }
+    };
+}// namespace libdebug::platform
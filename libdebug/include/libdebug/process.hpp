@@ -18,12 +18,29 @@
  */
 
 #pragma once
+#include "libdebug/arch/instruction.hpp"
+#include "libdebug/breakpoint.hpp"
+#include "libdebug/event.hpp"
+#include "libdebug/memory.hpp"
+#include "libdebug/memory_map.hpp"
 #include "libdebug/platform/platform.hpp"
+#include "libdebug/platform/waiter.hpp"
 #include "libdebug/signal.hpp"
+#include "libdebug/dwarf.hpp"
+#include "libdebug/symbols.hpp"
 #include "libdebug/thread.hpp"
+#include "libdebug/tracepoint.hpp"
+#include "libdebug/unwind.hpp"
+#include <array>
+#include <chrono>
 #include <filesystem>
 #include <kstd/types.hpp>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string_view>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #ifdef PLATFORM_LINUX
@@ -33,105 +50,36 @@
 #endif
 
 namespace libdebug {
-    struct ProcessEvent final {
-        kstd::u8 event_type;
-        union {
-            // Create Thread Event (Event Type = 0) TODO: add PEB to variables
-            struct {
-                platform::TaskId process_id;
-                platform::TaskId thread_id;
-#ifdef PLATFORM_WINDOWS
-                HANDLE thread_handle;
-#endif
-            } create_thread_event;
-
-            // Delete Thread Event (Event Type = 1)
-            struct {
-                platform::TaskId process_id;
-                platform::TaskId thread_id;
-            } delete_thread_event;
-
-            // TODO: Exception event
-            // TODO: Breakpoint hit event
-            // TODO: Process exit event
-        };
-    };
-
-    using EventCallback = std::function<void(const ProcessEvent& event, void*)>;
-
     /**
-     * This class is representing a single process being debugged by this application. This context can be initialized
-     * by starting a subprocess that is being debugged or attach to an existing process.
+     * This structure is identifying the executable image of a process by its file and its entry point, so an exec of
+     * the same file at the same address can be detected.
      *
      * @author Cedric Hammes
-     * @since  13/03/2024
+     * @since  16/10/2026
      */
-    class ProcessContext;
+    struct ImageIdentity final {
+        kstd::u64 device;
+        kstd::u64 inode;
+        std::intptr_t entry_address;
+
+        [[nodiscard]] auto operator==(const ImageIdentity& other) const noexcept -> bool = default;
+    };
 
     /**
-     * This class is representing a single breakpoint on some address. This is used by the debug context to handle
-     * breakpoints.
+     * This structure is representing a page for out-of-line execution mapped into the process. The page keeps the
+     * last instruction relocated into it, so stepping over the same breakpoint again doesn't rewrite the page. A page
+     * is used for all breakpoints in reach, so RIP-relative operands of their instructions can be relocated into it.
      *
      * @author Cedric Hammes
-     * @since  09/03/2024
+     * @since  17/10/2026
      */
-    class Breakpoint final {
-        std::intptr_t _address;
-        bool _enabled;
-        kstd::u8 _saved_data;
-
-    public:
-        /**
-         * This constructor constructs an empty breakpoint
-         *
-         * @author Cedric Hammes
-         * @since  09/03/2024
-         */
-        explicit Breakpoint(std::intptr_t target_address) noexcept;
-        ~Breakpoint() noexcept = default;
-        KSTD_DEFAULT_MOVE_COPY(Breakpoint, Breakpoint);
+    struct ScratchPage final {
+        static constexpr std::intptr_t reach = 1L << 30;
+        static constexpr std::intptr_t min_distance = 1L << 20;
 
-        /**
-         * This function enables the breakpoint by replacing the instruction at the specified address and saving the
-         * original data in this class.
-         *
-         * @return Void or an error
-         * @author Cedric Hammes
-         * @since  09/03/2024
-         */
-        [[nodiscard]] auto enable(const ThreadContext& target_thread_context) noexcept -> kstd::Result<void>;
-
-        /**
-         * This function disables the breakpoint by replacing the inserted instruction at the specified address with the
-         * original data saved.
-         *
-         * @return Void or an error
-         * @author Cedric Hammes
-         * @since  09/03/2024
-         */
-        [[nodiscard]] auto disable(const ThreadContext& target_thread_context) noexcept -> kstd::Result<void>;
-
-        /**
-         * This method returns the address to the breakpoint
-         *
-         * @return The breakpoint address
-         * @author Cedric Hammes
-         * @since  09/03/2024
-         */
-        [[nodiscard]] inline auto get_address() const noexcept -> std::intptr_t {
-            return _address;
-        }
-
-        /**
-         * This method returns whether the breakpoint was enabled or not
-         *
-         * @return Whether the breakpoint was enabled or not
-         * @author Cedric Hammes
-         * @since  09/03/2024
-         */
-        [[nodiscard]] inline auto is_enabled() const noexcept -> bool {
-            return _enabled;
-        }
+        std::intptr_t address;
+        std::intptr_t breakpoint;
+        arch::RelocatedInstruction instruction;
     };
 
     /**
@@ -143,25 +91,101 @@ namespace libdebug {
      */
     class ProcessContext final {
         platform::TaskId _process_id;
-        std::unordered_map<std::intptr_t, Breakpoint> _breakpoints;
+        BreakpointTable _breakpoints;
         std::unordered_map<platform::TaskId, ThreadContext> _threads;
+        std::unordered_map<platform::TaskId, ThreadContext> _child_threads;
         std::vector<std::pair<const EventCallback, void*>> _event_callbacks;
+        std::unique_ptr<EventDispatcher> _event_dispatcher;
+        platform::OwnedHandle _memory_handle;
+        MemoryCache _memory_cache;
+        MemoryMap _memory_map;
+        std::vector<ScratchPage> _scratch_pages;
+        std::unordered_set<std::intptr_t> _stale_breakpoints;
+        std::vector<std::intptr_t> _dropped_breakpoints;
+        std::optional<ImageIdentity> _image_identity;
+        std::array<std::optional<HardwareBreakpoint>, HardwareBreakpoint::slot_count> _hardware_breakpoints;
+        std::filesystem::path _executable_path;
+        std::optional<SymbolTable> _symbols;
+        std::optional<LineTable> _line_table;
+        std::unordered_map<std::string, std::unique_ptr<CallFrameTable>> _call_frame_tables;
+        std::vector<UnwindModule> _unwind_modules;
+        std::chrono::microseconds _attach_latency;
+        bool _is_seized;
+        std::size_t _running_thread_count;
+        std::vector<int> _traced_syscalls;
+        std::unordered_map<std::intptr_t, Tracepoint> _tracepoints;
+        TraceBuffer _trace_buffer;
+        std::pair<TracepointCallback, void*> _tracepoint_callback;
+
+        [[nodiscard]] auto get_memory_handle() noexcept -> kstd::Result<platform::FileHandle>;
+        [[nodiscard]] auto register_thread(platform::TaskId thread_id) noexcept -> kstd::Result<void>;
+        auto insert_thread(platform::TaskId thread_id) noexcept -> ThreadContext&;
+        auto erase_thread(std::unordered_map<platform::TaskId, ThreadContext>::iterator thread) noexcept
+                -> std::unordered_map<platform::TaskId, ThreadContext>::iterator;
+        auto set_thread_state(ThreadContext& thread, ThreadState state) noexcept -> void;
+        auto mark_stale_breakpoint(std::intptr_t address) noexcept -> void;
+        [[nodiscard]] auto set_hardware_breakpoints(ThreadContext& thread) noexcept -> kstd::Result<void>;
+        [[nodiscard]] auto handle_trace_event(ThreadContext& thread, int event) noexcept -> kstd::Result<void>;
+        [[nodiscard]] auto restore_breakpoints(ThreadContext& thread) noexcept -> kstd::Result<void>;
+        [[nodiscard]] auto handle_syscall_stop(ThreadContext& thread, bool is_entry) noexcept -> kstd::Result<void>;
+        [[nodiscard]] auto record_tracepoint_hit(ThreadContext& thread, Tracepoint& tracepoint) noexcept
+                -> kstd::Result<void>;
+        [[nodiscard]] auto append_thread_notes(ThreadContext& thread, std::vector<kstd::u8>& notes) noexcept
+                -> kstd::Result<void>;
+        [[nodiscard]] auto release_child_process(platform::TaskId child_process_id, bool shares_memory) noexcept
+                -> kstd::Result<void>;
+        [[nodiscard]] auto restore_child_breakpoints(platform::TaskId child_process_id) noexcept -> kstd::Result<void>;
+        [[nodiscard]] auto handle_child_status(ThreadContext& thread, int status) noexcept -> kstd::Result<void>;
+        [[nodiscard]] auto step_child_over_breakpoint(ThreadContext& thread) noexcept
+                -> kstd::Result<std::optional<platform::TaskStatus>>;
+        [[nodiscard]] auto read_memory_uncached(std::span<const MemoryReadRequest> requests) noexcept
+                -> kstd::Result<void>;
+        [[nodiscard]] auto patch_breakpoint_pages(std::span<const std::intptr_t> addresses,
+                                                  const std::function<void(std::size_t, kstd::u8&)>& patch) noexcept
+                -> std::vector<kstd::Result<void>>;
+        [[nodiscard]] auto get_entry_address() const noexcept -> kstd::Result<std::intptr_t>;
+        [[nodiscard]] auto single_step(ThreadContext& thread) noexcept -> kstd::Result<platform::TaskStatus>;
+        [[nodiscard]] auto inject_syscall(ThreadContext& thread, kstd::u64 number,
+                                          const std::array<kstd::u64, arch::syscall_argument_count>& arguments) noexcept
+                -> kstd::Result<kstd::u64>;
+        [[nodiscard]] auto allocate_scratch_page(ThreadContext& thread, std::intptr_t address) noexcept
+                -> kstd::Result<std::intptr_t>;
+        [[nodiscard]] auto find_scratch_page(ThreadContext& thread, std::intptr_t address) noexcept
+                -> kstd::Result<ScratchPage*>;
+        [[nodiscard]] auto relocate_breakpoint_instruction(std::intptr_t address,
+                                                           std::intptr_t scratch_address) noexcept
+                -> kstd::Result<arch::RelocatedInstruction>;
+        [[nodiscard]] auto step_over_breakpoint_in_place(ThreadContext& thread, Breakpoint& breakpoint) noexcept
+                -> kstd::Result<std::optional<platform::TaskStatus>>;
+        [[nodiscard]] auto step_over_breakpoint(ThreadContext& thread, std::intptr_t address) noexcept
+                -> kstd::Result<std::optional<platform::TaskStatus>>;
+        [[nodiscard]] auto is_step_reported(const ThreadContext& thread, const platform::TaskStatus& status) noexcept
+                -> kstd::Result<bool>;
+        [[nodiscard]] auto find_unwind_module(std::intptr_t address) noexcept -> kstd::Result<const UnwindModule*>;
 
     public:
         /**
          * This constructor starts the specified path to the executable with the specified arguments in subprocess
-         * and attaches the debugger context to it.
+         * and attaches the debugger context to it. When syscalls are specified, the subprocess installs a seccomp
+         * filter before the executable is started, which only stops the process at the specified syscalls. Their
+         * entry and exit are dispatched to the event callbacks.
          *
-         * @param executable The path to the executable to debug
-         * @param arguments  The command-line arguments
-         * @author           Cedric Hammes
-         * @since            13/03/2024
+         * Children forked by the process inherit the filter, so they are kept traced and their syscalls are
+         * dispatched to the event callbacks too.
+         *
+         * @param executable      The path to the executable to debug
+         * @param arguments       The command-line arguments
+         * @param traced_syscalls The numbers of the syscalls to trace
+         * @author                Cedric Hammes
+         * @since                 13/03/2024
          */
-        ProcessContext(const std::filesystem::path& executable_path, const std::vector<std::string>& arguments);
+        ProcessContext(const std::filesystem::path& executable_path, const std::vector<std::string>& arguments,
+                       const std::vector<int>& traced_syscalls = {});
 
         /**
          * This constructor attaches the debugger to the specified process, identified by the specified process
-         * id.
+         * id. The threads are seized with the tracing options set atomically and the task list is scanned until no new
+         * thread is found, afterward all threads are interrupted.
          *
          * @param process_id The pid of the target process
          * @author           Cedric Hammes
@@ -172,8 +196,44 @@ namespace libdebug {
         KSTD_DEFAULT_MOVE(ProcessContext, ProcessContext);
         KSTD_NO_COPY(ProcessContext, ProcessContext);
 
+        /**
+         * This function blocks until any thread of the process receives a signal or changes its state. The calling
+         * thread sleeps in the kernel while waiting, so no CPU time is consumed. Stops of thread lifecycle events are
+         * handled while waiting and are only reported to the event callbacks.
+         *
+         * @return The signal of the thread or an error
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
         [[nodiscard]] auto wait_for_signal() noexcept -> kstd::Result<Signal>;
 
+        /**
+         * This function blocks until any thread of the process receives a signal, changes its state or the specified
+         * timeout is elapsed. Stops of thread lifecycle events are handled while waiting and are only reported to the
+         * event callbacks.
+         *
+         * @param timeout The maximum time to wait for a signal
+         * @return        The signal of the thread, no value when the timeout is elapsed or an error
+         * @author        Cedric Hammes
+         * @since         16/10/2026
+         */
+        [[nodiscard]] auto wait_for_signal(std::chrono::milliseconds timeout) noexcept
+                -> kstd::Result<std::optional<Signal>>;
+
+        /**
+         * This function converts the specified status, reported by the wait backend for a thread of this process,
+         * into a signal. The signal info is read from the thread which changed its state. Thread creation, thread exit
+         * and fork stops update the threads of this process, are dispatched to the event callbacks and resume the
+         * thread without a signal.
+         *
+         * @param task_status The status of the thread
+         * @return            The signal of the thread, no value when the stop was handled internally or an error
+         * @author            Cedric Hammes
+         * @since             16/10/2026
+         */
+        [[nodiscard]] auto handle_task_status(const platform::TaskStatus& task_status) noexcept
+                -> kstd::Result<std::optional<Signal>>;
+
         /**
          * This method adds the specified callback to the event callback
          * list.
@@ -185,6 +245,67 @@ namespace libdebug {
          */
         inline auto add_event_callback(const EventCallback& callback, void* data) noexcept -> void {
             _event_callbacks.emplace_back(callback, data);
+            if(_event_dispatcher != nullptr) {
+                const auto& queue = _event_dispatcher->get_queue();
+                enable_async_dispatch(queue.get_capacity(), queue.get_policy());
+            }
+        }
+
+        /**
+         * This method passes the specified event to all callbacks in the event callback list. With asynchronous
+         * dispatch, the event is only queued and the callbacks are executed on the consumer thread.
+         *
+         * @param event The event to dispatch
+         * @author      Cedric Hammes
+         * @since       16/10/2026
+         */
+        inline auto dispatch_event(const ProcessEvent& event) const noexcept -> void {
+            if(_event_dispatcher != nullptr) {
+                _event_dispatcher->dispatch(event);
+                return;
+            }
+
+            for(const auto& [callback, data] : _event_callbacks) {
+                callback(event, data);
+            }
+        }
+
+        /**
+         * This method enables the asynchronous dispatch of events. The events are passed through a bounded event
+         * queue to a consumer thread, which executes the callbacks, so slow callbacks don't keep the process stopped.
+         * When asynchronous dispatch is already enabled, the queued events are dispatched before the queue is
+         * replaced.
+         *
+         * @param capacity The minimal count of events in the queue
+         * @param policy   The policy for events dispatched while the queue is full
+         * @author         Cedric Hammes
+         * @since          16/10/2026
+         */
+        inline auto enable_async_dispatch(std::size_t capacity, BackpressurePolicy policy) noexcept -> void {
+            _event_dispatcher.reset();
+            _event_dispatcher = std::make_unique<EventDispatcher>(_event_callbacks, capacity, policy);
+        }
+
+        /**
+         * This method disables the asynchronous dispatch of events. All queued events are dispatched before this
+         * method returns, the callbacks are executed on the calling thread afterward.
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        inline auto disable_async_dispatch() noexcept -> void {
+            _event_dispatcher.reset();
+        }
+
+        /**
+         * This method returns the event dispatcher of the asynchronous dispatch, which is used to inspect the queue.
+         *
+         * @return The event dispatcher or nullptr, when the events are dispatched synchronously
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_event_dispatcher() const noexcept -> const EventDispatcher* {
+            return _event_dispatcher.get();
         }
 
         /**
@@ -197,6 +318,27 @@ namespace libdebug {
          */
         [[nodiscard]] auto add_breakpoint(std::intptr_t address) noexcept -> kstd::Result<void>;
 
+        /**
+         * This function adds a breakpoint at the address of the symbol with the specified name.
+         *
+         * @param symbol_name The name of the symbol
+         * @return            Void or an error
+         * @author            Cedric Hammes
+         * @since             16/10/2026
+         */
+        [[nodiscard]] auto add_breakpoint(std::string_view symbol_name) noexcept -> kstd::Result<void>;
+
+        /**
+         * This function adds breakpoints at the statements of the specified line in the specified source file.
+         *
+         * @param file The path or the end of the path of the source file
+         * @param line The line in the source file
+         * @return     Void or an error
+         * @author     Cedric Hammes
+         * @since      16/10/2026
+         */
+        [[nodiscard]] auto add_breakpoint(std::string_view file, kstd::u32 line) noexcept -> kstd::Result<void>;
+
         /**
          * This function removes the breakpoint from the specified address when no breakpoint was added before
          *
@@ -207,6 +349,192 @@ namespace libdebug {
          */
         [[nodiscard]] auto remove_breakpoint(std::intptr_t address) noexcept -> kstd::Result<void>;
 
+        /**
+         * This function adds breakpoints at all specified addresses. The addresses are grouped by page, so every page
+         * is patched with a single read-modify-write instead of one per breakpoint.
+         *
+         * @param addresses The breakpoint addresses
+         * @return          The result for each address, in the order of the specified addresses
+         * @author          Cedric Hammes
+         * @since           16/10/2026
+         */
+        [[nodiscard]] auto add_breakpoints(std::span<const std::intptr_t> addresses) noexcept
+                -> std::vector<kstd::Result<void>>;
+
+        /**
+         * This function adds tracepoints at all specified addresses. The breakpoints are added in one batch, a hit
+         * records the selected registers into the trace buffer and resumes the thread without reporting a signal or
+         * calling the event callbacks. The trace buffer is allocated with the default capacity, when it has no
+         * capacity yet. Tracepoints are removed with their breakpoints.
+         *
+         * Tracepoints without records only count their hits, so they never read registers or fill the trace buffer.
+         *
+         * @param addresses   The tracepoint addresses
+         * @param registers   The registers to record at each hit
+         * @param hit_budget  The count of hits after which the breakpoint is disabled, or zero for no limit
+         * @param is_recorded Whether a hit is recorded into the trace buffer
+         * @return            The result for each address, in the order of the specified addresses
+         * @author            Cedric Hammes
+         * @since             16/10/2026
+         */
+        [[nodiscard]] auto add_tracepoints(std::span<const std::intptr_t> addresses,
+                                           std::span<const TraceRegister> registers = {}, kstd::u64 hit_budget = 0,
+                                           bool is_recorded = true) noexcept -> std::vector<kstd::Result<void>>;
+
+        /**
+         * This function adds a tracepoint at the specified address.
+         *
+         * @param address     The tracepoint address
+         * @param registers   The registers to record at each hit
+         * @param hit_budget  The count of hits after which the breakpoint is disabled, or zero for no limit
+         * @param is_recorded Whether a hit is recorded into the trace buffer
+         * @return            Void or an error
+         * @author            Cedric Hammes
+         * @since             16/10/2026
+         */
+        [[nodiscard]] auto add_tracepoint(std::intptr_t address, std::span<const TraceRegister> registers = {},
+                                          kstd::u64 hit_budget = 0, bool is_recorded = true) noexcept
+                -> kstd::Result<void>;
+
+        /**
+         * This function sets the callback, which is called after each hit of a tracepoint was counted. The callback
+         * is called by the thread waiting for the signals of the process. An empty callback removes the callback.
+         *
+         * @param callback The callback
+         * @param data     The in-callback modifiable data
+         * @author         Cedric Hammes
+         * @since          17/10/2026
+         */
+        inline auto set_tracepoint_callback(const TracepointCallback& callback, void* data) noexcept -> void {
+            _tracepoint_callback = {callback, data};
+        }
+
+        /**
+         * This function removes the breakpoints from all specified addresses. The addresses are grouped by page, so
+         * every page is restored with a single read-modify-write instead of one per breakpoint.
+         *
+         * @param addresses The breakpoint addresses
+         * @return          The result for each address, in the order of the specified addresses
+         * @author          Cedric Hammes
+         * @since           16/10/2026
+         */
+        [[nodiscard]] auto remove_breakpoints(std::span<const std::intptr_t> addresses) noexcept
+                -> std::vector<kstd::Result<void>>;
+
+        /**
+         * This function adds the specified hardware breakpoint to a free debug register slot of all threads. Threads
+         * registered later get the breakpoint too. The debug registers can only be written while a thread is stopped,
+         * so running threads get the breakpoint at their next stop.
+         *
+         * @param breakpoint The hardware breakpoint
+         * @return           The slot of the breakpoint or an error
+         * @author           Cedric Hammes
+         * @since            16/10/2026
+         */
+        [[nodiscard]] auto add_hardware_breakpoint(const HardwareBreakpoint& breakpoint) noexcept
+                -> kstd::Result<std::size_t>;
+
+        /**
+         * This function removes the hardware breakpoint in the specified slot from all threads. Running threads clear
+         * the breakpoint at their next stop, the slot stays in use until then.
+         *
+         * @param slot The slot of the breakpoint
+         * @return     Void or an error
+         * @author     Cedric Hammes
+         * @since      16/10/2026
+         */
+        [[nodiscard]] auto remove_hardware_breakpoint(std::size_t slot) noexcept -> kstd::Result<void>;
+
+        /**
+         * This function continues the execution of the specified stopped thread. All cached state of the process, like
+         * the memory cache, is invalidated before the thread is resumed. When the thread is stopped at a breakpoint,
+         * the original instruction is executed out-of-line first, so the breakpoint stays inserted and the other
+         * threads don't need to be stopped. When a signal is delivered, the thread is rewound to the breakpoint
+         * instead and hits it again after the signal handler. Resuming a running thread is an error.
+         *
+         * @param thread_id The id of the thread
+         * @param signal    The signal to deliver to the thread, or 0 to deliver no signal
+         * @return          Void or an error
+         * @author          Cedric Hammes
+         * @since           16/10/2026
+         */
+        [[nodiscard]] auto resume_thread(platform::TaskId thread_id, int signal = 0) noexcept -> kstd::Result<void>;
+
+        /**
+         * This function executes a single instruction in the specified stopped thread. All cached state of the
+         * process, like the memory cache, is invalidated before the thread is resumed. When the thread is stopped at
+         * a breakpoint, the original instruction is executed out-of-line like in resume_thread. Stepping a running
+         * thread is an error.
+         *
+         * @param thread_id The id of the thread
+         * @param signal    The signal to deliver to the thread, or 0 to deliver no signal
+         * @return          Void or an error
+         * @author          Cedric Hammes
+         * @since           16/10/2026
+         */
+        [[nodiscard]] auto step_thread(platform::TaskId thread_id, int signal = 0) noexcept -> kstd::Result<void>;
+
+        /**
+         * This function stops the specified running thread, while all other threads keep running. The stop is
+         * reported by the next wait. Threads of an attached process are interrupted with PTRACE_INTERRUPT, threads of
+         * a started process are stopped with SIGSTOP, which is suppressed when the thread is resumed without a signal.
+         *
+         * @param thread_id The id of the thread
+         * @return          Void or an error
+         * @author          Cedric Hammes
+         * @since           16/10/2026
+         */
+        [[nodiscard]] auto interrupt_thread(platform::TaskId thread_id) noexcept -> kstd::Result<void>;
+
+        /**
+         * This function reads the memory at the specified address of the process into the specified buffer. Readable
+         * memory is copied with a single process_vm_readv call, other memory is read through /proc/pid/mem.
+         *
+         * @param address The address of the memory
+         * @param buffer  The buffer to read into
+         * @return        Void or an error
+         * @author        Cedric Hammes
+         * @since         16/10/2026
+         */
+        [[nodiscard]] auto read_memory(std::intptr_t address, std::span<kstd::u8> buffer) noexcept
+                -> kstd::Result<void>;
+
+        /**
+         * This function performs all specified memory reads with as few process_vm_readv calls as possible. Small reads
+         * are served from the memory cache, pages missing in the cache are fetched together. While any thread is
+         * running, the cache is bypassed.
+         *
+         * @param requests The reads to perform
+         * @return         Void or an error
+         * @author         Cedric Hammes
+         * @since          16/10/2026
+         */
+        [[nodiscard]] auto read_memory(std::span<const MemoryReadRequest> requests) noexcept -> kstd::Result<void>;
+
+        /**
+         * This function writes the specified data into the memory of the process at the specified address. Writable
+         * memory is written with a single process_vm_writev call, read-only memory (like text pages) is written
+         * through /proc/pid/mem.
+         *
+         * @param address The address of the memory
+         * @param data    The data to write
+         * @return        Void or an error
+         * @author        Cedric Hammes
+         * @since         16/10/2026
+         */
+        [[nodiscard]] auto write_memory(std::intptr_t address, std::span<const kstd::u8> data) noexcept
+                -> kstd::Result<void>;
+
+        /**
+         * This function performs all specified memory writes with as few process_vm_writev calls as possible.
+         *
+         * @param requests The writes to perform
+         * @return         Void or an error
+         * @author         Cedric Hammes
+         * @since          16/10/2026
+         */
+        [[nodiscard]] auto write_memory(std::span<const MemoryWriteRequest> requests) noexcept -> kstd::Result<void>;
+
         /**
          * This function checks whether the process bound with the debug context is still running or has been
          * terminated.
@@ -215,7 +543,42 @@ namespace libdebug {
          * @author Cedric Hammes
          * @since  09/03/2024
          */
-        inline auto is_process_running() const noexcept -> kstd::Result<bool>;
+        [[nodiscard]] auto is_process_running() const noexcept -> kstd::Result<bool>;
+
+        /**
+         * This method returns a const reference to the memory cache, which provides the hit and miss counters.
+         *
+         * @return The memory cache
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_memory_cache() const noexcept -> const MemoryCache& {
+            return _memory_cache;
+        }
+
+        /**
+         * This function returns the memory map of the process. The map is invalidated when a thread is resumed and
+         * only refreshed when it is requested, so it is read at most once per stop.
+         *
+         * @return The memory map or an error
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_memory_map() noexcept -> kstd::Result<const MemoryMap*>;
+
+        /**
+         * This function writes an ELF core file of the stopped process, which can be loaded by debuggers like GDB.
+         * Every thread gets its general-purpose, floating-point and extended registers as notes, every mapping of
+         * the process becomes a loadable segment. The memory is read in large chunks while the previous chunk is
+         * written, all-zero pages are left as holes in the sparse file. Breakpoints are replaced with the original
+         * code in the file.
+         *
+         * @param path The path of the core file
+         * @return     Void or an error
+         * @author     Cedric Hammes
+         * @since      16/10/2026
+         */
+        [[nodiscard]] auto write_core_file(const std::filesystem::path& path) noexcept -> kstd::Result<void>;
 
         /**
          * This method returns a const reference to all registered breakpoints in the process context
@@ -224,11 +587,35 @@ namespace libdebug {
          * @author Cedric Hammes
          * @since  09/03/2024
          */
-        [[nodiscard]] inline auto get_breakpoints() const noexcept
-                -> const std::unordered_map<std::intptr_t, Breakpoint>& {
+        [[nodiscard]] inline auto get_breakpoints() const noexcept -> const BreakpointTable& {
             return _breakpoints;
         }
 
+        /**
+         * This method returns the addresses of the breakpoints, which were dropped by the last exec of the process.
+         * Breakpoints are only kept when the same executable was started again at the same address, breakpoints
+         * outside of its code are always dropped.
+         *
+         * @return The addresses of the dropped breakpoints
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_dropped_breakpoints() const noexcept -> std::span<const std::intptr_t> {
+            return _dropped_breakpoints;
+        }
+
+        /**
+         * This method returns the hardware breakpoints of the process, which are set in all threads.
+         *
+         * @return The hardware breakpoints by slot
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_hardware_breakpoints() const noexcept
+                -> const std::array<std::optional<HardwareBreakpoint>, HardwareBreakpoint::slot_count>& {
+            return _hardware_breakpoints;
+        }
+
         /**
          * This method returns a const reference to all registered threads in the process context
          *
@@ -252,6 +639,31 @@ namespace libdebug {
             return _threads;
         }
 
+        /**
+         * This method returns the threads of the forked children, which are kept traced while syscalls are traced or
+         * while they share the memory of the process. They only report their syscalls.
+         *
+         * @return The threads of the forked children
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_child_threads() const noexcept
+                -> const std::unordered_map<platform::TaskId, ThreadContext>& {
+            return _child_threads;
+        }
+
+        /**
+         * This method returns whether the specified task is a thread of the process or of a traced child.
+         *
+         * @param task_id The id of the task
+         * @return        Whether the task is traced by this process context
+         * @author        Cedric Hammes
+         * @since         16/10/2026
+         */
+        [[nodiscard]] inline auto owns_task(platform::TaskId task_id) const noexcept -> bool {
+            return _threads.contains(task_id) || _child_threads.contains(task_id);
+        }
+
         /**
          * This method returns the process id of the running process.
          *
@@ -262,5 +674,100 @@ namespace libdebug {
         [[nodiscard]] inline auto get_process_id() const noexcept -> platform::TaskId {
             return _process_id;
         }
+
+        /**
+         * This method returns the time it took to seize all threads of the process while attaching. It's zero for
+         * processes started by the debugger.
+         *
+         * @return The attach latency
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_attach_latency() const noexcept -> std::chrono::microseconds {
+            return _attach_latency;
+        }
+
+        /**
+         * This method returns the numbers of the syscalls, which are filtered in the kernel and traced by this
+         * context. It's empty when the syscalls of the process aren't traced.
+         *
+         * @return The numbers of the traced syscalls
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_traced_syscalls() const noexcept -> const std::vector<int>& {
+            return _traced_syscalls;
+        }
+
+        /**
+         * This method returns all tracepoints of the process with their hit counters.
+         *
+         * @return The tracepoints by address
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_tracepoints() const noexcept
+                -> const std::unordered_map<std::intptr_t, Tracepoint>& {
+            return _tracepoints;
+        }
+
+        /**
+         * This method returns the buffer of the records of all tracepoint hits.
+         *
+         * @return The trace buffer
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_trace_buffer() noexcept -> TraceBuffer& {
+            return _trace_buffer;
+        }
+
+        /**
+         * This method returns the count of threads of the process, which are running. Memory reads bypass the memory
+         * cache while any thread is running, because the running threads can modify the memory at any time.
+         *
+         * @return The count of running threads
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_running_thread_count() const noexcept -> std::size_t {
+            return _running_thread_count;
+        }
+
+        /**
+         * This function returns the symbol table of the executable of the process. The symbols are loaded when this
+         * function is called first, the addresses are relocated to the load address of the executable. The symbols
+         * are cached in the cache directory of the user.
+         *
+         * @return The symbol table or an error
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_symbols() noexcept -> kstd::Result<SymbolTable*>;
+
+        /**
+         * This function returns the line table of the executable of the process. The line table is loaded when this
+         * function is called first, the addresses are relocated like the addresses of the symbols. The index of the
+         * line table is cached in the cache directory of the user.
+         *
+         * @return The line table or an error
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_line_table() noexcept -> kstd::Result<LineTable*>;
+
+        /**
+         * This function returns the return addresses on the stack of the specified stopped thread. The frames are
+         * unwound with the call frame information of the mapped files and with the frame pointer, when no call frame
+         * information is available. The top of the stack is read at once, so most frames don't require a memory read.
+         *
+         * @param thread_id The id of the thread
+         * @param max_depth The maximal count of frames
+         * @return          The instruction pointer followed by the return addresses or an error
+         * @author          Cedric Hammes
+         * @since           16/10/2026
+         */
+        [[nodiscard]] auto get_backtrace(platform::TaskId thread_id, std::size_t max_depth = 64) noexcept
+                -> kstd::Result<std::vector<std::intptr_t>>;
     };
 }// namespace libdebug
\ No newline at end of file
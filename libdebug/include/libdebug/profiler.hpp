@@ -0,0 +1,145 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#pragma once
+#include "libdebug/process.hpp"
+#include <chrono>
+#include <cstdint>
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace libdebug {
+    /**
+     * This class is a statistical sampling profiler for a single process. Each sample interrupts all running threads,
+     * unwinds the stack of each thread and resumes the thread directly after it was sampled. The stacks are
+     * aggregated by their addresses and only symbolized when they are written.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class Profiler final {
+        struct StackHash final {
+            [[nodiscard]] auto operator()(const std::vector<std::intptr_t>& stack) const noexcept -> std::size_t;
+        };
+        using ModuleSymbols = std::unordered_map<std::string, std::optional<SymbolTable>>;
+
+        ProcessContext* _process_context;
+        std::size_t _max_depth;
+        std::unordered_map<std::vector<std::intptr_t>, std::size_t, StackHash> _stacks;
+        std::size_t _sample_count;
+        std::size_t _thread_sample_count;
+        std::chrono::nanoseconds _sample_time;
+
+        [[nodiscard]] auto sample_thread(ThreadContext& thread) noexcept -> kstd::Result<void>;
+        [[nodiscard]] auto format_frame(std::intptr_t address, const SymbolTable* symbols,
+                                        const MemoryMap* memory_map, ModuleSymbols& module_symbols) const noexcept
+                -> std::string;
+
+    public:
+        /**
+         * This constructor creates a profiler without samples for the specified process.
+         *
+         * @param process_context The process
+         * @param max_depth       The maximal count of frames of a stack
+         * @author                Cedric Hammes
+         * @since                 16/10/2026
+         */
+        explicit Profiler(ProcessContext& process_context, std::size_t max_depth = 128) noexcept;
+        ~Profiler() noexcept = default;
+        KSTD_DEFAULT_MOVE(Profiler, Profiler);
+        KSTD_NO_COPY(Profiler, Profiler);
+
+        /**
+         * This function takes a single sample of all threads of the process. Running threads are interrupted and
+         * resumed after they were sampled, stopped threads are sampled and stay stopped. Other signals arriving while
+         * waiting for the interrupts are delivered to their thread.
+         *
+         * @return Void or an error
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto sample() noexcept -> kstd::Result<void>;
+
+        /**
+         * This function samples the process at the specified interval until the specified duration is elapsed or the
+         * process exited.
+         *
+         * @param interval The time between the start of two samples
+         * @param duration The time to profile
+         * @return         Void or an error
+         * @author         Cedric Hammes
+         * @since          16/10/2026
+         */
+        [[nodiscard]] auto run(std::chrono::microseconds interval, std::chrono::milliseconds duration) noexcept
+                -> kstd::Result<void>;
+
+        /**
+         * This function writes the aggregated stacks in the folded format, with one line of semicolon-separated
+         * frames from the outermost to the innermost frame and the count of samples per stack. Frames are symbolized
+         * with the symbol table of their mapped file, frames without symbol are written as module and offset.
+         *
+         * @param stream The stream to write into
+         * @author       Cedric Hammes
+         * @since        16/10/2026
+         */
+        auto write_folded(std::ostream& stream) noexcept -> void;
+
+        /**
+         * This function returns the count of samples taken.
+         *
+         * @return The count of samples
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_sample_count() const noexcept -> std::size_t {
+            return _sample_count;
+        }
+
+        /**
+         * This function returns the count of different stacks seen in the samples.
+         *
+         * @return The count of stacks
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_stack_count() const noexcept -> std::size_t {
+            return _stacks.size();
+        }
+
+        /**
+         * This function returns the average time spent in the sampling per sampled thread, from the interrupt of the
+         * threads until the last thread was resumed.
+         *
+         * @return The average overhead per thread sample
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_sample_overhead() const noexcept -> std::chrono::nanoseconds {
+            if(_thread_sample_count == 0) {
+                return std::chrono::nanoseconds::zero();
+            }
+            return _sample_time / _thread_sample_count;
+        }
+    };
+}// namespace libdebug
\ No newline at end of file
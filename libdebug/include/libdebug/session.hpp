@@ -0,0 +1,125 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#pragma once
+#include "libdebug/platform/platform.hpp"
+#include "libdebug/process.hpp"
+#include <chrono>
+#include <kstd/defaults.hpp>
+#include <optional>
+#include <unordered_map>
+
+namespace libdebug {
+    /**
+     * This class is representing a debug session over multiple processes. All stop notifications of all processes
+     * are multiplexed through a single epoll loop and routed to the event callbacks of the owning process context, so
+     * the cost of a poll scales with the count of events and not with the count of processes. Besides SIGCHLD, the
+     * epoll loop watches a pidfd per process, so the exit of a process is noticed without the shared signal.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class DebugSession final {
+        platform::FileHandle _poll_handle;
+        platform::FileHandle _wake_handle;
+        std::unordered_map<platform::TaskId, ProcessContext> _processes;
+        std::unordered_map<platform::TaskId, platform::TaskId> _thread_owners;
+        std::unordered_map<platform::TaskId, platform::OwnedHandle> _process_handles;
+
+        auto find_owner(platform::TaskId thread_id) noexcept -> ProcessContext*;
+
+    public:
+        /**
+         * This constructor creates an empty debug session with its epoll instance.
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        DebugSession();
+        ~DebugSession() noexcept;
+        KSTD_NO_MOVE_COPY(DebugSession, DebugSession);
+
+        /**
+         * This function moves the specified process context into the session. All following stop notifications of
+         * the process are handled by this session.
+         *
+         * @param process_context The process context to add
+         * @return                A reference to the process context owned by the session
+         * @author                Cedric Hammes
+         * @since                 16/10/2026
+         */
+        auto add_process(ProcessContext&& process_context) noexcept -> ProcessContext&;
+
+        /**
+         * This function removes the process context of the specified process from the session and returns it to the
+         * caller.
+         *
+         * @param process_id The pid of the process
+         * @return           The process context or an error
+         * @author           Cedric Hammes
+         * @since            16/10/2026
+         */
+        [[nodiscard]] auto remove_process(platform::TaskId process_id) noexcept -> kstd::Result<ProcessContext>;
+
+        /**
+         * This function waits until at least one thread of any process in the session changes its state, the session
+         * is woken up or the timeout is elapsed. All available events are dispatched to the event callbacks of their
+         * process context as signal events, thread lifecycle events are dispatched by the process context itself and
+         * are not counted.
+         *
+         * @param timeout The maximum time to wait, or no value to wait infinitely
+         * @return        The count of dispatched events or an error
+         * @author        Cedric Hammes
+         * @since         16/10/2026
+         */
+        [[nodiscard]] auto poll_events(std::optional<std::chrono::milliseconds> timeout) noexcept
+                -> kstd::Result<std::size_t>;
+
+        /**
+         * This function wakes up a thread blocked in poll_events. This function can be called from any thread.
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        auto wake() const noexcept -> void;
+
+        /**
+         * This method returns a reference to all process contexts in the session, identified by their pid.
+         *
+         * @return All process contexts
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_processes() noexcept -> std::unordered_map<platform::TaskId, ProcessContext>& {
+            return _processes;
+        }
+
+        /**
+         * This method returns a const reference to all process contexts in the session, identified by their pid.
+         *
+         * @return All process contexts
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_processes() const noexcept
+                -> const std::unordered_map<platform::TaskId, ProcessContext>& {
+            return _processes;
+        }
+    };
+}// namespace libdebug
@@ -19,6 +19,7 @@
 
 #pragma once
 #include "libdebug/thread.hpp"
+#include <optional>
 
 #ifdef PLATFORM_WINDOWS
 #define WIN32_LEAN_AND_MEAN
@@ -37,11 +38,17 @@ namespace libdebug {
     class Signal final {
         ThreadContext* _thread_context;
         SignalInfo _signal_info;
+        std::optional<std::size_t> _hardware_breakpoint_slot;
+        std::optional<int> _exit_status;
 
     public:
-        explicit Signal(ThreadContext* thread_context, SignalInfo signal_info) noexcept ://NOLINT
+        explicit Signal(ThreadContext* thread_context, SignalInfo signal_info,
+                        std::optional<std::size_t> hardware_breakpoint_slot = {},
+                        std::optional<int> exit_status = {}) noexcept ://NOLINT
                 _thread_context {thread_context},
-                _signal_info {signal_info} {
+                _signal_info {signal_info},
+                _hardware_breakpoint_slot {hardware_breakpoint_slot},
+                _exit_status {exit_status} {
         }
 
         /**
@@ -55,6 +62,18 @@ namespace libdebug {
             return _thread_context;
         }
 
+        /**
+         * This method returns a pointer to the context of the signaled thread, which can be used to modify the
+         * registers of the thread before it's resumed.
+         *
+         * @return The context of the thread
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_thread() noexcept -> ThreadContext* {
+            return _thread_context;
+        }
+
         /**
          * This function returns the info of the signal
          *
@@ -66,6 +85,40 @@ namespace libdebug {
             return _signal_info;
         }
 
+        /**
+         * This function returns the slot of the hardware breakpoint, which raised this signal.
+         *
+         * @return The slot of the hardware breakpoint or no value
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_hardware_breakpoint_slot() const noexcept -> std::optional<std::size_t> {
+            return _hardware_breakpoint_slot;
+        }
+
+        /**
+         * This function checks whether the signal reports the exit of the thread instead of a signal. The signal info
+         * of an exit is empty.
+         *
+         * @return Whether the thread exited
+         * @author Cedric Hammes
+         * @since  17/10/2026
+         */
+        [[nodiscard]] inline auto is_exit() const noexcept -> bool {
+            return _exit_status.has_value();
+        }
+
+        /**
+         * This function returns the exit status of the thread, as reported by waitpid. It can be decoded with
+         * WIFEXITED, WEXITSTATUS, WIFSIGNALED and WTERMSIG.
+         *
+         * @return The exit status or no value when the thread didn't exit
+         * @author Cedric Hammes
+         * @since  17/10/2026
+         */
+        [[nodiscard]] inline auto get_exit_status() const noexcept -> std::optional<int> {
+            return _exit_status;
+        }
 
         /**
          * This function checks whether the signal is a breakpoint. If yes, the return type is true, otherwise the
@@ -76,5 +129,15 @@ namespace libdebug {
          * @since  09/03/2024
          */
         [[nodiscard]] auto is_breakpoint() const noexcept -> bool;
+
+        /**
+         * This function checks whether the signal is the stop of an interrupted thread. Seized threads report the
+         * stop of PTRACE_INTERRUPT, other threads are interrupted with SIGSTOP.
+         *
+         * @return Whether the signal is an interrupt
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto is_interrupt() const noexcept -> bool;
     };
 }// namespace libdebug
\ No newline at end of file
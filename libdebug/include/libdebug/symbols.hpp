@@ -0,0 +1,189 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#pragma once
+#include "libdebug/platform/platform.hpp"
+#include <cstdint>
+#include <filesystem>
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <kstd/types.hpp>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace libdebug {
+    /**
+     * This structure is describing a single function or object symbol of an executable. The name points into the
+     * mapped executable and is valid as long as the symbol table exists.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct Symbol final {
+        std::intptr_t address;
+        std::size_t size;
+        std::string_view name;
+        bool is_function;
+    };
+
+    /**
+     * This class is the symbol table of a single ELF executable. The executable is mapped into the memory and the
+     * symbols are kept in a compact array sorted by address, the names are not copied out of the mapping. The index
+     * over the names is built when the first symbol is looked up by name.
+     *
+     * When a cache directory is specified, the array, the name index and the names are stored in a cache file keyed
+     * by the build-id of the executable. Later symbol tables of the same executable map the cache file and use it
+     * in-place instead of reading the ELF symbol table.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class SymbolTable final {
+        static constexpr kstd::u32 empty_index = ~kstd::u32 {0};
+
+        struct Entry final {
+            std::intptr_t address;
+            kstd::u32 size : 31;
+            kstd::u32 is_function : 1;
+            kstd::u32 name_offset;
+        };
+
+        platform::FileMapping _mapping;
+        std::vector<Entry> _entry_storage;
+        std::vector<kstd::u32> _name_index_storage;
+        std::span<const Entry> _entries;
+        std::span<const kstd::u32> _name_index;
+        std::intptr_t _entry_address;
+        std::intptr_t _base_address;
+        std::intptr_t _load_bias;
+
+        [[nodiscard]] auto get_name(const Entry& entry) const noexcept -> std::string_view;
+        auto build_name_index() noexcept -> void;
+        [[nodiscard]] auto load_cache(const std::filesystem::path& path) noexcept -> bool;
+        [[nodiscard]] auto write_cache(const std::filesystem::path& path) const noexcept -> kstd::Result<void>;
+
+    public:
+        /**
+         * This constructor maps the specified ELF executable and reads the symbols from the .symtab section, or from
+         * the .dynsym section when the executable is stripped. When a cache directory is specified, the symbols are
+         * loaded from the cache file of the executable or the cache file is created.
+         *
+         * @param path            The path to the executable
+         * @param cache_directory The directory of the cache files or no value to disable the cache
+         * @author                Cedric Hammes
+         * @since                 16/10/2026
+         */
+        explicit SymbolTable(const std::filesystem::path& path,
+                             const std::optional<std::filesystem::path>& cache_directory = {});
+        ~SymbolTable() noexcept = default;
+        KSTD_DEFAULT_MOVE(SymbolTable, SymbolTable);
+        KSTD_NO_COPY(SymbolTable, SymbolTable);
+
+        /**
+         * This function returns the symbol containing the specified address in the process.
+         *
+         * @param address The address in the process
+         * @return        The symbol or no value, when no symbol contains the address
+         * @author        Cedric Hammes
+         * @since         16/10/2026
+         */
+        [[nodiscard]] auto find_symbol(std::intptr_t address) const noexcept -> std::optional<Symbol>;
+
+        /**
+         * This function returns the address of the symbol with the specified name in the process.
+         *
+         * @param name The name of the symbol
+         * @return     The address or no value, when no symbol has the name
+         * @author     Cedric Hammes
+         * @since      16/10/2026
+         */
+        [[nodiscard]] auto find_address(std::string_view name) noexcept -> std::optional<std::intptr_t>;
+
+        /**
+         * This function returns the symbol at the specified index in the process, the symbols are sorted by address.
+         *
+         * @param index The index of the symbol
+         * @return      The symbol
+         * @author      Cedric Hammes
+         * @since       16/10/2026
+         */
+        [[nodiscard]] auto get_symbol(std::size_t index) const noexcept -> Symbol;
+
+        /**
+         * This function sets the difference between the addresses in the process and the addresses in the
+         * executable, which is non-zero for position-independent executables.
+         *
+         * @param load_bias The load bias
+         * @author          Cedric Hammes
+         * @since           16/10/2026
+         */
+        inline auto set_load_bias(std::intptr_t load_bias) noexcept -> void {
+            _load_bias = load_bias;
+        }
+
+        /**
+         * This function returns the difference between the addresses in the process and the addresses in the
+         * executable.
+         *
+         * @return The load bias
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_load_bias() const noexcept -> std::intptr_t {
+            return _load_bias;
+        }
+
+        /**
+         * This function returns the entry point of the executable, without the load bias.
+         *
+         * @return The entry point
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_entry_address() const noexcept -> std::intptr_t {
+            return _entry_address;
+        }
+
+        /**
+         * This function returns the address of the first loadable segment of the executable, without the load bias.
+         * The first segment is mapped from the start of the file, so the load bias of a mapped file is the address of
+         * its first mapping minus this address.
+         *
+         * @return The base address
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_base_address() const noexcept -> std::intptr_t {
+            return _base_address;
+        }
+
+        /**
+         * This function returns the count of symbols in this table.
+         *
+         * @return The count of symbols
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto size() const noexcept -> std::size_t {
+            return _entries.size();
+        }
+    };
+}// namespace libdebug
\ No newline at end of file
@@ -18,9 +18,16 @@
  */
 
 #pragma once
+#include "libdebug/arch/registers.hpp"
+#include "libdebug/breakpoint.hpp"
 #include "libdebug/platform/platform.hpp"
+#include <array>
 #include <chrono>
+#include <cstdint>
 #include <kstd/defaults.hpp>
+#include <optional>
+#include <span>
+#include <vector>
 
 #ifdef PLATFORM_LINUX
 #include <sys/ptrace.h>
@@ -28,16 +35,68 @@
 #endif
 
 namespace libdebug {
+    /**
+     * This enum is representing the run state of a single thread, as last seen by the debugger. A thread is only
+     * stopped after its stop was reported by a wait.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    enum class ThreadState : kstd::u8 {
+        RUNNING = 0,
+        STOPPED = 1,
+        EXITED = 2
+    };
+
     class ThreadContext {
         platform::TaskId _process_id;
         platform::TaskId _thread_id;
+        std::optional<std::intptr_t> _breakpoint_address;
+        std::array<std::optional<HardwareBreakpoint>, HardwareBreakpoint::slot_count> _hardware_breakpoints;
+        bool _hardware_breakpoints_pending;
+        std::optional<arch::GeneralRegisters> _registers;
+        bool _registers_dirty;
+        std::vector<kstd::u8> _extended_state;
+        bool _extended_state_complete;
+        bool _extended_state_dirty;
+        bool _events_traced;
+        bool _is_starting;
+        bool _shares_memory;
+        ThreadState _state;
+        std::optional<kstd::u64> _syscall_number;
+        std::array<kstd::u64, arch::syscall_argument_count> _syscall_arguments;
+
+        friend class ProcessContext;
 
-        friend struct ProcessContext;
+        [[nodiscard]] auto write_debug_control() const noexcept -> kstd::Result<void>;
+        [[nodiscard]] auto fetch_registers() noexcept -> kstd::Result<arch::GeneralRegisters*>;
+        [[nodiscard]] auto flush_registers() noexcept -> kstd::Result<void>;
+        [[nodiscard]] auto fetch_extended_state(std::size_t size) noexcept -> kstd::Result<void>;
+#ifdef ARCH_X86_64
+        [[nodiscard]] auto read_extended_state(arch::ExtendedStateComponent component, std::size_t offset,
+                                               std::span<kstd::u8> data) noexcept -> kstd::Result<void>;
+        [[nodiscard]] auto write_extended_state(arch::ExtendedStateComponent component, std::size_t offset,
+                                                std::span<const kstd::u8> data) noexcept -> kstd::Result<void>;
+#endif
 
     public:
         ThreadContext(platform::TaskId process_id, platform::TaskId thread_id) noexcept ://NOLINT
                 _process_id {process_id},
-                _thread_id {thread_id} {
+                _thread_id {thread_id},
+                _breakpoint_address {},
+                _hardware_breakpoints {},
+                _hardware_breakpoints_pending {false},
+                _registers {},
+                _registers_dirty {false},
+                _extended_state {},
+                _extended_state_complete {false},
+                _extended_state_dirty {false},
+                _events_traced {false},
+                _is_starting {false},
+                _shares_memory {false},
+                _state {ThreadState::RUNNING},
+                _syscall_number {},
+                _syscall_arguments {} {
         }
 
         ~ThreadContext() noexcept = default;
@@ -79,5 +138,198 @@ namespace libdebug {
         [[nodiscard]] inline auto is_main_thread() const noexcept -> bool {
             return _process_id == _thread_id;
         }
+
+        /**
+         * This function returns the run state of this thread. Each thread is resumed, stepped and interrupted on its
+         * own, so other threads can keep running while this thread is stopped.
+         *
+         * @return The run state
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_state() const noexcept -> ThreadState {
+            return _state;
+        }
+
+        /**
+         * This function returns whether this thread is stopped, so its registers can be read and it can be resumed.
+         *
+         * @return Whether this thread is stopped
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto is_stopped() const noexcept -> bool {
+            return _state == ThreadState::STOPPED;
+        }
+
+        /**
+         * This function returns the address of the breakpoint, which stopped this thread. The breakpoint is stepped
+         * over when the thread is resumed.
+         *
+         * @return The breakpoint address or no value, when the thread isn't stopped at a breakpoint
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_breakpoint_address() const noexcept -> std::optional<std::intptr_t> {
+            return _breakpoint_address;
+        }
+
+        /**
+         * This function programs the specified hardware breakpoint into the debug registers of this thread. The
+         * previous breakpoint in the slot is replaced.
+         *
+         * @param slot       The index of the debug register
+         * @param breakpoint The hardware breakpoint
+         * @return           Void or an error
+         * @author           Cedric Hammes
+         * @since            16/10/2026
+         */
+        [[nodiscard]] auto set_hardware_breakpoint(std::size_t slot, const HardwareBreakpoint& breakpoint) noexcept
+                -> kstd::Result<void>;
+
+        /**
+         * This function disables the hardware breakpoint in the specified slot of this thread.
+         *
+         * @param slot The index of the debug register
+         * @return     Void or an error
+         * @author     Cedric Hammes
+         * @since      16/10/2026
+         */
+        [[nodiscard]] auto clear_hardware_breakpoint(std::size_t slot) noexcept -> kstd::Result<void>;
+
+        /**
+         * This function reads the debug status register of this thread and returns the slot of the hardware
+         * breakpoint, which stopped this thread. The register is kept, so the hit is still reported by the next wait.
+         *
+         * @return The slot, no value when no hardware breakpoint was hit or an error
+         * @author Cedric Hammes
+         * @since  17/10/2026
+         */
+        [[nodiscard]] auto get_hardware_breakpoint_hit() const noexcept -> kstd::Result<std::optional<std::size_t>>;
+
+        /**
+         * This function reads and resets the debug status register of this thread and returns the slot of the
+         * hardware breakpoint, which stopped this thread.
+         *
+         * @return The slot, no value when no hardware breakpoint was hit or an error
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto take_hardware_breakpoint_hit() noexcept -> kstd::Result<std::optional<std::size_t>>;
+
+        /**
+         * This method returns the hardware breakpoints programmed into the debug registers of this thread.
+         *
+         * @return The hardware breakpoints by slot
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_hardware_breakpoints() const noexcept
+                -> const std::array<std::optional<HardwareBreakpoint>, HardwareBreakpoint::slot_count>& {
+            return _hardware_breakpoints;
+        }
+
+        /**
+         * This function returns the general-purpose registers of this thread. The registers are read once per stop
+         * of the thread, later calls return the cached snapshot until the thread is resumed.
+         *
+         * @return The registers or an error
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_registers() noexcept -> kstd::Result<arch::GeneralRegisters>;
+
+        /**
+         * This function replaces the general-purpose registers of this thread. The registers are only written into
+         * the cached snapshot, all changes are written back to the thread at once when it's resumed.
+         *
+         * @param registers The new registers
+         * @author          Cedric Hammes
+         * @since           16/10/2026
+         */
+        auto set_registers(const arch::GeneralRegisters& registers) noexcept -> void;
+
+        /**
+         * This function returns the instruction pointer of this thread from the cached register snapshot.
+         *
+         * @return The instruction pointer or an error
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_instruction_pointer() noexcept -> kstd::Result<std::intptr_t>;
+
+        /**
+         * This function sets the instruction pointer of this thread in the cached register snapshot. The change is
+         * written back to the thread when it's resumed.
+         *
+         * @param address The new instruction pointer
+         * @return        Void or an error
+         * @author        Cedric Hammes
+         * @since         16/10/2026
+         */
+        [[nodiscard]] auto set_instruction_pointer(std::intptr_t address) noexcept -> kstd::Result<void>;
+
+        /**
+         * This function returns the stack pointer of this thread from the cached register snapshot.
+         *
+         * @return The stack pointer or an error
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_stack_pointer() noexcept -> kstd::Result<std::intptr_t>;
+
+        /**
+         * This function returns the bitmap of the extended state components, which are not in their initial state.
+         * Only the legacy region and the header of the XSAVE area are read for this.
+         *
+         * @return The state-component bitmap or an error
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] auto get_extended_state_components() noexcept -> kstd::Result<kstd::u64>;
+
+        /**
+         * This function returns the specified 80-bit x87 register of this thread.
+         *
+         * @param index The index of the register in the register stack
+         * @return      The value of the register or an error
+         * @author      Cedric Hammes
+         * @since       16/10/2026
+         */
+        [[nodiscard]] auto get_x87_register(std::size_t index) noexcept -> kstd::Result<std::array<kstd::u8, 10>>;
+
+        /**
+         * This function returns the specified vector register of this thread as a 512-bit value. The lower bytes
+         * are the XMM and YMM register, the state components of the wider parts are only read when they are in use.
+         *
+         * @param index The index of the register
+         * @return      The value of the register or an error
+         * @author      Cedric Hammes
+         * @since       16/10/2026
+         */
+        [[nodiscard]] auto get_vector_register(std::size_t index) noexcept -> kstd::Result<std::array<kstd::u8, 64>>;
+
+        /**
+         * This function sets the lower bytes of the specified vector register of this thread. The change is written
+         * back to the thread when it's resumed.
+         *
+         * @param index The index of the register
+         * @param value The new value with up to 64 bytes
+         * @return      Void or an error
+         * @author      Cedric Hammes
+         * @since       16/10/2026
+         */
+        [[nodiscard]] auto set_vector_register(std::size_t index, std::span<const kstd::u8> value) noexcept
+                -> kstd::Result<void>;
+
+        /**
+         * This function returns the specified AVX-512 opmask register of this thread.
+         *
+         * @param index The index of the register
+         * @return      The value of the register or an error
+         * @author      Cedric Hammes
+         * @since       16/10/2026
+         */
+        [[nodiscard]] auto get_mask_register(std::size_t index) noexcept -> kstd::Result<kstd::u64>;
     };
 }// namespace libdebug
\ No newline at end of file
@@ -0,0 +1,196 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#pragma once
+#include "libdebug/platform/platform.hpp"
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <kstd/defaults.hpp>
+#include <kstd/types.hpp>
+#include <span>
+#include <vector>
+
+namespace libdebug {
+    static constexpr std::size_t max_trace_registers = 4;
+
+    /**
+     * This enum is describing a register recorded by a tracepoint. The arguments and the return value are read with
+     * the calling convention of the architecture, so they are only meaningful at the entry or the return of a
+     * function.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    enum class TraceRegister : kstd::u8 {
+        ARGUMENT_0 = 0,
+        ARGUMENT_1 = 1,
+        ARGUMENT_2 = 2,
+        ARGUMENT_3 = 3,
+        ARGUMENT_4 = 4,
+        ARGUMENT_5 = 5,
+        RETURN_VALUE = 6,
+        INSTRUCTION_POINTER = 7,
+        STACK_POINTER = 8,
+        FRAME_POINTER = 9
+    };
+
+    /**
+     * This structure is a single hit of a tracepoint. The registers are stored in the order they were selected for
+     * the tracepoint, unselected registers are zero.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct TraceRecord final {
+        kstd::u64 timestamp;
+        std::intptr_t address;
+        platform::TaskId thread_id;
+        std::array<kstd::u64, max_trace_registers> registers;
+    };
+
+    /**
+     * This structure is describing a tracepoint, which is a breakpoint recording a trace record and resuming the
+     * thread instead of reporting a signal. With a hit budget, the breakpoint is disabled after the specified count
+     * of hits, a budget of zero never disables it. Tracepoints which aren't recorded only count their hits.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct Tracepoint final {
+        std::intptr_t address;
+        kstd::u64 hit_count;
+        kstd::u64 hit_budget;
+        std::array<TraceRegister, max_trace_registers> registers;
+        kstd::u8 register_count;
+        bool is_recorded;
+
+        [[nodiscard]] constexpr auto is_exhausted() const noexcept -> bool {
+            return hit_budget != 0 && hit_count >= hit_budget;
+        }
+    };
+
+    using TracepointCallback = std::function<void(const Tracepoint& tracepoint, void*)>;
+
+    /**
+     * This class is the buffer of the trace records of a process. The memory of all records is allocated up front,
+     * so recording a hit never allocates. Records arriving while the buffer is full are dropped and counted.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class TraceBuffer final {
+        std::vector<TraceRecord> _records;
+        std::size_t _capacity;
+        std::size_t _dropped_count;
+
+    public:
+        static constexpr std::size_t default_capacity = 65536;
+
+        /**
+         * This constructor creates an empty trace buffer with the specified capacity.
+         *
+         * @param capacity The maximal count of records
+         * @author         Cedric Hammes
+         * @since          16/10/2026
+         */
+        explicit TraceBuffer(std::size_t capacity = 0) noexcept;
+        ~TraceBuffer() noexcept = default;
+        KSTD_DEFAULT_MOVE(TraceBuffer, TraceBuffer);
+        KSTD_NO_COPY(TraceBuffer, TraceBuffer);
+
+        /**
+         * This function replaces the capacity of this buffer. All records are removed.
+         *
+         * @param capacity The maximal count of records
+         * @author         Cedric Hammes
+         * @since          16/10/2026
+         */
+        auto set_capacity(std::size_t capacity) noexcept -> void;
+
+        /**
+         * This function removes all records and resets the count of dropped records. The memory is kept.
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        auto clear() noexcept -> void;
+
+        /**
+         * This function appends the specified record, when the buffer isn't full.
+         *
+         * @param record The record
+         * @return       Whether the record was appended
+         * @author       Cedric Hammes
+         * @since        16/10/2026
+         */
+        inline auto push(const TraceRecord& record) noexcept -> bool {
+            if(_records.size() >= _capacity) {
+                ++_dropped_count;
+                return false;
+            }
+            _records.push_back(record);
+            return true;
+        }
+
+        /**
+         * This function returns the records in the order of their hits.
+         *
+         * @return The records
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_records() const noexcept -> std::span<const TraceRecord> {
+            return _records;
+        }
+
+        /**
+         * This function returns the maximal count of records.
+         *
+         * @return The capacity
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_capacity() const noexcept -> std::size_t {
+            return _capacity;
+        }
+
+        /**
+         * This function returns the count of records, which were dropped because the buffer was full.
+         *
+         * @return The count of dropped records
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto get_dropped_count() const noexcept -> std::size_t {
+            return _dropped_count;
+        }
+
+        /**
+         * This function returns the count of records in the buffer.
+         *
+         * @return The count of records
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto size() const noexcept -> std::size_t {
+            return _records.size();
+        }
+    };
+}// namespace libdebug
\ No newline at end of file
@@ -0,0 +1,199 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#pragma once
+#include "libdebug/platform/platform.hpp"
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <kstd/defaults.hpp>
+#include <kstd/result.hpp>
+#include <kstd/types.hpp>
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace libdebug {
+    /**
+     * The count of registers described by the call frame information. On x86_64 these are the general-purpose
+     * registers in DWARF order followed by the return address.
+     */
+    static constexpr std::size_t call_frame_register_count = 17;
+    static constexpr std::size_t call_frame_return_address = 16;
+    static constexpr std::size_t call_frame_stack_pointer = 7;
+    static constexpr std::size_t call_frame_frame_pointer = 6;
+
+    /**
+     * This enum is describing how the value of a register in the calling frame is recovered.
+     *
+     * SAME_VALUE: The register isn't modified by the frame
+     * UNDEFINED: The register can't be recovered, for the return address this marks the outermost frame
+     * OFFSET: The register is saved at the canonical frame address plus the value
+     * VALUE_OFFSET: The register is the canonical frame address plus the value
+     * REGISTER: The register is saved in the register with the number in the value
+     * UNSUPPORTED: The register is recovered by a DWARF expression
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    enum class CallFrameRuleType : kstd::u8 {
+        SAME_VALUE = 0,
+        UNDEFINED = 1,
+        OFFSET = 2,
+        VALUE_OFFSET = 3,
+        REGISTER = 4,
+        UNSUPPORTED = 5
+    };
+
+    /**
+     * This structure is describing how a single register of the calling frame is recovered.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct CallFrameRule final {
+        CallFrameRuleType type;
+        kstd::i64 value;
+    };
+
+    /**
+     * This structure is a single row of the call frame information, which is valid from its address until the
+     * address of the next row. The canonical frame address is the value of the CFA register plus the CFA offset.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct CallFrameRow final {
+        kstd::u64 address;
+        kstd::u64 cfa_register;
+        kstd::i64 cfa_offset;
+        bool is_cfa_supported;
+        std::array<CallFrameRule, call_frame_register_count> rules;
+    };
+
+    /**
+     * This class is the index over the call frame information in the .eh_frame section of a single ELF file. The
+     * FDEs are located with the binary search table in the .eh_frame_hdr section, or with an own sorted index when the
+     * file has no such table. The call frame instructions of an FDE are decoded into rows at the first lookup of the
+     * FDE and the rows are cached.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    class CallFrameTable final {
+        struct Section final {
+            std::size_t offset;
+            std::size_t size;
+            kstd::u64 address;
+        };
+
+        struct Segment final {
+            kstd::u64 offset;
+            kstd::u64 size;
+            kstd::u64 address;
+        };
+
+        struct IndexEntry final {
+            kstd::u64 address;
+            kstd::u64 fde_offset;
+        };
+
+        struct DecodedFde final {
+            kstd::u64 begin;
+            kstd::u64 end;
+            std::vector<CallFrameRow> rows;
+        };
+
+        platform::FileMapping _mapping;
+        Section _eh_frame;
+        Section _eh_frame_hdr;
+        std::vector<Segment> _segments;
+        std::vector<IndexEntry> _index;
+        std::unordered_map<kstd::u64, DecodedFde> _decoded_fdes;
+
+        [[nodiscard]] auto get_section_data(const Section& section) const noexcept -> std::span<const kstd::u8>;
+        [[nodiscard]] auto read_table_index() noexcept -> bool;
+        auto build_index() noexcept -> void;
+        [[nodiscard]] auto decode_fde(kstd::u64 fde_offset) noexcept -> kstd::Result<const DecodedFde*>;
+
+    public:
+        /**
+         * This constructor maps the specified ELF file and reads the index over the FDEs. No call frame instructions
+         * are decoded before the first lookup.
+         *
+         * @param path The path to the ELF file
+         * @author     Cedric Hammes
+         * @since      16/10/2026
+         */
+        explicit CallFrameTable(const std::filesystem::path& path);
+        ~CallFrameTable() noexcept = default;
+        KSTD_DEFAULT_MOVE(CallFrameTable, CallFrameTable);
+        KSTD_NO_COPY(CallFrameTable, CallFrameTable);
+
+        /**
+         * This function returns the row of the call frame information, which describes the frame of the
+         * instruction at the specified address in the file.
+         *
+         * @param address The address in the file
+         * @return        The row, nullptr when the address has no call frame information or an error
+         * @author        Cedric Hammes
+         * @since         16/10/2026
+         */
+        [[nodiscard]] auto find_row(kstd::u64 address) noexcept -> kstd::Result<const CallFrameRow*>;
+
+        /**
+         * This function returns the difference between the addresses in the process and the addresses in the file
+         * for the mapping of the file at the specified address and file offset.
+         *
+         * @param begin  The address of the mapping in the process
+         * @param offset The offset of the mapping in the file
+         * @return       The load bias or no value, when no segment of the file is at the offset
+         * @author       Cedric Hammes
+         * @since        16/10/2026
+         */
+        [[nodiscard]] auto get_load_bias(std::intptr_t begin, kstd::u64 offset) const noexcept
+                -> std::optional<std::intptr_t>;
+
+        /**
+         * This function returns the count of FDEs in the file.
+         *
+         * @return The count of FDEs
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        [[nodiscard]] inline auto size() const noexcept -> std::size_t {
+            return _index.size();
+        }
+    };
+
+    /**
+     * This structure is describing a single executable mapping in the process and the call frame information of the
+     * mapped file. Mappings without call frame information have no table and are unwound with the frame pointer.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct UnwindModule final {
+        std::intptr_t begin;
+        std::intptr_t end;
+        std::intptr_t load_bias;
+        CallFrameTable* table;
+    };
+}// namespace libdebug
\ No newline at end of file
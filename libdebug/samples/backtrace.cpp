@@ -0,0 +1,45 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+// The functions are compiled without frame pointer, so they can only be unwound with the call frame information
+#pragma GCC optimize("O2", "omit-frame-pointer")
+
+#include <cstdio>
+
+extern "C" {
+__attribute__((noipa)) auto backtrace_leaf(int value) noexcept -> int {
+    return value * 3 + 1;
+}
+
+__attribute__((noipa)) auto backtrace_middle(int value) noexcept -> int {
+    volatile int buffer[32] {};
+    buffer[value % 32] = backtrace_leaf(value);
+    return buffer[value % 32] + 1;
+}
+
+__attribute__((noipa)) auto backtrace_outer(int value) noexcept -> int {
+    return backtrace_middle(value + 1) * 2;
+}
+}
+
+auto main() noexcept -> int {
+    auto result = 0;
+    for(auto index = 0;; ++index) {
+        result += backtrace_outer(index);
+        if(result == 42) {
+            printf("%i\n", result);
+        }
+    }
+    return 0;
+}
\ No newline at end of file
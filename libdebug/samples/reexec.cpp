@@ -0,0 +1,39 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#ifndef PLATFORM_WINDOWS
+#include <unistd.h>
+#endif
+
+extern "C" [[gnu::noinline]] auto first_call() noexcept -> void {
+    asm volatile("");
+}
+
+extern "C" [[gnu::noinline]] auto second_call() noexcept -> void {
+    asm volatile("");
+}
+
+auto main(int argc, char** argv) noexcept -> int {
+#ifndef PLATFORM_WINDOWS
+    // The first run executes the sample again, only the second run calls the functions
+    if(argc < 2) {
+        ::execl("/proc/self/exe", argv[0], "again", nullptr);
+    }
+#endif
+
+    first_call();
+    second_call();
+    while(true) {}
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#ifndef PLATFORM_WINDOWS
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+extern "C" [[gnu::noinline]] auto hot() noexcept -> void {
+    asm volatile("");
+}
+
+auto main() noexcept -> int {
+    hot();
+
+#ifndef PLATFORM_WINDOWS
+    // Start a child process with vfork and one with fork
+    char true_path[] = "/bin/true";
+    char* const arguments[] = {true_path, nullptr};
+    pid_t child_process_id = 0;
+    if(::posix_spawn(&child_process_id, true_path, nullptr, nullptr, arguments, nullptr) == 0) {
+        ::waitpid(child_process_id, nullptr, 0);
+    }
+    hot();
+
+    child_process_id = ::fork();
+    if(child_process_id == 0) {
+        hot();
+        ::_exit(0);
+    }
+    ::waitpid(child_process_id, nullptr, 0);
+#endif
+
+    hot();
+    while(true) {}
+    return 0;
+}
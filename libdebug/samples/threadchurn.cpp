@@ -0,0 +1,40 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include <thread>
+
+#ifndef PLATFORM_WINDOWS
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+auto main() noexcept -> int {
+    // Start and join a few short-lived threads
+    for(auto i = 0; i < 4; ++i) {
+        auto thread = std::thread {[] {}};
+        thread.join();
+    }
+
+#ifndef PLATFORM_WINDOWS
+    // Start a short-lived child process
+    const auto child_process_id = ::fork();
+    if(child_process_id == 0) {
+        ::_exit(0);
+    }
+    ::waitpid(child_process_id, nullptr, 0);
+#endif
+
+    while(true) {}
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,318 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#ifdef ARCH_X86_64
+#include "libdebug/arch/instruction.hpp"
+#include <cstring>
+#include <limits>
+
+namespace libdebug::arch {
+    /**
+     * This function decodes the length and the layout of the first instruction in the specified code. Only the
+     * fields required to move the instruction are decoded, the operands are not interpreted.
+     *
+     * @param code The code starting with the instruction
+     * @return     The decoded instruction or an error
+     * @author     Cedric Hammes
+     * @since      16/10/2026
+     */
+    auto decode_instruction(std::span<const kstd::u8> code) noexcept -> kstd::Result<Instruction> {
+        using namespace std::string_literals;
+        Instruction instruction {};
+        std::size_t offset = 0;
+        const auto next_byte = [&](kstd::u8& byte) {
+            if(offset >= code.size() || offset >= max_instruction_size) {
+                return false;
+            }
+            byte = code[offset++];
+            return true;
+        };
+
+        // Skip legacy prefixes and REX prefix
+        kstd::u8 byte = 0;
+        auto operand_size_prefix = false;
+        auto rex_w = false;
+        while(true) {
+            if(!next_byte(byte)) {
+                return kstd::Error {"Unable to decode instruction: Instruction is truncated"s};
+            }
+
+            if(byte == 0x66) {
+                operand_size_prefix = true;
+            }
+            else if((byte & 0xF0) == 0x40) {
+                rex_w = (byte & 0x08) != 0;
+            }
+            else if(byte != 0x67 && byte != 0xF0 && byte != 0xF2 && byte != 0xF3 && byte != 0x26 && byte != 0x2E &&
+                    byte != 0x36 && byte != 0x3E && byte != 0x64 && byte != 0x65) {
+                break;
+            }
+
+            // The REX prefix is only valid directly before the opcode
+            if((byte & 0xF0) != 0x40) {
+                rex_w = false;
+            }
+        }
+
+        // Decode opcode with the VEX and EVEX prefixes, which are always followed by a ModRM byte
+        auto has_modrm = false;
+        std::size_t immediate_size = 0;
+        if(byte == 0xC4 || byte == 0xC5 || byte == 0x62) {
+            kstd::u8 payload = 0;
+            if(!next_byte(payload)) {
+                return kstd::Error {"Unable to decode instruction: Instruction is truncated"s};
+            }
+
+            instruction.opcode_map = byte == 0xC5 ? 1 : payload & (byte == 0x62 ? 0x07 : 0x1F);
+            for(auto i = byte == 0xC5 ? 0 : (byte == 0xC4 ? 1 : 2); i > 0; --i) {
+                if(!next_byte(payload)) {
+                    return kstd::Error {"Unable to decode instruction: Instruction is truncated"s};
+                }
+            }
+
+            instruction.opcode_offset = offset;
+            if(!next_byte(instruction.opcode)) {
+                return kstd::Error {"Unable to decode instruction: Instruction is truncated"s};
+            }
+
+            const auto opcode = instruction.opcode;
+            has_modrm = !(byte != 0x62 && instruction.opcode_map == 1 && opcode == 0x77);
+            if(instruction.opcode_map == 3 || (instruction.opcode_map == 1 && ((opcode >= 0x70 && opcode <= 0x73) ||
+                                                                               opcode == 0xC2 ||
+                                                                               (opcode >= 0xC4 && opcode <= 0xC6)))) {
+                immediate_size = 1;
+            }
+        }
+        else if(byte == 0x0F) {
+            instruction.opcode_offset = offset - 1;
+            if(!next_byte(byte)) {
+                return kstd::Error {"Unable to decode instruction: Instruction is truncated"s};
+            }
+
+            instruction.opcode_map = 1;
+            if(byte == 0x38 || byte == 0x3A) {
+                instruction.opcode_map = byte == 0x38 ? 2 : 3;
+                if(!next_byte(byte)) {
+                    return kstd::Error {"Unable to decode instruction: Instruction is truncated"s};
+                }
+                has_modrm = true;
+                immediate_size = instruction.opcode_map == 3 ? 1 : 0;
+            }
+            else if(byte >= 0x80 && byte <= 0x8F) {
+                instruction.relative_size = 4;
+            }
+            else {
+                has_modrm = !(byte == 0x05 || byte == 0x06 || byte == 0x07 || byte == 0x08 || byte == 0x09 ||
+                              byte == 0x0B || byte == 0x0E || (byte >= 0x30 && byte <= 0x37) || byte == 0x77 ||
+                              byte == 0xA0 || byte == 0xA1 || byte == 0xA2 || byte == 0xA8 || byte == 0xA9 ||
+                              byte == 0xAA || (byte >= 0xC8 && byte <= 0xCF));
+                if((byte >= 0x70 && byte <= 0x73) || byte == 0x0F || byte == 0xA4 || byte == 0xAC || byte == 0xBA ||
+                   byte == 0xC2 || (byte >= 0xC4 && byte <= 0xC6)) {
+                    immediate_size = 1;
+                }
+            }
+            instruction.opcode = byte;
+        }
+        else {
+            instruction.opcode_offset = offset - 1;
+            instruction.opcode = byte;
+            const auto full_immediate_size = operand_size_prefix ? 2 : 4;
+            if(byte < 0x40 && (byte & 0x07) < 0x06) {
+                // Arithmetic instructions (add, or, adc, sbb, and, sub, xor, cmp)
+                has_modrm = (byte & 0x04) == 0;
+                immediate_size = (byte & 0x07) == 0x04 ? 1 : ((byte & 0x07) == 0x05 ? full_immediate_size : 0);
+            }
+            else if(byte < 0x40 || byte == 0x9A || byte == 0xEA || byte == 0xCE || byte == 0x82 ||
+                    (byte >= 0x60 && byte <= 0x62) || (byte >= 0xD4 && byte <= 0xD6)) {
+                return kstd::Error {
+                        fmt::format("Unable to decode instruction: Opcode {:#04x} is invalid in 64-bit mode", byte)};
+            }
+            else if((byte >= 0x70 && byte <= 0x7F) || (byte >= 0xE0 && byte <= 0xE3) || byte == 0xEB) {
+                instruction.relative_size = 1;
+            }
+            else if(byte == 0xE8 || byte == 0xE9) {
+                instruction.relative_size = 4;
+            }
+            else if(byte >= 0xA0 && byte <= 0xA3) {
+                immediate_size = 8;
+            }
+            else if(byte >= 0xB8 && byte <= 0xBF) {
+                immediate_size = rex_w ? 8 : full_immediate_size;
+            }
+            else {
+                has_modrm = byte == 0x63 || byte == 0x69 || byte == 0x6B || (byte >= 0x80 && byte <= 0x8F) ||
+                            byte == 0xC0 || byte == 0xC1 || byte == 0xC6 || byte == 0xC7 ||
+                            (byte >= 0xD0 && byte <= 0xD3) || (byte >= 0xD8 && byte <= 0xDF) || byte >= 0xF6;
+                has_modrm = has_modrm && !(byte >= 0xF8 && byte <= 0xFD);
+                if(byte == 0x6A || byte == 0x6B || byte == 0x80 || byte == 0x83 || byte == 0xA8 ||
+                   (byte >= 0xB0 && byte <= 0xB7) || byte == 0xC0 || byte == 0xC1 || byte == 0xC6 || byte == 0xCD ||
+                   (byte >= 0xE4 && byte <= 0xE7)) {
+                    immediate_size = 1;
+                }
+                else if(byte == 0x68 || byte == 0x69 || byte == 0x81 || byte == 0xA9 || byte == 0xC7) {
+                    immediate_size = full_immediate_size;
+                }
+                else if(byte == 0xC2 || byte == 0xCA) {
+                    immediate_size = 2;
+                }
+                else if(byte == 0xC8) {
+                    immediate_size = 3;
+                }
+            }
+        }
+
+        // Decode ModRM, SIB and displacement
+        if(has_modrm) {
+            instruction.modrm_offset = offset;
+            kstd::u8 modrm = 0;
+            if(!next_byte(modrm)) {
+                return kstd::Error {"Unable to decode instruction: Instruction is truncated"s};
+            }
+
+            const auto mod = modrm >> 6;
+            const auto reg = (modrm >> 3) & 0x07;
+            const auto rm = modrm & 0x07;
+            std::size_t displacement_size = mod == 1 ? 1 : (mod == 2 ? 4 : 0);
+            if(mod != 3 && rm == 4) {
+                kstd::u8 sib = 0;
+                if(!next_byte(sib)) {
+                    return kstd::Error {"Unable to decode instruction: Instruction is truncated"s};
+                }
+
+                if(mod == 0 && (sib & 0x07) == 5) {
+                    displacement_size = 4;
+                }
+            }
+            else if(mod == 0 && rm == 5) {
+                instruction.displacement_offset = offset;
+                displacement_size = 4;
+            }
+            offset += displacement_size;
+
+            // The test instruction of the unary group has an immediate operand
+            if(instruction.opcode_map == 0 && reg <= 1 && (instruction.opcode == 0xF6 || instruction.opcode == 0xF7)) {
+                immediate_size = instruction.opcode == 0xF6 ? 1 : (operand_size_prefix ? 2 : 4);
+            }
+        }
+
+        if(instruction.relative_size != 0) {
+            instruction.relative_offset = offset;
+        }
+        offset += immediate_size + instruction.relative_size;
+        if(offset > max_instruction_size) {
+            return kstd::Error {"Unable to decode instruction: Instruction is too long"s};
+        }
+
+        if(offset > code.size()) {
+            return kstd::Error {"Unable to decode instruction: Instruction is truncated"s};
+        }
+        instruction.size = offset;
+        return instruction;
+    }
+
+    /**
+     * This function rewrites the first instruction in the specified code, so executing it at the target address has
+     * the same effect as executing it at the source address. RIP-relative operands and relative branch targets are
+     * adjusted to the new location.
+     *
+     * @param code The code starting with the instruction
+     * @param from The original address of the instruction
+     * @param to   The address the instruction is executed at
+     * @return     The relocated instruction or an error, when the instruction can't be moved
+     * @author     Cedric Hammes
+     * @since      16/10/2026
+     */
+    auto relocate_instruction(std::span<const kstd::u8> code, std::intptr_t from, std::intptr_t to) noexcept
+            -> kstd::Result<RelocatedInstruction> {
+        using namespace std::string_literals;
+        const auto decoded_instruction = decode_instruction(code);
+        if(decoded_instruction.is_error()) {
+            return kstd::Error {decoded_instruction.get_error()};
+        }
+
+        const auto& instruction = decoded_instruction.get();
+        RelocatedInstruction relocated {};
+        relocated.original_size = instruction.size;
+        relocated.size = instruction.size;
+        std::memcpy(relocated.code.data(), code.data(), instruction.size);
+
+        const auto opcode = instruction.opcode;
+        const auto modrm_reg = instruction.modrm_offset != 0 ? (code[instruction.modrm_offset] >> 3) & 0x07 : 0;
+        relocated.is_call = instruction.opcode_map == 0 && (opcode == 0xE8 || (opcode == 0xFF && modrm_reg == 2));
+        if(instruction.opcode_map == 0 && opcode == 0xFF && modrm_reg == 3) {
+            return kstd::Error {"Unable to relocate instruction: Far calls are not supported"s};
+        }
+
+        // Adjust a 32-bit displacement, which is relative to the end of the instruction
+        const auto adjust_displacement = [&](std::size_t displacement_offset) -> bool {
+            std::int32_t displacement = 0;
+            std::memcpy(&displacement, relocated.code.data() + displacement_offset, sizeof(displacement));
+            const auto target = from + static_cast<std::intptr_t>(instruction.size) + displacement;
+            const auto new_displacement = target - (to + static_cast<std::intptr_t>(relocated.size));
+            if(new_displacement < std::numeric_limits<std::int32_t>::min() ||
+               new_displacement > std::numeric_limits<std::int32_t>::max()) {
+                return false;
+            }
+
+            displacement = static_cast<std::int32_t>(new_displacement);
+            std::memcpy(relocated.code.data() + displacement_offset, &displacement, sizeof(displacement));
+            return true;
+        };
+
+        if(instruction.displacement_offset != 0 && !adjust_displacement(instruction.displacement_offset)) {
+            return kstd::Error {"Unable to relocate instruction: RIP-relative operand is out of range"s};
+        }
+
+        if(instruction.relative_size == 0) {
+            return relocated;
+        }
+
+        // Widen short branches to their 32-bit form, loop and jrcxz have no such form
+        if(instruction.relative_size == 1) {
+            if(opcode >= 0xE0 && opcode <= 0xE3) {
+                return kstd::Error {"Unable to relocate instruction: Loop instructions are not supported"s};
+            }
+
+            const auto displacement =
+                    static_cast<std::int32_t>(static_cast<std::int8_t>(code[instruction.relative_offset]));
+            auto position = instruction.opcode_offset;
+            if(opcode == 0xEB) {
+                relocated.code[position++] = 0xE9;
+            }
+            else {
+                relocated.code[position++] = 0x0F;
+                relocated.code[position++] = 0x80 | (opcode & 0x0F);
+            }
+            std::memcpy(relocated.code.data() + position, &displacement, sizeof(displacement));
+            relocated.size = position + sizeof(displacement);
+
+            // The displacement is adjusted relative to the end of the original instruction
+            if(!adjust_displacement(position)) {
+                return kstd::Error {"Unable to relocate instruction: Branch target is out of range"s};
+            }
+            return relocated;
+        }
+
+        if(!adjust_displacement(instruction.relative_offset)) {
+            return kstd::Error {"Unable to relocate instruction: Branch target is out of range"s};
+        }
+        return relocated;
+    }
+}// namespace libdebug::arch
+#endif
\ No newline at end of file
@@ -0,0 +1,75 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#ifdef ARCH_X86_64
+#include "libdebug/arch/registers.hpp"
+#include <array>
+#include <cpuid.h>
+
+namespace libdebug::arch {
+    static constexpr unsigned int extended_state_leaf = 0xD;
+
+    /**
+     * This function returns the location of the specified state component in the XSAVE area. The locations of the
+     * extended components are enumerated by the CPU.
+     *
+     * @param component The state component
+     * @return          The location of the component
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    auto get_extended_state_layout(ExtendedStateComponent component) noexcept -> ExtendedStateLayout {
+        // The legacy region has a fixed layout, so only the extended components are enumerated
+        static const auto layouts = [] {
+            std::array<ExtendedStateLayout, 8> layouts {};
+            layouts[static_cast<std::size_t>(ExtendedStateComponent::X87)] = {0, 160};
+            layouts[static_cast<std::size_t>(ExtendedStateComponent::SSE)] = {160, 256};
+            for(unsigned int index = 2; index < layouts.size(); ++index) {
+                unsigned int size = 0;
+                unsigned int offset = 0;
+                unsigned int flags = 0;
+                unsigned int reserved = 0;
+                if(__get_cpuid_count(extended_state_leaf, index, &size, &offset, &flags, &reserved) != 0) {
+                    layouts[index] = {offset, size};
+                }
+            }
+            return layouts;
+        }();
+        return layouts[static_cast<std::size_t>(component)];
+    }
+
+    /**
+     * This function returns the size of the XSAVE area with all state components supported by the CPU.
+     *
+     * @return The size of the XSAVE area
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto get_max_extended_state_size() noexcept -> std::size_t {
+        unsigned int enabled_size = 0;
+        unsigned int features = 0;
+        unsigned int max_size = 0;
+        unsigned int reserved = 0;
+        if(__get_cpuid_count(extended_state_leaf, 0, &features, &enabled_size, &max_size, &reserved) == 0) {
+            return extended_state_header_offset + extended_state_header_size;
+        }
+        return max_size;
+    }
+}// namespace libdebug::arch
+#endif
\ No newline at end of file
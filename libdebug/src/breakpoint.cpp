@@ -0,0 +1,297 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#include "libdebug/breakpoint.hpp"
+#include "libdebug/process.hpp"
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+namespace libdebug {
+    /**
+     * This constructor constructs an empty breakpoint with a reference to the context and the target address of the
+     * breakpoint.
+     *
+     * @author Cedric Hammes
+     * @since  09/03/2024
+     */
+    Breakpoint::Breakpoint(std::intptr_t target_address) noexcept ://NOLINT
+            _address {target_address},
+            _enabled {false},
+            _saved_data {} {
+    }
+
+    /**
+     * This function enables the breakpoint by replacing the instruction at the specified address and saving the
+     * original data in this class. All threads share the address space, so the memory is patched once for the
+     * whole process. Enabling an enabled breakpoint does nothing, so the saved data is never overwritten with the
+     * interrupt instruction.
+     *
+     * @param process_context The context of the process owning the breakpoint
+     * @return                Void or an error
+     * @author                Cedric Hammes
+     * @since                 09/03/2024
+     */
+    auto Breakpoint::enable(ProcessContext& process_context) noexcept -> kstd::Result<void> {
+        if(_enabled) {
+            return {};
+        }
+
+        // Read the data at the specified address and save instruction data
+        kstd::u8 data = 0;
+        if(const auto result = process_context.read_memory(_address, {&data, 1}); result.is_error()) {
+            return kstd::Error {fmt::format("Unable to enable breakpoint: {}", result.get_error())};
+        }
+
+        // Replace instruction at address with interrupt instruction
+        const auto instruction = interrupt_instruction;
+        if(const auto result = process_context.write_memory(_address, {&instruction, 1}); result.is_error()) {
+            return kstd::Error {fmt::format("Unable to enable breakpoint: {}", result.get_error())};
+        }
+
+        // Set breakpoint enabled
+        _saved_data = data;
+        _enabled = true;
+        return {};
+    }
+
+    /**
+     * This function disables the breakpoint by replacing the inserted instruction at the specified address with the
+     * original data saved. Disabling a disabled breakpoint does nothing.
+     *
+     * @param process_context The context of the process owning the breakpoint
+     * @return                Void or an error
+     * @author                Cedric Hammes
+     * @since                 09/03/2024
+     */
+    auto Breakpoint::disable(ProcessContext& process_context) noexcept -> kstd::Result<void> {
+        if(!_enabled) {
+            return {};
+        }
+
+        // Remove interrupt instruction and insert restored data
+        if(const auto result = process_context.write_memory(_address, {&_saved_data, 1}); result.is_error()) {
+            return kstd::Error {fmt::format("Unable to disable breakpoint: {}", result.get_error())};
+        }
+
+        // Set breakpoint disabled
+        _enabled = false;
+        return {};
+    }
+
+    /**
+     * This constructor constructs an empty breakpoint table. The slots are allocated with the first breakpoint.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    BreakpointTable::BreakpointTable() noexcept ://NOLINT
+            _addresses {},
+            _breakpoints {},
+            _size {0} {
+    }
+
+    /**
+     * This function returns the first slot of the probe sequence of the specified address. The address is spread
+     * with Fibonacci hashing, so breakpoints at neighboring instructions don't cluster.
+     *
+     * @param address The address of the breakpoint
+     * @return        The first slot of the probe sequence
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto BreakpointTable::get_home_slot(std::intptr_t address) const noexcept -> std::size_t {
+        const auto shift = 64 - std::countr_zero(_addresses.size());
+        return static_cast<std::size_t>((static_cast<kstd::u64>(address) * 0x9E3779B97F4A7C15ULL) >> shift);
+    }
+
+    /**
+     * This function returns the slot of the specified address or the size of the table when the address is not in
+     * the table.
+     *
+     * @param address The address of the breakpoint
+     * @return        The slot of the address
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto BreakpointTable::find_slot(std::intptr_t address) const noexcept -> std::size_t {
+        const auto capacity = _addresses.size();
+        if(capacity == 0) {
+            return capacity;
+        }
+
+        const auto mask = capacity - 1;
+        for(auto slot = get_home_slot(address);; slot = (slot + 1) & mask) {
+            const auto slot_address = _addresses[slot];
+            if(slot_address == address) {
+                return slot;
+            }
+
+            if(slot_address == empty_address) {
+                return capacity;
+            }
+        }
+    }
+
+    /**
+     * This function doubles the capacity of the table and re-inserts all breakpoints. The load factor is kept under
+     * 50%, so probe sequences stay short.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto BreakpointTable::grow() noexcept -> void {
+        auto old_addresses = std::move(_addresses);
+        auto old_breakpoints = std::move(_breakpoints);
+        const auto capacity = old_addresses.empty() ? 16 : old_addresses.size() * 2;
+        _addresses.assign(capacity, empty_address);
+        _breakpoints.assign(capacity, Breakpoint {empty_address});
+
+        const auto mask = capacity - 1;
+        for(std::size_t i = 0; i < old_addresses.size(); ++i) {
+            if(old_addresses[i] == empty_address) {
+                continue;
+            }
+
+            auto slot = get_home_slot(old_addresses[i]);
+            while(_addresses[slot] != empty_address) {
+                slot = (slot + 1) & mask;
+            }
+            _addresses[slot] = old_addresses[i];
+            _breakpoints[slot] = old_breakpoints[i];
+        }
+    }
+
+    /**
+     * This function returns the breakpoint at the specified address or a null pointer when no breakpoint is set at
+     * the address. This is the lookup of the trap hot path.
+     *
+     * @param address The address of the breakpoint
+     * @return        The breakpoint or nullptr
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto BreakpointTable::find(std::intptr_t address) noexcept -> Breakpoint* {
+        const auto slot = find_slot(address);
+        return slot == _addresses.size() ? nullptr : &_breakpoints[slot];
+    }
+
+    /**
+     * This function returns the breakpoint at the specified address or a null pointer when no breakpoint is set at
+     * the address. This is the lookup of the trap hot path.
+     *
+     * @param address The address of the breakpoint
+     * @return        The breakpoint or nullptr
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto BreakpointTable::find(std::intptr_t address) const noexcept -> const Breakpoint* {
+        const auto slot = find_slot(address);
+        return slot == _addresses.size() ? nullptr : &_breakpoints[slot];
+    }
+
+    /**
+     * This function returns the breakpoint at the specified address and throws an std::out_of_range exception
+     * when no breakpoint is set at the address.
+     *
+     * @param address The address of the breakpoint
+     * @return        The breakpoint
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto BreakpointTable::at(std::intptr_t address) const -> const Breakpoint& {
+        const auto* breakpoint = find(address);
+        if(breakpoint == nullptr) {
+            throw std::out_of_range {fmt::format("No breakpoint is set at {:#x}", address)};
+        }
+        return *breakpoint;
+    }
+
+    /**
+     * This function inserts the specified breakpoint, when no breakpoint is set at the address of it.
+     *
+     * @param breakpoint The breakpoint to insert
+     * @return           Whether the breakpoint was inserted
+     * @author           Cedric Hammes
+     * @since            16/10/2026
+     */
+    auto BreakpointTable::insert(const Breakpoint& breakpoint) noexcept -> bool {
+        const auto address = breakpoint.get_address();
+        if(address == empty_address || contains(address)) {
+            return false;
+        }
+
+        if((_size + 1) * 2 > _addresses.size()) {
+            grow();
+        }
+
+        const auto mask = _addresses.size() - 1;
+        auto slot = get_home_slot(address);
+        while(_addresses[slot] != empty_address) {
+            slot = (slot + 1) & mask;
+        }
+        _addresses[slot] = address;
+        _breakpoints[slot] = breakpoint;
+        ++_size;
+        return true;
+    }
+
+    /**
+     * This function removes the breakpoint at the specified address. The following entries of the probe sequence
+     * are shifted back, so no tombstones are slowing down later lookups.
+     *
+     * @param address The address of the breakpoint
+     * @return        Whether a breakpoint was removed
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto BreakpointTable::erase(std::intptr_t address) noexcept -> bool {
+        auto slot = find_slot(address);
+        if(slot == _addresses.size()) {
+            return false;
+        }
+
+        // Move every following entry, which can't be found from its home slot anymore, into the hole
+        const auto mask = _addresses.size() - 1;
+        for(auto next_slot = (slot + 1) & mask; _addresses[next_slot] != empty_address;
+            next_slot = (next_slot + 1) & mask) {
+            const auto home_slot = get_home_slot(_addresses[next_slot]);
+            if(((next_slot - home_slot) & mask) >= ((next_slot - slot) & mask)) {
+                _addresses[slot] = _addresses[next_slot];
+                _breakpoints[slot] = _breakpoints[next_slot];
+                slot = next_slot;
+            }
+        }
+
+        _addresses[slot] = empty_address;
+        --_size;
+        return true;
+    }
+
+    /**
+     * This function removes all breakpoints from the table.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto BreakpointTable::clear() noexcept -> void {
+        std::fill(_addresses.begin(), _addresses.end(), empty_address);
+        _size = 0;
+    }
+}// namespace libdebug
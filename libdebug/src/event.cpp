@@ -0,0 +1,290 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#include "libdebug/event.hpp"
+#include <algorithm>
+#include <bit>
+
+namespace libdebug {
+    /**
+     * This constructor creates an empty event queue. The capacity is rounded up to the next power of two.
+     *
+     * @param capacity The minimal count of events in the queue
+     * @param policy   The policy for events pushed into the full queue
+     * @author         Cedric Hammes
+     * @since          16/10/2026
+     */
+    EventQueue::EventQueue(std::size_t capacity, BackpressurePolicy policy) noexcept ://NOLINT
+            _slots(std::bit_ceil(std::max<std::size_t>(capacity, 1))),
+            _mask {_slots.size() - 1},
+            _policy {policy},
+            _head {0},
+            _tail {0},
+            _free_slots {static_cast<std::ptrdiff_t>(_slots.size())},
+            _used_slots {0},
+            _held_mutex {},
+            _held_events {},
+            _held_count {0},
+            _dropped_count {0},
+            _coalesced_count {0} {
+    }
+
+    /**
+     * This function writes the specified event into the next slot and publishes it to the consumer. The slot must be
+     * acquired before and the consumer is notified by the caller.
+     *
+     * @param event The event
+     * @author      Cedric Hammes
+     * @since       16/10/2026
+     */
+    auto EventQueue::write_slot(const ProcessEvent& event) noexcept -> void {
+        const auto tail = _tail.load(std::memory_order_relaxed);
+        _slots[tail & _mask] = event;
+        _tail.store(tail + 1, std::memory_order_release);
+    }
+
+    /**
+     * This function returns the thread of the specified event, which identifies the events replacing each other with
+     * the coalesce policy. Events creating a process are identified by the child, so they never replace each other.
+     *
+     * @param event The event
+     * @return      The id of the thread
+     * @author      Cedric Hammes
+     * @since       17/10/2026
+     */
+    static auto get_coalesce_thread_id(const ProcessEvent& event) noexcept -> platform::TaskId {
+        switch(event.event_type) {
+            case ProcessEventType::CREATE_THREAD: return event.create_thread_event.thread_id;
+            case ProcessEventType::DELETE_THREAD: return event.delete_thread_event.thread_id;
+            case ProcessEventType::SIGNAL: return event.signal_event.thread_id;
+            case ProcessEventType::CREATE_PROCESS: return event.create_process_event.child_process_id;
+            case ProcessEventType::SYSCALL_ENTER:
+            case ProcessEventType::SYSCALL_EXIT: return event.syscall_event.thread_id;
+        }
+        return 0;
+    }
+
+    /**
+     * This function pushes the specified event into the queue. This function is only called by the producer.
+     *
+     * @param event The event
+     * @return      Whether the event was queued, false when the event was dropped or held back
+     * @author      Cedric Hammes
+     * @since       16/10/2026
+     */
+    auto EventQueue::push(const ProcessEvent& event) noexcept -> bool {
+        switch(_policy) {
+            case BackpressurePolicy::BLOCK: {
+                _free_slots.acquire();
+                break;
+            }
+            case BackpressurePolicy::DROP: {
+                if(!_free_slots.try_acquire()) {
+                    _dropped_count.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+                break;
+            }
+            case BackpressurePolicy::COALESCE: {
+                // The held back events are queued first, so the order of the events is kept
+                if(_held_count.load(std::memory_order_acquire) > 0) {
+                    const std::lock_guard lock {_held_mutex};
+                    flush_held_events();
+                    if(!_held_events.empty()) {
+                        hold_event(event);
+                        return false;
+                    }
+                }
+
+                if(!_free_slots.try_acquire()) {
+                    const std::lock_guard lock {_held_mutex};
+                    hold_event(event);
+                    return false;
+                }
+                break;
+            }
+        }
+
+        write_slot(event);
+        _used_slots.release();
+        return true;
+    }
+
+    /**
+     * This function holds back the specified event of the coalesce policy. A held back event of the same type and
+     * thread is replaced, other held back events are kept. The held mutex must be locked.
+     *
+     * @param event The event
+     * @author      Cedric Hammes
+     * @since       17/10/2026
+     */
+    auto EventQueue::hold_event(const ProcessEvent& event) noexcept -> void {
+        const auto thread_id = get_coalesce_thread_id(event);
+        const auto held_event = std::find_if(_held_events.begin(), _held_events.end(), [&](const auto& other_event) {
+            return other_event.event_type == event.event_type && get_coalesce_thread_id(other_event) == thread_id;
+        });
+
+        // The replaced event is removed, so the newer event keeps its order to the other held back events
+        if(held_event != _held_events.end()) {
+            _held_events.erase(held_event);
+            _held_events.push_back(event);
+            _coalesced_count.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        // Held back events are taken by the consumer, when the queue got empty
+        _held_events.push_back(event);
+        _held_count.fetch_add(1, std::memory_order_release);
+        _used_slots.release();
+    }
+
+    /**
+     * This function queues the held back events of the coalesce policy, as long as space is available. The held
+     * mutex must be locked.
+     *
+     * @author Cedric Hammes
+     * @since  17/10/2026
+     */
+    auto EventQueue::flush_held_events() noexcept -> void {
+        while(!_held_events.empty() && _free_slots.try_acquire()) {
+            // The consumer was already notified about the event when it was held back
+            write_slot(_held_events.front());
+            _held_events.pop_front();
+            _held_count.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    /**
+     * This function queues the held back events of the coalesce policy, as long as space is available. This function
+     * is only called by the producer.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto EventQueue::flush() noexcept -> void {
+        if(_held_count.load(std::memory_order_acquire) == 0) {
+            return;
+        }
+
+        const std::lock_guard lock {_held_mutex};
+        flush_held_events();
+    }
+
+    /**
+     * This function takes the oldest event out of the queue and waits for an event, when the queue is empty. The held
+     * back events of the coalesce policy are taken once the queue got empty. This function is only called by the
+     * consumer.
+     *
+     * @param event The event to write into
+     * @return      Whether an event was taken, false when the queue is closed and empty
+     * @author      Cedric Hammes
+     * @since       16/10/2026
+     */
+    auto EventQueue::pop(ProcessEvent& event) noexcept -> bool {
+        // The queue is only empty after the wait, when it was closed or an event is held back
+        _used_slots.acquire();
+        if(read_slot(event)) {
+            return true;
+        }
+
+        // Held back events are newer than all queued events, so they are taken after the queue got empty. The
+        // producer queues them under the lock, so the queue is read again after locking. The taken token only
+        // belongs to no event, when the queue was closed.
+        const std::lock_guard lock {_held_mutex};
+        if(read_slot(event)) {
+            return true;
+        }
+
+        if(!_held_events.empty()) {
+            event = _held_events.front();
+            _held_events.pop_front();
+            _held_count.fetch_sub(1, std::memory_order_release);
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * This function takes the oldest event out of the ring buffer, when one is queued. This function is only called by
+     * the consumer.
+     *
+     * @param event The event to write into
+     * @return      Whether an event was taken
+     * @author      Cedric Hammes
+     * @since       17/10/2026
+     */
+    auto EventQueue::read_slot(ProcessEvent& event) noexcept -> bool {
+        const auto head = _head.load(std::memory_order_relaxed);
+        if(head == _tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        event = _slots[head & _mask];
+        _head.store(head + 1, std::memory_order_release);
+        _free_slots.release();
+        return true;
+    }
+
+    /**
+     * This function closes the queue, so the consumer stops waiting after the last event. The held back events are
+     * taken by the consumer before. This function is only called by the producer.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto EventQueue::close() noexcept -> void {
+        _used_slots.release();
+    }
+
+    /**
+     * This constructor creates the event queue and starts the consumer thread.
+     *
+     * @param callbacks The callbacks executed for each event
+     * @param capacity  The minimal count of events in the queue
+     * @param policy    The policy for events pushed into the full queue
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    EventDispatcher::EventDispatcher(std::vector<std::pair<const EventCallback, void*>> callbacks,//NOLINT
+                                     std::size_t capacity, BackpressurePolicy policy) noexcept :
+            _callbacks {std::move(callbacks)},
+            _queue {capacity, policy},
+            _consumer_thread {} {
+        _consumer_thread = std::thread {[this]() {
+            ProcessEvent event {};
+            while(_queue.pop(event)) {
+                for(const auto& [callback, data] : _callbacks) {
+                    callback(event, data);
+                }
+            }
+        }};
+    }
+
+    /**
+     * This destructor closes the event queue and waits until the consumer thread executed the callbacks for all
+     * queued events.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    EventDispatcher::~EventDispatcher() noexcept {
+        _queue.close();
+        _consumer_thread.join();
+    }
+}// namespace libdebug
\ No newline at end of file
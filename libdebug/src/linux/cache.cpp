@@ -0,0 +1,147 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#ifdef PLATFORM_LINUX
+#include "libdebug/cache.hpp"
+#include "libdebug/platform/platform.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <elf.h>
+#include <fstream>
+#include <unistd.h>
+
+namespace libdebug {
+    /**
+     * This function returns the GNU build-id of the specified ELF executable as a hexadecimal string. The build-id
+     * identifies the content of the executable, so it is used as the key of the cache files.
+     *
+     * @param executable The data of the executable
+     * @return           The build-id or no value, when the executable has no build-id
+     * @author           Cedric Hammes
+     * @since            16/10/2026
+     */
+    auto read_build_id(std::span<const kstd::u8> executable) noexcept -> std::optional<std::string> {
+        Elf64_Ehdr header {};
+        if(executable.size() < sizeof(header)) {
+            return {};
+        }
+        std::memcpy(&header, executable.data(), sizeof(header));
+        if(std::memcmp(header.e_ident, ELFMAG, SELFMAG) != 0 || header.e_ident[EI_CLASS] != ELFCLASS64 ||
+           header.e_shentsize != sizeof(Elf64_Shdr) || header.e_shoff > executable.size() ||
+           (executable.size() - header.e_shoff) / sizeof(Elf64_Shdr) < header.e_shnum) {
+            return {};
+        }
+
+        // The build-id is a note with the GNU name in one of the note sections
+        for(std::size_t index = 0; index < header.e_shnum; ++index) {
+            Elf64_Shdr section {};
+            std::memcpy(&section, executable.data() + header.e_shoff + index * sizeof(section), sizeof(section));
+            if(section.sh_type != SHT_NOTE || section.sh_offset > executable.size() ||
+               executable.size() - section.sh_offset < section.sh_size) {
+                continue;
+            }
+
+            const auto notes = executable.subspan(section.sh_offset, section.sh_size);
+            std::size_t offset = 0;
+            while(notes.size() - offset >= sizeof(Elf64_Nhdr)) {
+                Elf64_Nhdr note {};
+                std::memcpy(&note, notes.data() + offset, sizeof(note));
+                const auto name_offset = offset + sizeof(note);
+                const auto description_offset = name_offset + ((note.n_namesz + 3) & ~3U);
+                const auto next_offset = description_offset + ((note.n_descsz + 3) & ~3U);
+                if(next_offset > notes.size()) {
+                    break;
+                }
+
+                if(note.n_type == NT_GNU_BUILD_ID && note.n_namesz == 4 &&
+                   std::memcmp(notes.data() + name_offset, ELF_NOTE_GNU, 4) == 0 && note.n_descsz != 0) {
+                    std::string build_id {};
+                    for(const auto byte : notes.subspan(description_offset, note.n_descsz)) {
+                        build_id += fmt::format("{:02x}", byte);
+                    }
+                    return build_id;
+                }
+                offset = next_offset;
+            }
+        }
+        return {};
+    }
+
+    /**
+     * This function returns the default directory of the cache files, which is the libdebug directory in the cache
+     * directory of the user.
+     *
+     * @return The cache directory or no value, when the user has no cache directory
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto get_cache_directory() noexcept -> std::optional<std::filesystem::path> {
+        if(const auto* cache_home = ::getenv("XDG_CACHE_HOME"); cache_home != nullptr && *cache_home == '/') {
+            return std::filesystem::path {cache_home} / "libdebug";
+        }
+
+        if(const auto* home = ::getenv("HOME"); home != nullptr && *home == '/') {
+            return std::filesystem::path {home} / ".cache" / "libdebug";
+        }
+        return {};
+    }
+
+    /**
+     * This function writes the specified parts into the cache file at the specified path. The file is written into a
+     * temporary file first and renamed afterward, so readers never map a partially written cache file.
+     *
+     * @param path  The path of the cache file
+     * @param parts The parts of the content of the file
+     * @return      Void or an error
+     * @author      Cedric Hammes
+     * @since       16/10/2026
+     */
+    auto write_cache_file(const std::filesystem::path& path, std::span<const std::span<const kstd::u8>> parts) noexcept
+            -> kstd::Result<void> {
+        std::error_code error {};
+        std::filesystem::create_directories(path.parent_path(), error);
+        if(error) {
+            return kstd::Error {fmt::format("Unable to write cache {}: {}", path.string(), error.message())};
+        }
+
+        // The temporary file is unique per process, so concurrent debuggers don't write into the same file
+        auto temporary_path = path;
+        temporary_path += fmt::format(".{}.tmp", ::getpid());
+        {
+            std::ofstream stream {temporary_path, std::ios::binary | std::ios::trunc};
+            for(const auto part : parts) {
+                stream.write(reinterpret_cast<const char*>(part.data()), static_cast<std::streamsize>(part.size()));
+            }
+
+            if(!stream.flush()) {
+                std::filesystem::remove(temporary_path, error);
+                return kstd::Error {
+                        fmt::format("Unable to write cache {}: {}", path.string(), platform::get_last_error())};
+            }
+        }
+
+        std::filesystem::rename(temporary_path, path, error);
+        if(error) {
+            std::filesystem::remove(temporary_path, error);
+            return kstd::Error {fmt::format("Unable to write cache {}: {}", path.string(), error.message())};
+        }
+        return {};
+    }
+}// namespace libdebug
+#endif
\ No newline at end of file
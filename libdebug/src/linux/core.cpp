@@ -0,0 +1,472 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#ifdef PLATFORM_LINUX
+#include "libdebug/process.hpp"
+#include <algorithm>
+#include <cstring>
+#include <elf.h>
+#include <fcntl.h>
+#include <fstream>
+#include <future>
+#include <iterator>
+#include <sys/procfs.h>
+#include <system_error>
+#include <unistd.h>
+
+namespace libdebug {
+    namespace {
+        constexpr std::size_t core_page_size = 4096;
+        constexpr std::size_t core_chunk_size = 8 * 1024 * 1024;
+
+        /**
+         * This structure is a part of a chunk of memory, which is written at the specified offset of the core file.
+         *
+         * @author Cedric Hammes
+         * @since  16/10/2026
+         */
+        struct CoreChunkPart final {
+            kstd::u64 file_offset;
+            std::span<const kstd::u8> data;
+        };
+
+        /**
+         * This function returns the bytes of the specified structure.
+         *
+         * @param value The structure
+         * @return      The bytes of the structure
+         * @author      Cedric Hammes
+         * @since       16/10/2026
+         */
+        template<typename T>
+        auto as_bytes(const T& value) noexcept -> std::span<const kstd::u8> {
+            return {reinterpret_cast<const kstd::u8*>(&value), sizeof(T)};
+        }
+
+        /**
+         * This function rounds the specified value up to the specified power of two.
+         *
+         * @param value     The value
+         * @param alignment The alignment
+         * @return          The aligned value
+         * @author          Cedric Hammes
+         * @since           16/10/2026
+         */
+        constexpr auto align_up(std::size_t value, std::size_t alignment) noexcept -> std::size_t {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        /**
+         * This function appends an ELF note with the specified name, type and description. The name and the
+         * description are padded to four bytes.
+         *
+         * @param notes       The notes to append to
+         * @param name        The name of the owner of the note
+         * @param type        The type of the note
+         * @param description The content of the note
+         * @author            Cedric Hammes
+         * @since             16/10/2026
+         */
+        auto append_note(std::vector<kstd::u8>& notes, std::string_view name, kstd::u32 type,
+                         std::span<const kstd::u8> description) noexcept -> void {
+            const Elf64_Nhdr header {static_cast<Elf64_Word>(name.size() + 1),
+                                     static_cast<Elf64_Word>(description.size()), type};
+            const auto header_bytes = as_bytes(header);
+            notes.insert(notes.end(), header_bytes.begin(), header_bytes.end());
+            notes.insert(notes.end(), name.begin(), name.end());
+            notes.resize(align_up(notes.size() + 1, 4), 0);
+            notes.insert(notes.end(), description.begin(), description.end());
+            notes.resize(align_up(notes.size(), 4), 0);
+        }
+
+        /**
+         * This function returns whether all bytes of the specified data are zero.
+         *
+         * @param data The data
+         * @return     Whether the data is zero
+         * @author     Cedric Hammes
+         * @since      16/10/2026
+         */
+        auto is_zero(std::span<const kstd::u8> data) noexcept -> bool {
+            return data.empty() || (data[0] == 0 && std::memcmp(data.data(), data.data() + 1, data.size() - 1) == 0);
+        }
+
+        /**
+         * This function writes the specified data at the specified offset of the specified file.
+         *
+         * @param handle The handle of the file
+         * @param data   The data to write
+         * @param offset The offset in the file
+         * @return       Void or an error
+         * @author       Cedric Hammes
+         * @since        16/10/2026
+         */
+        auto write_file(platform::FileHandle handle, std::span<const kstd::u8> data, kstd::u64 offset) noexcept
+                -> kstd::Result<void> {
+            while(!data.empty()) {
+                const auto result = ::pwrite(handle, data.data(), data.size(), static_cast<off_t>(offset));
+                if(result < 0) {
+                    if(errno == EINTR) {
+                        continue;
+                    }
+                    return kstd::Error {fmt::format("Unable to write core file: {}", platform::get_last_error())};
+                }
+
+                data = data.subspan(static_cast<std::size_t>(result));
+                offset += static_cast<kstd::u64>(result);
+            }
+            return {};
+        }
+
+        /**
+         * This function writes the specified parts into the specified file. All-zero pages are skipped, so they stay
+         * holes in the file and don't occupy any disk space. The other pages are written in runs.
+         *
+         * @param handle The handle of the file
+         * @param parts  The parts of a chunk
+         * @return       Void or an error
+         * @author       Cedric Hammes
+         * @since        16/10/2026
+         */
+        auto write_sparse(platform::FileHandle handle, std::span<const CoreChunkPart> parts) noexcept
+                -> kstd::Result<void> {
+            for(const auto& part : parts) {
+                const auto get_page = [&](std::size_t offset) {
+                    return part.data.subspan(offset, std::min(core_page_size, part.data.size() - offset));
+                };
+
+                std::size_t offset = 0;
+                while(offset < part.data.size()) {
+                    if(is_zero(get_page(offset))) {
+                        offset += core_page_size;
+                        continue;
+                    }
+
+                    auto run_end = offset;
+                    while(run_end < part.data.size() && !is_zero(get_page(run_end))) {
+                        run_end += core_page_size;
+                    }
+                    run_end = std::min(run_end, part.data.size());
+
+                    const auto data = part.data.subspan(offset, run_end - offset);
+                    if(const auto result = write_file(handle, data, part.file_offset + offset); result.is_error()) {
+                        return result;
+                    }
+                    offset = run_end;
+                }
+            }
+            return {};
+        }
+    }// namespace
+
+    /**
+     * This function appends the notes of the registers of the specified stopped thread. The floating-point registers
+     * are the legacy region of the XSAVE area, so both notes are taken from a single read of the extended state.
+     *
+     * @param thread The stopped thread
+     * @param notes  The notes to append to
+     * @return       Void or an error
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    auto ProcessContext::append_thread_notes(ThreadContext& thread, std::vector<kstd::u8>& notes) noexcept
+            -> kstd::Result<void> {
+        const auto registers = thread.get_registers();
+        if(registers.is_error()) {
+            return kstd::Error {fmt::format("Unable to write core file: {}", registers.get_error())};
+        }
+
+        static_assert(sizeof(elf_gregset_t) == sizeof(arch::GeneralRegisters));
+        elf_prstatus status {};
+        status.pr_pid = thread.get_thread_id();
+        status.pr_ppid = _process_id;
+        status.pr_fpvalid = 1;
+        std::memcpy(&status.pr_reg, &registers.get(), sizeof(status.pr_reg));
+        append_note(notes, "CORE", NT_PRSTATUS, as_bytes(status));
+
+#ifdef ARCH_X86_64
+        if(thread.fetch_extended_state(arch::get_max_extended_state_size()).is_ok() &&
+           thread._extended_state.size() >= sizeof(user_fpregs_struct)) {
+            const std::span<const kstd::u8> extended_state {thread._extended_state};
+            append_note(notes, "CORE", NT_FPREGSET, extended_state.first(sizeof(user_fpregs_struct)));
+            append_note(notes, "LINUX", NT_X86_XSTATE, extended_state);
+            return {};
+        }
+
+        // Processors without XSAVE only have the legacy floating-point registers
+        user_fpregs_struct floating_point_registers {};
+        if(::ptrace(PTRACE_GETFPREGS, thread.get_thread_id(), nullptr, &floating_point_registers) < 0) {
+            return kstd::Error {fmt::format("Unable to write core file: Unable to read FPU of {}: {}",
+                                            thread.get_thread_id(), platform::get_last_error())};
+        }
+        append_note(notes, "CORE", NT_FPREGSET, as_bytes(floating_point_registers));
+#endif
+        return {};
+    }
+
+    /**
+     * This function writes an ELF core file of the stopped process, which can be loaded by debuggers like GDB.
+     * Every thread gets its general-purpose, floating-point and extended registers as notes, every mapping of
+     * the process becomes a loadable segment. The memory is read in large chunks while the previous chunk is
+     * written, all-zero pages are left as holes in the sparse file. Breakpoints are replaced with the original
+     * code in the file.
+     *
+     * @param path The path of the core file
+     * @return     Void or an error
+     * @author     Cedric Hammes
+     * @since      16/10/2026
+     */
+    auto ProcessContext::write_core_file(const std::filesystem::path& path) noexcept -> kstd::Result<void> {
+        // Running threads would change the memory and the registers while they are written
+        for(const auto& [thread_id, thread] : _threads) {
+            if(!thread.is_stopped()) {
+                return kstd::Error {fmt::format("Unable to write core file: Thread {} is running", thread_id)};
+            }
+        }
+
+        const auto memory_map = get_memory_map();
+        if(memory_map.is_error()) {
+            return kstd::Error {fmt::format("Unable to write core file: {}", memory_map.get_error())};
+        }
+
+        // The process notes describe the command, the auxiliary vector and the mapped files
+        std::vector<kstd::u8> notes {};
+        elf_prpsinfo process_info {};
+        process_info.pr_sname = 't';
+        process_info.pr_pid = _process_id;
+        std::ifstream command_name_stream {fmt::format("/proc/{}/comm", _process_id)};
+        std::string command_name {};
+        std::getline(command_name_stream, command_name);
+        std::strncpy(process_info.pr_fname, command_name.c_str(), sizeof(process_info.pr_fname) - 1);
+        std::ifstream command_line_stream {fmt::format("/proc/{}/cmdline", _process_id), std::ios::binary};
+        std::string command_line {std::istreambuf_iterator<char> {command_line_stream}, {}};
+        std::replace(command_line.begin(), command_line.end(), '\0', ' ');
+        std::strncpy(process_info.pr_psargs, command_line.c_str(), sizeof(process_info.pr_psargs) - 1);
+        append_note(notes, "CORE", NT_PRPSINFO, as_bytes(process_info));
+
+        std::ifstream auxv_stream {fmt::format("/proc/{}/auxv", _process_id), std::ios::binary};
+        const std::vector<kstd::u8> auxv {std::istreambuf_iterator<char> {auxv_stream}, {}};
+        append_note(notes, "CORE", NT_AUXV, auxv);
+
+        std::vector<kstd::u64> file_entries {0, core_page_size};
+        std::string file_names {};
+        for(std::size_t index = 0; index < memory_map.get()->size(); ++index) {
+            const auto region = memory_map.get()->get_region(index);
+            if(region.path.starts_with('/')) {
+                file_entries.insert(file_entries.end(), {static_cast<kstd::u64>(region.begin),
+                                                         static_cast<kstd::u64>(region.end),
+                                                         region.offset / core_page_size});
+                file_names.append(region.path).push_back('\0');
+                ++file_entries[0];
+            }
+        }
+        std::vector<kstd::u8> files {};
+        files.resize(file_entries.size() * sizeof(kstd::u64));
+        std::memcpy(files.data(), file_entries.data(), files.size());
+        files.insert(files.end(), file_names.begin(), file_names.end());
+        append_note(notes, "CORE", NT_FILE, files);
+
+        // GDB selects the thread of the first status note, so the main thread comes first
+        std::vector<platform::TaskId> thread_ids {};
+        for(const auto& [thread_id, _] : _threads) {
+            thread_ids.push_back(thread_id);
+        }
+        std::sort(thread_ids.begin(), thread_ids.end(), [this](auto left, auto right) {
+            return std::pair {left != _process_id, left} < std::pair {right != _process_id, right};
+        });
+        for(const auto thread_id : thread_ids) {
+            if(const auto result = append_thread_notes(_threads.at(thread_id), notes); result.is_error()) {
+                return result;
+            }
+        }
+
+        // Every mapping is a segment, mappings without read permission have no content in the file. Files with more
+        // segments than fit into the header store the count in the first section header.
+        const auto segment_count = memory_map.get()->size() + 1;
+        const auto has_extended_numbering = segment_count >= PN_XNUM;
+        const auto section_header_offset = sizeof(Elf64_Ehdr) + segment_count * sizeof(Elf64_Phdr);
+        const auto notes_offset = section_header_offset + (has_extended_numbering ? sizeof(Elf64_Shdr) : 0);
+        auto file_offset = align_up(notes_offset + notes.size(), core_page_size);
+
+        std::vector<Elf64_Phdr> segments {};
+        segments.reserve(segment_count);
+        segments.push_back({PT_NOTE, 0, notes_offset, 0, 0, notes.size(), 0, 4});
+        for(std::size_t index = 0; index < memory_map.get()->size(); ++index) {
+            const auto region = memory_map.get()->get_region(index);
+            const auto size = static_cast<kstd::u64>(region.end - region.begin);
+            const auto file_size = region.has_permission(MemoryPermission::READ) ? size : 0;
+            Elf64_Word flags = 0;
+            flags |= region.has_permission(MemoryPermission::READ) ? PF_R : 0;
+            flags |= region.has_permission(MemoryPermission::WRITE) ? PF_W : 0;
+            flags |= region.has_permission(MemoryPermission::EXECUTE) ? PF_X : 0;
+            segments.push_back({PT_LOAD, flags, file_offset, static_cast<Elf64_Addr>(region.begin), 0, file_size, size,
+                                core_page_size});
+            file_offset += file_size;
+        }
+
+        Elf64_Ehdr header {};
+        std::memcpy(header.e_ident, ELFMAG, SELFMAG);
+        header.e_ident[EI_CLASS] = ELFCLASS64;
+        header.e_ident[EI_DATA] = ELFDATA2LSB;
+        header.e_ident[EI_VERSION] = EV_CURRENT;
+        header.e_ident[EI_OSABI] = ELFOSABI_NONE;
+        header.e_type = ET_CORE;
+#if defined(ARCH_X86_64)
+        header.e_machine = EM_X86_64;
+#elif defined(ARCH_ARM64)
+        header.e_machine = EM_AARCH64;
+#endif
+        header.e_version = EV_CURRENT;
+        header.e_phoff = sizeof(Elf64_Ehdr);
+        header.e_ehsize = sizeof(Elf64_Ehdr);
+        header.e_phentsize = sizeof(Elf64_Phdr);
+        header.e_phnum = has_extended_numbering ? PN_XNUM : static_cast<Elf64_Half>(segment_count);
+        if(has_extended_numbering) {
+            header.e_shoff = section_header_offset;
+            header.e_shentsize = sizeof(Elf64_Shdr);
+            header.e_shnum = 1;
+        }
+
+        std::vector<kstd::u8> headers {};
+        headers.reserve(notes_offset + notes.size());
+        const auto header_bytes = as_bytes(header);
+        headers.insert(headers.end(), header_bytes.begin(), header_bytes.end());
+        headers.resize(sizeof(Elf64_Ehdr) + segments.size() * sizeof(Elf64_Phdr));
+        std::memcpy(headers.data() + sizeof(Elf64_Ehdr), segments.data(), segments.size() * sizeof(Elf64_Phdr));
+        if(has_extended_numbering) {
+            Elf64_Shdr section_header {};
+            section_header.sh_size = 1;
+            section_header.sh_info = static_cast<Elf64_Word>(segment_count);
+            const auto section_header_bytes = as_bytes(section_header);
+            headers.insert(headers.end(), section_header_bytes.begin(), section_header_bytes.end());
+        }
+        headers.insert(headers.end(), notes.begin(), notes.end());
+
+        platform::OwnedHandle file {::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600)};
+        if(!file.is_valid()) {
+            return kstd::Error {fmt::format("Unable to write core file {}: {}", path.string(),
+                                            platform::get_last_error())};
+        }
+
+        if(const auto result = write_file(file.get(), headers, 0); result.is_error()) {
+            return result;
+        }
+
+        // The original code of the breakpoints is restored in the chunks
+        std::vector<std::pair<std::intptr_t, kstd::u8>> saved_code {};
+        for(const auto& breakpoint : _breakpoints) {
+            if(breakpoint.is_enabled()) {
+                saved_code.emplace_back(breakpoint.get_address(), breakpoint._saved_data);
+            }
+        }
+        std::sort(saved_code.begin(), saved_code.end());
+
+        // The memory is streamed through two buffers, one chunk is read while the previous chunk is written
+        std::array<std::vector<kstd::u8>, 2> buffers {std::vector<kstd::u8>(core_chunk_size),
+                                                      std::vector<kstd::u8>(core_chunk_size)};
+        std::size_t buffer_index = 0;
+        std::size_t buffer_size = 0;
+        std::vector<MemoryReadRequest> requests {};
+        std::vector<CoreChunkPart> parts {};
+        std::future<kstd::Result<void>> pending_write {};
+        const auto flush_chunk = [&]() -> kstd::Result<void> {
+            // Mappings which can't be read (like [vvar]) are left as holes
+            if(read_memory_uncached(requests).is_error()) {
+                for(const auto& request : requests) {
+                    if(read_memory_uncached({&request, 1}).is_error()) {
+                        std::fill(request.buffer.begin(), request.buffer.end(), 0);
+                    }
+                }
+            }
+
+            for(const auto& request : requests) {
+                const auto end_address = request.address + static_cast<std::intptr_t>(request.buffer.size());
+                auto code = std::lower_bound(saved_code.cbegin(), saved_code.cend(),
+                                             std::pair {request.address, kstd::u8 {0}});
+                for(; code != saved_code.cend() && code->first < end_address; ++code) {
+                    request.buffer[static_cast<std::size_t>(code->first - request.address)] = code->second;
+                }
+            }
+
+            if(pending_write.valid()) {
+                if(const auto result = pending_write.get(); result.is_error()) {
+                    return result;
+                }
+            }
+
+            try {
+                pending_write = std::async(std::launch::async,
+                                           [handle = file.get(), chunk_parts = std::move(parts)]() {
+                                               return write_sparse(handle, chunk_parts);
+                                           });
+            }
+            catch(const std::system_error& error) {
+                return kstd::Error {fmt::format("Unable to write core file: {}", error.what())};
+            }
+
+            parts.clear();
+            requests.clear();
+            buffer_index ^= 1;
+            buffer_size = 0;
+            return {};
+        };
+
+        for(const auto& segment : segments) {
+            auto address = static_cast<std::intptr_t>(segment.p_vaddr);
+            auto segment_offset = segment.p_offset;
+            auto remaining = static_cast<std::size_t>(segment.p_type == PT_LOAD ? segment.p_filesz : 0);
+            while(remaining > 0) {
+                if(buffer_size == core_chunk_size) {
+                    if(const auto result = flush_chunk(); result.is_error()) {
+                        return result;
+                    }
+                }
+
+                const auto size = std::min(remaining, core_chunk_size - buffer_size);
+                const auto buffer = std::span {buffers[buffer_index]}.subspan(buffer_size, size);
+                requests.push_back({address, buffer});
+                parts.push_back({segment_offset, buffer});
+                buffer_size += size;
+                address += static_cast<std::intptr_t>(size);
+                segment_offset += size;
+                remaining -= size;
+            }
+        }
+
+        if(!requests.empty()) {
+            if(const auto result = flush_chunk(); result.is_error()) {
+                return result;
+            }
+        }
+
+        if(pending_write.valid()) {
+            if(const auto result = pending_write.get(); result.is_error()) {
+                return result;
+            }
+        }
+
+        // Holes at the end of the file are only created by its size
+        if(::ftruncate(file.get(), static_cast<off_t>(file_offset)) < 0) {
+            return kstd::Error {fmt::format("Unable to write core file {}: {}", path.string(),
+                                            platform::get_last_error())};
+        }
+        return {};
+    }
+}// namespace libdebug
+#endif
\ No newline at end of file
@@ -0,0 +1,543 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#ifdef PLATFORM_LINUX
+#include "libdebug/coverage.hpp"
+#include "libdebug/arch/instruction.hpp"
+#include "libdebug/cache.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <unordered_set>
+
+namespace libdebug {
+    /**
+     * This function returns whether the specified instruction ends a basic block. Blocks end with branches, calls,
+     * returns and instructions which never continue with the next instruction.
+     *
+     * @param instruction The decoded instruction
+     * @param code        The code starting with the instruction
+     * @return            Whether the instruction ends a block
+     * @author            Cedric Hammes
+     * @since             16/10/2026
+     */
+    static auto is_block_end(const arch::Instruction& instruction, std::span<const kstd::u8> code) noexcept -> bool {
+        if(instruction.relative_size != 0) {
+            return true;
+        }
+
+        const auto opcode = instruction.opcode;
+        if(instruction.opcode_map == 1) {
+            return opcode == 0x0B;
+        }
+
+        if(instruction.opcode_map != 0) {
+            return false;
+        }
+
+        // Indirect calls and jumps are encoded as 0xFF with the operation in the reg field of the ModR/M byte
+        if(opcode == 0xFF && instruction.modrm_offset != 0) {
+            const auto modrm_reg = (code[instruction.modrm_offset] >> 3) & 0x07;
+            return modrm_reg >= 2 && modrm_reg <= 5;
+        }
+        return opcode == 0xC2 || opcode == 0xC3 || opcode == 0xCA || opcode == 0xCB || opcode == 0xCC ||
+               opcode == 0xCF || opcode == 0xF4;
+    }
+
+    /**
+     * This constructor creates a coverage without blocks for the specified process.
+     *
+     * @param process_context The process
+     * @author                Cedric Hammes
+     * @since                 16/10/2026
+     */
+    Coverage::Coverage(ProcessContext& process_context) noexcept ://NOLINT
+            _process_context {&process_context},
+            _modules {},
+            _blocks {},
+            _covered_blocks {},
+            _covered_count {0},
+            _is_installed {false} {
+    }
+
+    /**
+     * This destructor removes the tracepoint callback of the coverage from the process, when the coverage wasn't
+     * uninstalled.
+     *
+     * @author Cedric Hammes
+     * @since  17/10/2026
+     */
+    Coverage::~Coverage() noexcept {
+        remove_tracepoint_callback();
+    }
+
+    /**
+     * This function decodes the functions of the specified module and appends their blocks. The functions are
+     * decoded linearly, so only branch targets at instruction boundaries become blocks. The code is read once per
+     * executable mapping of the module.
+     *
+     * @param module_id    The id of the module
+     * @param file_address The address of the start of the file in the process
+     * @param mode         Whether functions or basic blocks are covered
+     * @author             Cedric Hammes
+     * @since              16/10/2026
+     */
+    auto Coverage::find_blocks(kstd::u16 module_id, std::intptr_t file_address, CoverageMode mode) noexcept -> void {
+        const auto& module = _modules[module_id];
+        std::optional<SymbolTable> symbols {};
+        try {
+            symbols.emplace(module.path, get_cache_directory());
+        }
+        catch(const std::exception&) {
+            return;
+        }
+        symbols->set_load_bias(file_address - symbols->get_base_address());
+
+        const auto memory_map = _process_context->get_memory_map();
+        if(memory_map.is_error()) {
+            return;
+        }
+
+        std::vector<kstd::u8> code {};
+        std::intptr_t code_address = 0;
+        std::vector<bool> instruction_starts {};
+        std::vector<std::intptr_t> block_starts {};
+        std::vector<std::intptr_t> block_ends {};
+        for(std::size_t index = 0; index < symbols->size(); ++index) {
+            const auto symbol = symbols->get_symbol(index);
+            if(!symbol.is_function || symbol.size == 0 || symbol.address < module.begin ||
+               symbol.address >= module.end) {
+                continue;
+            }
+
+            // The symbols are sorted by address, so each executable mapping is only read once
+            const auto code_end = code_address + static_cast<std::intptr_t>(code.size());
+            if(symbol.address < code_address || symbol.address >= code_end) {
+                const auto region = memory_map.get()->find_region(symbol.address);
+                if(!region.has_value() || !region->has_permission(MemoryPermission::EXECUTE) ||
+                   region->path != module.path) {
+                    continue;
+                }
+
+                code.resize(static_cast<std::size_t>(region->end - region->begin));
+                code_address = region->begin;
+                if(_process_context->read_memory(code_address, code).is_error()) {
+                    code.clear();
+                    continue;
+                }
+            }
+
+            // Decode the function and collect the block boundaries, the entry is always a block
+            const auto function_offset = static_cast<std::size_t>(symbol.address - code_address);
+            const auto function = std::span<const kstd::u8> {code}.subspan(
+                    function_offset, std::min(symbol.size, code.size() - function_offset));
+            instruction_starts.assign(function.size(), false);
+            block_starts.assign(1, symbol.address);
+            block_ends.clear();
+            std::size_t offset = 0;
+            while(offset < function.size()) {
+                const auto instruction = arch::decode_instruction(function.subspan(offset));
+                if(instruction.is_error() || offset + instruction.get().size > function.size()) {
+                    break;
+                }
+
+                instruction_starts[offset] = true;
+                const auto& decoded = instruction.get();
+                const auto next_offset = offset + decoded.size;
+                if(!is_block_end(decoded, function.subspan(offset))) {
+                    offset = next_offset;
+                    continue;
+                }
+
+                block_ends.push_back(symbol.address + static_cast<std::intptr_t>(next_offset));
+                if(mode == CoverageMode::FUNCTIONS) {
+                    offset = next_offset;
+                    break;
+                }
+
+                // Targets of relative branches inside the function and the next instruction start new blocks
+                if(decoded.relative_size != 0) {
+                    std::int32_t displacement = 0;
+                    if(decoded.relative_size == 1) {
+                        displacement = static_cast<std::int8_t>(function[offset + decoded.relative_offset]);
+                    }
+                    else {
+                        std::memcpy(&displacement, function.data() + offset + decoded.relative_offset,
+                                    sizeof(displacement));
+                    }
+
+                    const auto target = static_cast<std::intptr_t>(next_offset) + displacement;
+                    if(target >= 0 && static_cast<std::size_t>(target) < function.size()) {
+                        block_starts.push_back(symbol.address + target);
+                    }
+                }
+
+                if(next_offset < function.size()) {
+                    block_starts.push_back(symbol.address + static_cast<std::intptr_t>(next_offset));
+                }
+                offset = next_offset;
+            }
+            const auto decoded_end = symbol.address + static_cast<std::intptr_t>(std::max<std::size_t>(offset, 1));
+
+            // A branch into the middle of a decoded instruction means that the function isn't decoded correctly, so
+            // such targets are never patched
+            std::sort(block_starts.begin(), block_starts.end());
+            block_starts.erase(std::unique(block_starts.begin(), block_starts.end()), block_starts.end());
+            for(std::size_t block = 0; block < block_starts.size(); ++block) {
+                const auto start = block_starts[block];
+                const auto start_offset = static_cast<std::size_t>(start - symbol.address);
+                if(start != symbol.address && (start >= decoded_end || !instruction_starts[start_offset])) {
+                    continue;
+                }
+
+                auto end = block + 1 < block_starts.size() ? std::min(block_starts[block + 1], decoded_end)
+                                                           : decoded_end;
+                if(const auto block_end = std::upper_bound(block_ends.begin(), block_ends.end(), start);
+                   block_end != block_ends.end()) {
+                    end = std::min(end, *block_end);
+                }
+
+                const auto size = std::clamp<std::intptr_t>(end - start, 1, std::numeric_limits<kstd::u16>::max());
+                _blocks.push_back({start, static_cast<kstd::u16>(size), module_id});
+            }
+        }
+    }
+
+    /**
+     * This function marks the block at the specified address as covered. Addresses of tracepoints, which aren't
+     * blocks of this coverage, are ignored.
+     *
+     * @param address The address of the hit tracepoint
+     * @author        Cedric Hammes
+     * @since         17/10/2026
+     */
+    auto Coverage::cover_block(std::intptr_t address) noexcept -> void {
+        const auto block = std::lower_bound(_blocks.cbegin(), _blocks.cend(), address,
+                                            [](const auto& element, auto value) { return element.address < value; });
+        if(block == _blocks.cend() || block->address != address) {
+            return;
+        }
+
+        const auto index = static_cast<std::size_t>(block - _blocks.cbegin());
+        if(!_covered_blocks[index]) {
+            _covered_blocks[index] = true;
+            ++_covered_count;
+        }
+    }
+
+    /**
+     * This function removes the tracepoint callback of this coverage from the process, so later hits are no longer
+     * counted.
+     *
+     * @author Cedric Hammes
+     * @since  17/10/2026
+     */
+    auto Coverage::remove_tracepoint_callback() noexcept -> void {
+        if(_is_installed) {
+            _process_context->set_tracepoint_callback({}, nullptr);
+            _is_installed = false;
+        }
+    }
+
+    /**
+     * This function finds the blocks of all mapped files with executable code and adds the one-shot breakpoints
+     * in a single batch. Files without symbols are skipped, blocks which can't be patched are dropped.
+     *
+     * @param mode Whether functions or basic blocks are covered
+     * @return     Void or an error
+     * @author     Cedric Hammes
+     * @since      16/10/2026
+     */
+    auto Coverage::install(CoverageMode mode) noexcept -> kstd::Result<void> {
+        const auto memory_map = _process_context->get_memory_map();
+        if(memory_map.is_error()) {
+            return kstd::Error {fmt::format("Unable to install coverage: {}", memory_map.get_error())};
+        }
+
+        // Every file with executable code becomes a module, which spans all mappings of the file. The address of
+        // the start of the file is derived from the first mapping, like the load bias of the unwind modules.
+        _modules.clear();
+        _blocks.clear();
+        std::vector<std::intptr_t> file_addresses {};
+        std::unordered_set<std::string_view> executable_paths {};
+        for(std::size_t index = 0; index < memory_map.get()->size(); ++index) {
+            const auto region = memory_map.get()->get_region(index);
+            if(!region.path.starts_with('/')) {
+                continue;
+            }
+
+            if(region.has_permission(MemoryPermission::EXECUTE)) {
+                executable_paths.insert(region.path);
+            }
+
+            if(!_modules.empty() && _modules.back().path == region.path) {
+                _modules.back().end = std::max(_modules.back().end, region.end);
+                continue;
+            }
+            _modules.push_back({std::string {region.path}, region.begin, region.end});
+            file_addresses.push_back(region.begin - static_cast<std::intptr_t>(region.offset));
+        }
+
+        for(std::size_t index = _modules.size(); index > 0; --index) {
+            if(!executable_paths.contains(_modules[index - 1].path)) {
+                _modules.erase(_modules.begin() + static_cast<std::ptrdiff_t>(index - 1));
+                file_addresses.erase(file_addresses.begin() + static_cast<std::ptrdiff_t>(index - 1));
+            }
+        }
+
+        if(_modules.size() > std::numeric_limits<kstd::u16>::max()) {
+            return kstd::Error {fmt::format("Unable to install coverage: {} modules are mapped", _modules.size())};
+        }
+
+        for(std::size_t index = 0; index < _modules.size(); ++index) {
+            find_blocks(static_cast<kstd::u16>(index), file_addresses[index], mode);
+        }
+
+        // Aliases of a function share their blocks
+        std::sort(_blocks.begin(), _blocks.end(), [](const auto& left, const auto& right) {
+            return left.address < right.address;
+        });
+        _blocks.erase(std::unique(_blocks.begin(), _blocks.end(),
+                                  [](const auto& left, const auto& right) { return left.address == right.address; }),
+                      _blocks.end());
+
+        std::vector<std::intptr_t> addresses {};
+        addresses.reserve(_blocks.size());
+        for(const auto& block : _blocks) {
+            addresses.push_back(block.address);
+        }
+
+        // Blocks which can't be patched (like blocks with a breakpoint of the user) are not covered. The hits only
+        // have to be counted, so they aren't recorded into the trace buffer.
+        const auto results = _process_context->add_tracepoints(addresses, {}, 1, false);
+        std::size_t block_count = 0;
+        for(std::size_t index = 0; index < _blocks.size(); ++index) {
+            if(results[index].is_ok()) {
+                _blocks[block_count++] = _blocks[index];
+            }
+        }
+        _blocks.resize(block_count);
+        _covered_blocks.assign(_blocks.size(), false);
+        _covered_count = 0;
+
+        // Each block is covered once on the hit of its tracepoint, so the blocks are never rescanned
+        _process_context->set_tracepoint_callback(
+                [](const Tracepoint& tracepoint, void* data) {
+                    static_cast<Coverage*>(data)->cover_block(tracepoint.address);
+                },
+                this);
+        _is_installed = true;
+        return {};
+    }
+
+    /**
+     * This function runs the process until the specified duration is elapsed or the process exited. Stopped
+     * threads are resumed first, the signals of the process are delivered to their thread.
+     *
+     * @param duration The time to collect coverage
+     * @return         Void or an error
+     * @author         Cedric Hammes
+     * @since          16/10/2026
+     */
+    auto Coverage::run(std::chrono::milliseconds duration) noexcept -> kstd::Result<void> {
+        using namespace std::chrono;
+        for(auto& [thread_id, thread] : _process_context->get_threads()) {
+            if(!thread.is_stopped()) {
+                continue;
+            }
+
+            if(const auto result = _process_context->resume_thread(thread_id); result.is_error()) {
+                return kstd::Error {fmt::format("Unable to collect coverage: {}", result.get_error())};
+            }
+        }
+
+        // The hits of the blocks are handled while waiting, so only other signals are reported here
+        const auto end_time = steady_clock::now() + duration;
+        for(auto now = steady_clock::now(); now < end_time; now = steady_clock::now()) {
+            const auto signal = _process_context->wait_for_signal(ceil<milliseconds>(end_time - now));
+            if(signal.is_error()) {
+                const auto is_running = _process_context->is_process_running();
+                if(is_running.is_ok() && !is_running.get()) {
+                    return {};
+                }
+                return kstd::Error {fmt::format("Unable to collect coverage: {}", signal.get_error())};
+            }
+
+            if(!signal.get().has_value()) {
+                continue;
+            }
+
+            const auto* thread = signal.get()->get_thread();
+            if(thread->get_state() == ThreadState::EXITED) {
+                return {};
+            }
+
+            // Other signals are delivered, traps and interrupts are caused by the debugger and suppressed
+            const auto signal_number = signal.get()->get_signal_info().si_signo;
+            const auto delivered_signal = signal_number == SIGTRAP || signal.get()->is_interrupt() ? 0 : signal_number;
+            const auto result = _process_context->resume_thread(thread->get_thread_id(), delivered_signal);
+            if(result.is_error()) {
+                return kstd::Error {fmt::format("Unable to collect coverage: {}", result.get_error())};
+            }
+        }
+        return {};
+    }
+
+    /**
+     * This function stops all threads of the running process, removes the breakpoints of the blocks which weren't
+     * hit yet and resumes the threads. Afterward the process can be detached without leaving breakpoints behind.
+     *
+     * @return Void or an error
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto Coverage::uninstall() noexcept -> kstd::Result<void> {
+        using namespace std::chrono_literals;
+        if(const auto is_running = _process_context->is_process_running(); is_running.is_error() || !is_running.get()) {
+            remove_tracepoint_callback();
+            return {};
+        }
+
+        // Interrupt all running threads, so no thread is between a trap and its report while the code is restored
+        auto& threads = _process_context->get_threads();
+        std::unordered_set<platform::TaskId> interrupted_threads {};
+        for(auto& [thread_id, thread] : threads) {
+            if(thread.get_state() != ThreadState::RUNNING) {
+                continue;
+            }
+
+            if(const auto result = _process_context->interrupt_thread(thread_id); result.is_error()) {
+                return kstd::Error {fmt::format("Unable to uninstall coverage: {}", result.get_error())};
+            }
+            interrupted_threads.insert(thread_id);
+        }
+
+        std::vector<platform::TaskId> stopped_threads {};
+        while(!interrupted_threads.empty()) {
+            const auto signal = _process_context->wait_for_signal(10ms);
+            if(signal.is_error()) {
+                return kstd::Error {fmt::format("Unable to uninstall coverage: {}", signal.get_error())};
+            }
+
+            // Threads exiting before their interrupt never report it
+            if(!signal.get().has_value()) {
+                std::erase_if(interrupted_threads,
+                              [&](platform::TaskId thread_id) { return !threads.contains(thread_id); });
+                continue;
+            }
+
+            const auto thread_id = signal.get()->get_thread()->get_thread_id();
+            if(signal.get()->get_thread()->get_state() == ThreadState::EXITED) {
+                remove_tracepoint_callback();
+                return {};
+            }
+
+            if(!signal.get()->is_interrupt() || !interrupted_threads.contains(thread_id)) {
+                const auto signal_number = signal.get()->get_signal_info().si_signo;
+                const auto delivered_signal = signal_number == SIGTRAP ? 0 : signal_number;
+                const auto result = _process_context->resume_thread(thread_id, delivered_signal);
+                if(result.is_error()) {
+                    return kstd::Error {fmt::format("Unable to uninstall coverage: {}", result.get_error())};
+                }
+                continue;
+            }
+
+            interrupted_threads.erase(thread_id);
+            stopped_threads.push_back(thread_id);
+        }
+
+        // The hits while stopping the threads are kept, the tracepoints are removed with their breakpoints
+        remove_tracepoint_callback();
+        std::vector<std::intptr_t> addresses {};
+        addresses.reserve(_blocks.size());
+        for(const auto& block : _blocks) {
+            addresses.push_back(block.address);
+        }
+
+        const auto results = _process_context->remove_breakpoints(addresses);
+        if(const auto result = std::find_if(results.begin(), results.end(), [](const auto& value) {
+               return value.is_error();
+           });
+           result != results.end()) {
+            return kstd::Error {fmt::format("Unable to uninstall coverage: {}", result->get_error())};
+        }
+
+        for(const auto thread_id : stopped_threads) {
+            if(const auto result = _process_context->resume_thread(thread_id); result.is_error()) {
+                return kstd::Error {fmt::format("Unable to uninstall coverage: {}", result.get_error())};
+            }
+        }
+        return {};
+    }
+
+    /**
+     * This function writes the covered blocks in the drcov format version 2, with a text module table followed
+     * by the binary table of the blocks. The blocks are written relative to the begin of their module.
+     *
+     * @param stream The stream to write into
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    auto Coverage::write_drcov(std::ostream& stream) const noexcept -> void {
+        stream << "DRCOV VERSION: 2\n";
+        stream << "DRCOV FLAVOR: drcov\n";
+        stream << fmt::format("Module Table: version 2, count {}\n", _modules.size());
+        stream << "Columns: id, base, end, entry, checksum, timestamp, path\n";
+        for(std::size_t index = 0; index < _modules.size(); ++index) {
+            const auto& module = _modules[index];
+            stream << fmt::format("{:3}, {:#018x}, {:#018x}, {:#018x}, {:#010x}, {:#010x}, {}\n", index,
+                                  static_cast<kstd::u64>(module.begin), static_cast<kstd::u64>(module.end), 0, 0, 0,
+                                  module.path);
+        }
+
+        // Each block is written as its 32-bit offset in the module, its 16-bit size and its 16-bit module id
+        stream << fmt::format("BB Table: {} bbs\n", get_covered_count());
+        for(std::size_t index = 0; index < _blocks.size(); ++index) {
+            if(!_covered_blocks[index]) {
+                continue;
+            }
+
+            const auto& block = _blocks[index];
+            const auto offset = static_cast<kstd::u32>(block.address - _modules[block.module_id].begin);
+            std::array<char, 8> entry {};
+            std::memcpy(entry.data(), &offset, sizeof(offset));
+            std::memcpy(entry.data() + 4, &block.size, sizeof(block.size));
+            std::memcpy(entry.data() + 6, &block.module_id, sizeof(block.module_id));
+            stream.write(entry.data(), entry.size());
+        }
+    }
+
+    /**
+     * This function returns whether the block at the specified address was hit.
+     *
+     * @param address The address of the block
+     * @return        Whether the block was hit, false when no block is at the address
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto Coverage::is_covered(std::intptr_t address) const noexcept -> bool {
+        const auto block = std::lower_bound(_blocks.cbegin(), _blocks.cend(), address,
+                                            [](const auto& element, auto value) { return element.address < value; });
+        return block != _blocks.cend() && block->address == address &&
+               _covered_blocks[static_cast<std::size_t>(block - _blocks.cbegin())];
+    }
+}// namespace libdebug
+#endif
\ No newline at end of file
@@ -0,0 +1,1109 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#ifdef PLATFORM_LINUX
+#include "libdebug/dwarf.hpp"
+#include "libdebug/cache.hpp"
+#include "libdebug/dwarf_reader.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <elf.h>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace libdebug {
+    static constexpr std::array<char, 8> line_cache_magic {'L', 'D', 'L', 'I', 'N', 'E', 'S', '\0'};
+    static constexpr kstd::u8 row_is_statement = 0b01;
+    static constexpr kstd::u8 row_end_sequence = 0b10;
+
+    static constexpr kstd::u64 form_addr = 0x01;
+    static constexpr kstd::u64 form_string = 0x08;
+    static constexpr kstd::u64 form_strp = 0x0E;
+    static constexpr kstd::u64 form_line_strp = 0x1F;
+    static constexpr kstd::u64 form_implicit_const = 0x21;
+    static constexpr kstd::u64 form_rnglistx = 0x23;
+
+    static constexpr kstd::u64 attribute_stmt_list = 0x10;
+    static constexpr kstd::u64 attribute_low_pc = 0x11;
+    static constexpr kstd::u64 attribute_high_pc = 0x12;
+    static constexpr kstd::u64 attribute_ranges = 0x55;
+    static constexpr kstd::u64 attribute_rnglists_base = 0x74;
+
+    static constexpr kstd::u64 content_path = 0x1;
+    static constexpr kstd::u64 content_directory_index = 0x2;
+
+    /**
+     * This structure is the header of a line cache file. The header is followed by the line program offsets of the
+     * units and the address ranges.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct LineCacheHeader final {
+        std::array<char, 8> magic;
+        kstd::u32 version;
+        kstd::u32 reserved;
+        kstd::u64 unit_count;
+        kstd::u64 range_count;
+        kstd::u64 executable_size;
+    };
+
+    /**
+     * This structure is the part of the header of a line program required to run the program.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct LineProgramHeader final {
+        kstd::u16 version;
+        kstd::u8 address_size;
+        kstd::u8 minimum_instruction_length;
+        bool default_is_statement;
+        kstd::i8 line_base;
+        kstd::u8 line_range;
+        kstd::u8 opcode_base;
+        std::vector<kstd::u8> standard_opcode_lengths;
+        std::size_t program_offset;
+        std::size_t program_end;
+    };
+
+    /**
+     * This function reads the value of an attribute with the specified form. Values which are not scalars, like
+     * strings and blocks, are skipped.
+     *
+     * @param reader         The reader at the value
+     * @param form           The form of the value
+     * @param is_64_bit      Whether the unit uses the 64-bit format
+     * @param address_size   The size of an address in the unit
+     * @param implicit_value The value of an implicit constant
+     * @return               The value or no value, when the value is not a scalar
+     * @author               Cedric Hammes
+     * @since                16/10/2026
+     */
+    static auto read_form(DwarfReader& reader, kstd::u64 form, bool is_64_bit, kstd::u8 address_size,
+                          kstd::i64 implicit_value) noexcept -> std::optional<kstd::u64> {
+        switch(form) {
+            case 0x01: return reader.read_address(address_size);
+            case 0x03: reader.skip(reader.read<kstd::u16>()); return {};
+            case 0x04: reader.skip(reader.read<kstd::u32>()); return {};
+            case 0x05:
+            case 0x12:
+            case 0x26:
+            case 0x2A: return reader.read<kstd::u16>();
+            case 0x06:
+            case 0x13:
+            case 0x1C:
+            case 0x28:
+            case 0x2C: return reader.read<kstd::u32>();
+            case 0x07:
+            case 0x14:
+            case 0x20:
+            case 0x24: return reader.read<kstd::u64>();
+            case 0x08: static_cast<void>(reader.read_string()); return {};
+            case 0x09:
+            case 0x18: reader.skip(reader.read_uleb128()); return {};
+            case 0x0A: reader.skip(reader.read<kstd::u8>()); return {};
+            case 0x0B:
+            case 0x0C:
+            case 0x11:
+            case 0x25:
+            case 0x29: return reader.read<kstd::u8>();
+            case 0x0D: return static_cast<kstd::u64>(reader.read_sleb128());
+            case 0x0E:
+            case 0x10:
+            case 0x17:
+            case 0x1D:
+            case 0x1F:
+            case 0x1F20:
+            case 0x1F21: return reader.read_offset(is_64_bit);
+            case 0x0F:
+            case 0x15:
+            case 0x1A:
+            case 0x1B:
+            case 0x22:
+            case 0x23:
+            case 0x1F01:
+            case 0x1F02: return reader.read_uleb128();
+            case 0x16: return read_form(reader, reader.read_uleb128(), is_64_bit, address_size, implicit_value);
+            case 0x19: return 1;
+            case 0x1E: reader.skip(16); return {};
+            case 0x21: return static_cast<kstd::u64>(implicit_value);
+            case 0x27:
+            case 0x2B: {
+                kstd::u64 value = reader.read<kstd::u16>();
+                return value | (static_cast<kstd::u64>(reader.read<kstd::u8>()) << 16);
+            }
+            default: reader.fail(); return {};
+        }
+    }
+
+    /**
+     * This function reads the address ranges of the range list at the specified offset. The range lists of units
+     * before DWARF 5 are stored in the .debug_ranges section, the range lists of later units in the .debug_rnglists
+     * section. Entries with indices into the .debug_addr section are not supported.
+     *
+     * @param data         The data of the range list section
+     * @param offset       The offset of the range list
+     * @param version      The DWARF version of the unit
+     * @param address_size The size of an address in the unit
+     * @param base_address The base address of the unit
+     * @return             The address ranges or no value, when the range list is invalid or not supported
+     * @author             Cedric Hammes
+     * @since              17/10/2026
+     */
+    static auto read_range_list(std::span<const kstd::u8> data, kstd::u64 offset, kstd::u16 version,
+                                kstd::u8 address_size, kstd::u64 base_address) noexcept
+            -> std::optional<std::vector<std::pair<kstd::u64, kstd::u64>>> {
+        DwarfReader reader {data, static_cast<std::size_t>(offset)};
+        std::vector<std::pair<kstd::u64, kstd::u64>> ranges {};
+        if(version < 5) {
+            // An entry beginning at the largest address selects a new base address
+            const auto base_selection = address_size == 8 ? std::numeric_limits<kstd::u64>::max() : UINT32_MAX;
+            while(!reader.is_failed()) {
+                const auto begin = reader.read_address(address_size);
+                const auto end = reader.read_address(address_size);
+                if(begin == 0 && end == 0) {
+                    break;
+                }
+
+                if(begin == base_selection) {
+                    base_address = end;
+                }
+                else if(end > begin) {
+                    ranges.emplace_back(base_address + begin, base_address + end);
+                }
+            }
+        }
+        else {
+            for(auto kind = reader.read<kstd::u8>(); kind != 0 && !reader.is_failed(); kind = reader.read<kstd::u8>()) {
+                kstd::u64 begin = 0;
+                kstd::u64 end = 0;
+                switch(kind) {
+                    case 0x04: {
+                        begin = base_address + reader.read_uleb128();
+                        end = base_address + reader.read_uleb128();
+                        break;
+                    }
+                    case 0x05: base_address = reader.read_address(address_size); continue;
+                    case 0x06: {
+                        begin = reader.read_address(address_size);
+                        end = reader.read_address(address_size);
+                        break;
+                    }
+                    case 0x07: {
+                        begin = reader.read_address(address_size);
+                        end = begin + reader.read_uleb128();
+                        break;
+                    }
+                    default: return {};
+                }
+
+                if(end > begin) {
+                    ranges.emplace_back(begin, end);
+                }
+            }
+        }
+
+        if(reader.is_failed()) {
+            return {};
+        }
+        return ranges;
+    }
+
+    /**
+     * This function reads a string attribute of a line program header, which is either stored inline or in one of
+     * the string sections.
+     *
+     * @param reader          The reader at the value
+     * @param form            The form of the value
+     * @param is_64_bit       Whether the unit uses the 64-bit format
+     * @param debug_str       The data of the .debug_str section
+     * @param debug_line_str  The data of the .debug_line_str section
+     * @return                The string or no value, when the form is not supported
+     * @author                Cedric Hammes
+     * @since                 16/10/2026
+     */
+    static auto read_string_form(DwarfReader& reader, kstd::u64 form, bool is_64_bit,
+                                 std::span<const kstd::u8> debug_str,
+                                 std::span<const kstd::u8> debug_line_str) noexcept -> std::optional<std::string_view> {
+        if(form == form_string) {
+            return reader.read_string();
+        }
+
+        if(form != form_strp && form != form_line_strp) {
+            static_cast<void>(read_form(reader, form, is_64_bit, 0, 0));
+            return {};
+        }
+
+        const auto offset = reader.read_offset(is_64_bit);
+        DwarfReader string_reader {form == form_strp ? debug_str : debug_line_str, static_cast<std::size_t>(offset)};
+        const auto string = string_reader.read_string();
+        if(string_reader.is_failed()) {
+            reader.fail();
+            return {};
+        }
+        return string;
+    }
+
+    /**
+     * This function reads the header of the line program at the specified offset. The paths of the files are only
+     * read when a file list is specified.
+     *
+     * @param line_data      The data of the .debug_line section
+     * @param debug_str      The data of the .debug_str section
+     * @param debug_line_str The data of the .debug_line_str section
+     * @param offset         The offset of the line program
+     * @param files          The list for the file paths or a null pointer
+     * @return               The header or an error
+     * @author               Cedric Hammes
+     * @since                16/10/2026
+     */
+    static auto read_line_header(std::span<const kstd::u8> line_data, std::span<const kstd::u8> debug_str,
+                                 std::span<const kstd::u8> debug_line_str, kstd::u64 offset,
+                                 std::vector<std::string>* files) noexcept -> kstd::Result<LineProgramHeader> {
+        DwarfReader reader {line_data, static_cast<std::size_t>(offset)};
+        LineProgramHeader header {};
+        bool is_64_bit = false;
+        const auto length = reader.read_unit_length(is_64_bit);
+        header.program_end = reader.get_offset() + static_cast<std::size_t>(length);
+        header.version = reader.read<kstd::u16>();
+        header.address_size = 8;
+        if(header.version >= 5) {
+            header.address_size = reader.read<kstd::u8>();
+            static_cast<void>(reader.read<kstd::u8>());
+        }
+
+        const auto header_length = reader.read_offset(is_64_bit);
+        header.program_offset = reader.get_offset() + static_cast<std::size_t>(header_length);
+        header.minimum_instruction_length = reader.read<kstd::u8>();
+        if(header.version >= 4) {
+            static_cast<void>(reader.read<kstd::u8>());
+        }
+        header.default_is_statement = reader.read<kstd::u8>() != 0;
+        header.line_base = reader.read<kstd::i8>();
+        header.line_range = reader.read<kstd::u8>();
+        header.opcode_base = reader.read<kstd::u8>();
+        for(std::size_t opcode = 1; opcode < header.opcode_base; ++opcode) {
+            header.standard_opcode_lengths.push_back(reader.read<kstd::u8>());
+        }
+
+        if(reader.is_failed() || header.program_end > line_data.size() || header.program_offset > header.program_end ||
+           header.version < 2 || header.version > 5 || header.line_range == 0) {
+            return kstd::Error {fmt::format("Unable to read line program at {}: Header is invalid", offset)};
+        }
+
+        if(files == nullptr) {
+            return header;
+        }
+
+        // The file paths are joined with their directory, when they are relative
+        std::vector<std::string_view> directories {};
+        const auto add_file = [&](std::string_view name, kstd::u64 directory_index) {
+            if(name.starts_with('/') || directory_index >= directories.size() || directories[directory_index].empty()) {
+                files->emplace_back(name);
+                return;
+            }
+            files->push_back(fmt::format("{}/{}", directories[directory_index], name));
+        };
+
+        if(header.version < 5) {
+            // The compilation directory and the primary file are not part of the lists before DWARF 5
+            directories.emplace_back();
+            files->emplace_back();
+            for(auto directory = reader.read_string(); !directory.empty(); directory = reader.read_string()) {
+                directories.push_back(directory);
+            }
+
+            for(auto name = reader.read_string(); !name.empty() && !reader.is_failed(); name = reader.read_string()) {
+                const auto directory_index = reader.read_uleb128();
+                static_cast<void>(reader.read_uleb128());
+                static_cast<void>(reader.read_uleb128());
+                add_file(name, directory_index);
+            }
+        }
+        else {
+            // Both lists are described by a list of content types and the forms of their values
+            for(auto is_file_list : {false, true}) {
+                std::vector<std::pair<kstd::u64, kstd::u64>> formats {};
+                const auto format_count = reader.read<kstd::u8>();
+                for(std::size_t index = 0; index < format_count; ++index) {
+                    const auto content_type = reader.read_uleb128();
+                    formats.emplace_back(content_type, reader.read_uleb128());
+                }
+
+                const auto entry_count = reader.read_uleb128();
+                for(kstd::u64 index = 0; index < entry_count && !reader.is_failed(); ++index) {
+                    std::string_view path {};
+                    kstd::u64 directory_index = 0;
+                    for(const auto& [content_type, form] : formats) {
+                        if(content_type == content_path) {
+                            path = read_string_form(reader, form, is_64_bit, debug_str, debug_line_str).value_or("");
+                        }
+                        else if(content_type == content_directory_index) {
+                            directory_index = read_form(reader, form, is_64_bit, header.address_size, 0).value_or(0);
+                        }
+                        else {
+                            static_cast<void>(read_form(reader, form, is_64_bit, header.address_size, 0));
+                        }
+                    }
+
+                    if(is_file_list) {
+                        add_file(path, directory_index);
+                    }
+                    else {
+                        directories.push_back(path);
+                    }
+                }
+            }
+        }
+
+        if(reader.is_failed()) {
+            return kstd::Error {fmt::format("Unable to read line program at {}: File list is invalid", offset)};
+        }
+        return header;
+    }
+
+    /**
+     * This constructor maps the specified ELF executable and locates the DWARF sections. No debug information is
+     * read before the first lookup.
+     *
+     * @param path            The path to the executable
+     * @param cache_directory The directory of the cache files or no value to disable the cache
+     * @author                Cedric Hammes
+     * @since                 16/10/2026
+     */
+    LineTable::LineTable(const std::filesystem::path& path,
+                         const std::optional<std::filesystem::path>& cache_directory) ://NOLINT
+            _mapping {},
+            _debug_info {},
+            _debug_abbrev {},
+            _debug_aranges {},
+            _debug_ranges {},
+            _debug_rnglists {},
+            _debug_line {},
+            _debug_line_str {},
+            _debug_str {},
+            _units {},
+            _ranges {},
+            _unranged_units {},
+            _indexed {false},
+            _load_bias {0},
+            _cache_path {} {
+        auto mapping = platform::map_file(path);
+        if(mapping.is_error()) {
+            throw std::runtime_error {fmt::format("Unable to load line table: {}", mapping.get_error())};
+        }
+        _mapping = std::move(mapping.get());
+
+        const auto data = _mapping.get_data();
+        Elf64_Ehdr header {};
+        if(data.size() < sizeof(header)) {
+            throw std::runtime_error {fmt::format("Unable to load line table: {} is not an ELF file", path.string())};
+        }
+        std::memcpy(&header, data.data(), sizeof(header));
+        if(std::memcmp(header.e_ident, ELFMAG, SELFMAG) != 0 || header.e_ident[EI_CLASS] != ELFCLASS64 ||
+           header.e_shentsize != sizeof(Elf64_Shdr) || header.e_shoff > data.size() ||
+           (data.size() - header.e_shoff) / sizeof(Elf64_Shdr) < header.e_shnum ||
+           header.e_shstrndx >= header.e_shnum) {
+            throw std::runtime_error {
+                    fmt::format("Unable to load line table: {} is not a 64-bit ELF file", path.string())};
+        }
+
+        const auto read_section = [&](std::size_t index) {
+            Elf64_Shdr section {};
+            std::memcpy(&section, data.data() + header.e_shoff + index * sizeof(section), sizeof(section));
+            return section;
+        };
+
+        // Compressed sections are skipped, so executables with them are handled like executables without them
+        const auto names = read_section(header.e_shstrndx);
+        for(std::size_t index = 0; index < header.e_shnum; ++index) {
+            const auto section = read_section(index);
+            if(section.sh_type == SHT_NOBITS || (section.sh_flags & SHF_COMPRESSED) != 0 ||
+               section.sh_offset > data.size() || data.size() - section.sh_offset < section.sh_size ||
+               section.sh_name >= names.sh_size || names.sh_offset + names.sh_size > data.size()) {
+                continue;
+            }
+
+            const auto* name_begin = reinterpret_cast<const char*>(data.data() + names.sh_offset + section.sh_name);
+            const std::string_view name {name_begin, ::strnlen(name_begin, names.sh_size - section.sh_name)};
+            const Section location {static_cast<std::size_t>(section.sh_offset),
+                                    static_cast<std::size_t>(section.sh_size)};
+            if(name == ".debug_info") {
+                _debug_info = location;
+            }
+            else if(name == ".debug_abbrev") {
+                _debug_abbrev = location;
+            }
+            else if(name == ".debug_aranges") {
+                _debug_aranges = location;
+            }
+            else if(name == ".debug_ranges") {
+                _debug_ranges = location;
+            }
+            else if(name == ".debug_rnglists") {
+                _debug_rnglists = location;
+            }
+            else if(name == ".debug_line") {
+                _debug_line = location;
+            }
+            else if(name == ".debug_line_str") {
+                _debug_line_str = location;
+            }
+            else if(name == ".debug_str") {
+                _debug_str = location;
+            }
+        }
+
+        // The cache is keyed by the build-id, so executables without a build-id are never cached
+        if(const auto build_id = read_build_id(data); cache_directory.has_value() && build_id.has_value()) {
+            _cache_path = *cache_directory / fmt::format("{}.lines", *build_id);
+        }
+    }
+
+    /**
+     * This function loads the units and the address ranges from the specified cache file. The cache file is
+     * validated, so a damaged cache file is never used.
+     *
+     * @param path The path of the cache file
+     * @return     Whether the cache file was loaded
+     * @author     Cedric Hammes
+     * @since      16/10/2026
+     */
+    auto LineTable::load_cache(const std::filesystem::path& path) noexcept -> bool {
+        const auto mapping = platform::map_file(path);
+        if(mapping.is_error()) {
+            return false;
+        }
+
+        const auto data = mapping.get().get_data();
+        LineCacheHeader header {};
+        if(data.size() < sizeof(header)) {
+            return false;
+        }
+        std::memcpy(&header, data.data(), sizeof(header));
+
+        const auto ranges_offset = sizeof(header) + header.unit_count * sizeof(kstd::u64);
+        if(header.magic != line_cache_magic || header.version != cache_version ||
+           header.executable_size != _mapping.get_data().size() || header.unit_count > data.size() ||
+           header.range_count > data.size() ||
+           ranges_offset + header.range_count * sizeof(AddressRange) != data.size()) {
+            return false;
+        }
+
+        std::vector<AddressRange> ranges(header.range_count);
+        std::memcpy(ranges.data(), data.data() + ranges_offset, ranges.size() * sizeof(AddressRange));
+        if(std::any_of(ranges.cbegin(), ranges.cend(),
+                       [&](const auto& range) { return range.unit_index >= header.unit_count; })) {
+            return false;
+        }
+
+        _units.clear();
+        _units.reserve(header.unit_count);
+        for(std::size_t index = 0; index < header.unit_count; ++index) {
+            kstd::u64 line_offset = 0;
+            std::memcpy(&line_offset, data.data() + sizeof(header) + index * sizeof(line_offset), sizeof(line_offset));
+            _units.push_back({line_offset, nullptr, {}});
+        }
+
+        // The units without any range in the cache file are decoded on the first miss like after a scan
+        std::vector<bool> has_range(_units.size(), false);
+        for(const auto& range : ranges) {
+            has_range[range.unit_index] = true;
+        }
+
+        _unranged_units.clear();
+        for(std::size_t unit_index = 0; unit_index < _units.size(); ++unit_index) {
+            if(!has_range[unit_index]) {
+                _unranged_units.push_back(unit_index);
+            }
+        }
+        _ranges = std::move(ranges);
+        return true;
+    }
+
+    /**
+     * This function writes the line program offsets of the units and the address ranges into the specified cache
+     * file.
+     *
+     * @param path The path of the cache file
+     * @return     Void or an error
+     * @author     Cedric Hammes
+     * @since      16/10/2026
+     */
+    auto LineTable::write_cache(const std::filesystem::path& path) const noexcept -> kstd::Result<void> {
+        std::vector<kstd::u64> line_offsets(_units.size());
+        std::transform(_units.cbegin(), _units.cend(), line_offsets.begin(),
+                       [](const auto& unit) { return unit.line_offset; });
+
+        const LineCacheHeader header {line_cache_magic, cache_version, 0, line_offsets.size(), _ranges.size(),
+                                      _mapping.get_data().size()};
+        const std::array<std::span<const kstd::u8>, 3> parts {
+                std::span {reinterpret_cast<const kstd::u8*>(&header), sizeof(header)},
+                std::span {reinterpret_cast<const kstd::u8*>(line_offsets.data()), line_offsets.size() * 8},
+                std::span {reinterpret_cast<const kstd::u8*>(_ranges.data()), _ranges.size() * sizeof(AddressRange)}};
+        return write_cache_file(path, parts);
+    }
+
+    /**
+     * This function returns the data of the specified section in the mapped executable.
+     *
+     * @param section The location of the section
+     * @return        The data of the section
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto LineTable::get_section_data(const Section& section) const noexcept -> std::span<const kstd::u8> {
+        return _mapping.get_data().subspan(section.offset, section.size);
+    }
+
+    /**
+     * This function builds the index from address ranges to compilation units. The ranges are read from the
+     * .debug_aranges section and from the root entries of the units, including their range lists. No unit is decoded,
+     * units without any known range are only remembered.
+     *
+     * @return Void or an error
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto LineTable::build_index() noexcept -> kstd::Result<void> {
+        _indexed = true;
+        if(!has_line_information() || (_cache_path.has_value() && load_cache(*_cache_path))) {
+            return {};
+        }
+
+        // Scan the root entry of every compilation unit for its line program and its address range
+        std::unordered_map<kstd::u64, std::size_t> unit_indices {};
+        std::vector<AddressRange> entry_ranges {};
+        const auto debug_info = get_section_data(_debug_info);
+        const auto debug_abbrev = get_section_data(_debug_abbrev);
+        const auto debug_ranges = get_section_data(_debug_ranges);
+        const auto debug_rnglists = get_section_data(_debug_rnglists);
+        DwarfReader reader {debug_info, 0};
+        while(reader.get_offset() < debug_info.size()) {
+            const auto unit_offset = reader.get_offset();
+            bool is_64_bit = false;
+            const auto length = reader.read_unit_length(is_64_bit);
+            const auto unit_end = reader.get_offset() + static_cast<std::size_t>(length);
+            const auto version = reader.read<kstd::u16>();
+            kstd::u8 unit_type = 0x01;
+            kstd::u8 address_size = 0;
+            kstd::u64 abbrev_offset = 0;
+            if(version >= 5) {
+                unit_type = reader.read<kstd::u8>();
+                address_size = reader.read<kstd::u8>();
+                abbrev_offset = reader.read_offset(is_64_bit);
+                reader.skip(unit_type == 0x04 || unit_type == 0x05 ? 8 : 0);
+            }
+            else {
+                abbrev_offset = reader.read_offset(is_64_bit);
+                address_size = reader.read<kstd::u8>();
+            }
+
+            if(reader.is_failed() || unit_end > debug_info.size()) {
+                return kstd::Error {fmt::format("Unable to index line table: Unit at {} is truncated", unit_offset)};
+            }
+
+            // Only compilation units and partial units have a line program
+            if(version < 2 || version > 5 || (unit_type != 0x01 && unit_type != 0x03)) {
+                reader.set_offset(unit_end);
+                continue;
+            }
+
+            const auto code = reader.read_uleb128();
+            DwarfReader abbrev_reader {debug_abbrev, static_cast<std::size_t>(abbrev_offset)};
+            while(code != 0 && !abbrev_reader.is_failed()) {
+                const auto abbrev_code = abbrev_reader.read_uleb128();
+                static_cast<void>(abbrev_reader.read_uleb128());
+                static_cast<void>(abbrev_reader.read<kstd::u8>());
+                if(abbrev_code == code || abbrev_code == 0) {
+                    if(abbrev_code == 0) {
+                        abbrev_reader.fail();
+                    }
+                    break;
+                }
+
+                for(auto attribute = abbrev_reader.read_uleb128(), form = abbrev_reader.read_uleb128();
+                    (attribute != 0 || form != 0) && !abbrev_reader.is_failed();
+                    attribute = abbrev_reader.read_uleb128(), form = abbrev_reader.read_uleb128()) {
+                    if(form == form_implicit_const) {
+                        static_cast<void>(abbrev_reader.read_sleb128());
+                    }
+                }
+            }
+
+            if(code == 0 || abbrev_reader.is_failed()) {
+                reader.set_offset(unit_end);
+                continue;
+            }
+
+            std::optional<kstd::u64> line_offset {};
+            std::optional<kstd::u64> low_address {};
+            std::optional<kstd::u64> high_address {};
+            std::optional<kstd::u64> ranges_value {};
+            std::optional<kstd::u64> rnglists_base {};
+            bool high_is_size = false;
+            bool ranges_is_index = false;
+            while(!reader.is_failed() && !abbrev_reader.is_failed()) {
+                const auto attribute = abbrev_reader.read_uleb128();
+                const auto form = abbrev_reader.read_uleb128();
+                const auto implicit_value = form == form_implicit_const ? abbrev_reader.read_sleb128() : 0;
+                if(attribute == 0 && form == 0) {
+                    break;
+                }
+
+                const auto value = read_form(reader, form, is_64_bit, address_size, implicit_value);
+                if(attribute == attribute_stmt_list) {
+                    line_offset = value;
+                }
+                else if(attribute == attribute_low_pc && form == form_addr) {
+                    low_address = value;
+                }
+                else if(attribute == attribute_high_pc && value.has_value()) {
+                    high_address = value;
+                    high_is_size = form != form_addr;
+                }
+                else if(attribute == attribute_ranges) {
+                    ranges_value = value;
+                    ranges_is_index = form == form_rnglistx;
+                }
+                else if(attribute == attribute_rnglists_base) {
+                    rnglists_base = value;
+                }
+            }
+
+            if(line_offset.has_value() && !reader.is_failed()) {
+                const auto unit_index = _units.size();
+                _units.push_back({*line_offset, nullptr, {}});
+                unit_indices.emplace(unit_offset, unit_index);
+                if(low_address.has_value() && high_address.has_value()) {
+                    const auto end = high_is_size ? *low_address + *high_address : *high_address;
+                    if(end > *low_address) {
+                        entry_ranges.push_back({*low_address, end, unit_index});
+                    }
+                }
+
+                // Units with non-contiguous code reference a range list, indices are resolved with the offset table
+                // of the range lists of the unit
+                if(ranges_value.has_value()) {
+                    auto list_offset = *ranges_value;
+                    auto is_valid = true;
+                    if(ranges_is_index) {
+                        const auto list_base = rnglists_base.value_or(0);
+                        const auto index_offset = list_base + list_offset * (is_64_bit ? 8 : 4);
+                        DwarfReader offset_reader {debug_rnglists, static_cast<std::size_t>(index_offset)};
+                        list_offset = list_base + offset_reader.read_offset(is_64_bit);
+                        is_valid = rnglists_base.has_value() && !offset_reader.is_failed();
+                    }
+
+                    const auto range_list =
+                            is_valid ? read_range_list(version >= 5 ? debug_rnglists : debug_ranges, list_offset,
+                                                       version, address_size, low_address.value_or(0))
+                                     : std::nullopt;
+                    if(range_list.has_value()) {
+                        for(const auto& [begin, end] : *range_list) {
+                            entry_ranges.push_back({begin, end, unit_index});
+                        }
+                    }
+                }
+            }
+            reader.set_offset(unit_end);
+        }
+
+        // The address ranges of .debug_aranges are exact, so they are preferred over the ranges of the entries
+        std::vector<bool> has_range(_units.size(), false);
+        const auto debug_aranges = get_section_data(_debug_aranges);
+        DwarfReader aranges_reader {debug_aranges, 0};
+        while(aranges_reader.get_offset() < debug_aranges.size() && !aranges_reader.is_failed()) {
+            const auto set_offset = aranges_reader.get_offset();
+            bool is_64_bit = false;
+            const auto length = aranges_reader.read_unit_length(is_64_bit);
+            const auto set_end = aranges_reader.get_offset() + static_cast<std::size_t>(length);
+            static_cast<void>(aranges_reader.read<kstd::u16>());
+            const auto unit_offset = aranges_reader.read_offset(is_64_bit);
+            const auto address_size = aranges_reader.read<kstd::u8>();
+            const auto segment_size = aranges_reader.read<kstd::u8>();
+            const auto unit = unit_indices.find(unit_offset);
+            if(aranges_reader.is_failed() || set_end > debug_aranges.size() || unit == unit_indices.end() ||
+               (address_size != 4 && address_size != 8) || segment_size != 0) {
+                aranges_reader.set_offset(set_end);
+                continue;
+            }
+
+            // The tuples are aligned to their own size
+            const auto tuple_size = 2 * static_cast<std::size_t>(address_size);
+            const auto header_size = aranges_reader.get_offset() - set_offset;
+            aranges_reader.skip((tuple_size - header_size % tuple_size) % tuple_size);
+            while(aranges_reader.get_offset() + tuple_size <= set_end) {
+                const auto begin = aranges_reader.read_address(address_size);
+                const auto size = aranges_reader.read_address(address_size);
+                if(begin == 0 && size == 0) {
+                    break;
+                }
+
+                if(size != 0) {
+                    _ranges.push_back({begin, begin + size, unit->second});
+                    has_range[unit->second] = true;
+                }
+            }
+            aranges_reader.set_offset(set_end);
+        }
+
+        // A unit can have multiple ranges in its range list, they are only taken when the unit has no exact range
+        std::vector<bool> has_exact_range {has_range};
+        for(const auto& range : entry_ranges) {
+            if(!has_exact_range[range.unit_index]) {
+                _ranges.push_back(range);
+                has_range[range.unit_index] = true;
+            }
+        }
+
+        // The remaining units have no known range, they are only decoded when a lookup misses all known ranges
+        for(std::size_t unit_index = 0; unit_index < _units.size(); ++unit_index) {
+            if(!has_range[unit_index]) {
+                _unranged_units.push_back(unit_index);
+            }
+        }
+
+        std::sort(_ranges.begin(), _ranges.end(), [](const auto& left, const auto& right) {
+            return left.begin < right.begin;
+        });
+
+        // The cache is only an optimization, so the index is usable when it can't be written
+        if(_cache_path.has_value()) {
+            static_cast<void>(write_cache(*_cache_path));
+        }
+        return {};
+    }
+
+    /**
+     * This function decodes the units without any known range and adds their sequences to the address ranges. This is
+     * done once, when the first lookup misses all known ranges.
+     *
+     * @return Void or an error
+     * @author Cedric Hammes
+     * @since  17/10/2026
+     */
+    auto LineTable::index_unranged_units() noexcept -> kstd::Result<void> {
+        for(const auto unit_index : _unranged_units) {
+            const auto decoded = decode_unit(_units[unit_index]);
+            if(decoded.is_error()) {
+                return kstd::Error {decoded.get_error()};
+            }
+
+            // A sequence starts at the first row behind the end of the previous sequence
+            const auto& rows = *decoded.get();
+            std::size_t sequence_begin = 0;
+            for(std::size_t row = 0; row < rows.addresses.size(); ++row) {
+                if((rows.flags[row] & row_end_sequence) == 0) {
+                    continue;
+                }
+
+                if(row > sequence_begin && rows.addresses[row] > rows.addresses[sequence_begin]) {
+                    _ranges.push_back({rows.addresses[sequence_begin], rows.addresses[row], unit_index});
+                }
+                sequence_begin = row + 1;
+            }
+        }
+        _unranged_units.clear();
+
+        std::sort(_ranges.begin(), _ranges.end(), [](const auto& left, const auto& right) {
+            return left.begin < right.begin;
+        });
+        return {};
+    }
+
+    /**
+     * This function reads the paths of the files referenced by the line program of the specified unit, when they
+     * were not read before.
+     *
+     * @param unit The compilation unit
+     * @return     Void or an error
+     * @author     Cedric Hammes
+     * @since      16/10/2026
+     */
+    auto LineTable::read_files(Unit& unit) const noexcept -> kstd::Result<void> {
+        if(!unit.files.empty()) {
+            return {};
+        }
+
+        const auto header = read_line_header(get_section_data(_debug_line), get_section_data(_debug_str),
+                                             get_section_data(_debug_line_str), unit.line_offset, &unit.files);
+        if(header.is_error()) {
+            return kstd::Error {header.get_error()};
+        }
+        return {};
+    }
+
+    /**
+     * This function decodes the line program of the specified unit into rows sorted by address, when it was not
+     * decoded before. The rows are stored by column to keep the decoded units small.
+     *
+     * @param unit The compilation unit
+     * @return     The decoded rows or an error
+     * @author     Cedric Hammes
+     * @since      16/10/2026
+     */
+    auto LineTable::decode_unit(Unit& unit) const noexcept -> kstd::Result<DecodedUnit*> {
+        if(unit.decoded != nullptr) {
+            return unit.decoded.get();
+        }
+
+        if(const auto result = read_files(unit); result.is_error()) {
+            return kstd::Error {result.get_error()};
+        }
+
+        const auto line_data = get_section_data(_debug_line);
+        const auto header_result = read_line_header(line_data, {}, {}, unit.line_offset, nullptr);
+        if(header_result.is_error()) {
+            return kstd::Error {header_result.get_error()};
+        }
+
+        // Run the state machine of the line program
+        const auto& header = header_result.get();
+        DecodedUnit rows {};
+        kstd::u64 address = 0;
+        kstd::u64 file = 1;
+        kstd::i64 line = 1;
+        kstd::u64 column = 0;
+        auto is_statement = header.default_is_statement;
+        const auto append_row = [&](bool end_sequence) {
+            rows.addresses.push_back(address);
+            rows.lines.push_back(static_cast<kstd::u32>(std::clamp<kstd::i64>(line, 0, UINT32_MAX)));
+            rows.columns.push_back(static_cast<kstd::u16>(std::min<kstd::u64>(column, UINT16_MAX)));
+            rows.file_indices.push_back(static_cast<kstd::u16>(std::min<kstd::u64>(file, UINT16_MAX)));
+            rows.flags.push_back((is_statement ? row_is_statement : 0) | (end_sequence ? row_end_sequence : 0));
+        };
+
+        DwarfReader reader {line_data.first(header.program_end), header.program_offset};
+        while(reader.get_offset() < header.program_end && !reader.is_failed()) {
+            const auto opcode = reader.read<kstd::u8>();
+            if(opcode >= header.opcode_base) {
+                const auto adjusted_opcode = static_cast<kstd::u64>(opcode - header.opcode_base);
+                address += (adjusted_opcode / header.line_range) * header.minimum_instruction_length;
+                line += header.line_base + static_cast<kstd::i64>(adjusted_opcode % header.line_range);
+                append_row(false);
+                continue;
+            }
+
+            switch(opcode) {
+                case 0x00: {
+                    const auto length = reader.read_uleb128();
+                    const auto instruction_end = reader.get_offset() + static_cast<std::size_t>(length);
+                    const auto extended_opcode = reader.read<kstd::u8>();
+                    if(extended_opcode == 0x01) {
+                        append_row(true);
+                        address = 0;
+                        file = 1;
+                        line = 1;
+                        column = 0;
+                        is_statement = header.default_is_statement;
+                    }
+                    else if(extended_opcode == 0x02) {
+                        address = reader.read_address(static_cast<std::size_t>(length - 1));
+                    }
+                    reader.set_offset(instruction_end);
+                    break;
+                }
+                case 0x01: append_row(false); break;
+                case 0x02: address += reader.read_uleb128() * header.minimum_instruction_length; break;
+                case 0x03: line += reader.read_sleb128(); break;
+                case 0x04: file = reader.read_uleb128(); break;
+                case 0x05: column = reader.read_uleb128(); break;
+                case 0x06: is_statement = !is_statement; break;
+                case 0x08:
+                    address += ((255 - header.opcode_base) / header.line_range) * header.minimum_instruction_length;
+                    break;
+                case 0x09: address += reader.read<kstd::u16>(); break;
+                default:
+                    for(std::size_t index = 0; index < header.standard_opcode_lengths[opcode - 1]; ++index) {
+                        static_cast<void>(reader.read_uleb128());
+                    }
+                    break;
+            }
+        }
+
+        if(reader.is_failed()) {
+            return kstd::Error {fmt::format("Unable to decode line program at {}: Program is truncated",
+                                            unit.line_offset)};
+        }
+
+        // Sort the sequences by address, the end of a sequence is placed before a sequence starting at its address
+        std::vector<std::size_t> order(rows.addresses.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](auto left, auto right) {
+            if(rows.addresses[left] != rows.addresses[right]) {
+                return rows.addresses[left] < rows.addresses[right];
+            }
+            return (rows.flags[left] & row_end_sequence) > (rows.flags[right] & row_end_sequence);
+        });
+
+        auto decoded = std::make_unique<DecodedUnit>();
+        decoded->addresses.reserve(order.size());
+        decoded->lines.reserve(order.size());
+        decoded->columns.reserve(order.size());
+        decoded->file_indices.reserve(order.size());
+        decoded->flags.reserve(order.size());
+        for(const auto index : order) {
+            decoded->addresses.push_back(rows.addresses[index]);
+            decoded->lines.push_back(rows.lines[index]);
+            decoded->columns.push_back(rows.columns[index]);
+            decoded->file_indices.push_back(rows.file_indices[index]);
+            decoded->flags.push_back(rows.flags[index]);
+        }
+        unit.decoded = std::move(decoded);
+        return unit.decoded.get();
+    }
+
+    /**
+     * This function returns the source location of the instruction at the specified address in the process.
+     * Only the compilation unit containing the address is decoded.
+     *
+     * @param address The address in the process
+     * @return        The location, no value when the address has no line information or an error
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto LineTable::find_location(std::intptr_t address) noexcept -> kstd::Result<std::optional<SourceLocation>> {
+        if(!_indexed) {
+            if(const auto result = build_index(); result.is_error()) {
+                return kstd::Error {result.get_error()};
+            }
+        }
+
+        const auto file_address = static_cast<kstd::u64>(address - _load_bias);
+        const auto find_range = [&]() -> const AddressRange* {
+            auto range = std::upper_bound(_ranges.cbegin(), _ranges.cend(), file_address,
+                                          [](auto value, const auto& element) { return value < element.begin; });
+            if(range == _ranges.cbegin() || file_address >= (--range)->end) {
+                return nullptr;
+            }
+            return &*range;
+        };
+
+        // The units without any known range can contain the address, so they are decoded on the first miss
+        const auto* range = find_range();
+        if(range == nullptr && !_unranged_units.empty()) {
+            if(const auto result = index_unranged_units(); result.is_error()) {
+                return kstd::Error {result.get_error()};
+            }
+            range = find_range();
+        }
+
+        if(range == nullptr) {
+            return {std::optional<SourceLocation> {}};
+        }
+
+        auto& unit = _units[range->unit_index];
+        const auto decoded = decode_unit(unit);
+        if(decoded.is_error()) {
+            return kstd::Error {decoded.get_error()};
+        }
+
+        // The last row at or before the address describes the instruction, unless it ends a sequence
+        const auto& rows = *decoded.get();
+        const auto row = std::upper_bound(rows.addresses.cbegin(), rows.addresses.cend(), file_address);
+        if(row == rows.addresses.cbegin()) {
+            return {std::optional<SourceLocation> {}};
+        }
+
+        const auto index = static_cast<std::size_t>(row - rows.addresses.cbegin()) - 1;
+        if((rows.flags[index] & row_end_sequence) != 0) {
+            return {std::optional<SourceLocation> {}};
+        }
+
+        const auto file_index = rows.file_indices[index];
+        const auto file = file_index < unit.files.size() ? std::string_view {unit.files[file_index]} : "";
+        return {std::optional<SourceLocation> {SourceLocation {file, rows.lines[index], rows.columns[index]}}};
+    }
+
+    /**
+     * This function returns the addresses of the statements at the specified line in the process. The file is
+     * matched by its path or the end of its path, when the line has no code the next line with code is used.
+     * Only the compilation units referencing the file are decoded.
+     *
+     * @param file The path of the source file
+     * @param line The line in the file
+     * @return     The addresses or an error
+     * @author     Cedric Hammes
+     * @since      16/10/2026
+     */
+    auto LineTable::find_addresses(std::string_view file, kstd::u32 line) noexcept
+            -> kstd::Result<std::vector<std::intptr_t>> {
+        if(!_indexed) {
+            if(const auto result = build_index(); result.is_error()) {
+                return kstd::Error {result.get_error()};
+            }
+        }
+
+        const auto matches_file = [file](std::string_view path) {
+            return path == file || (path.size() > file.size() && path.ends_with(file) &&
+                                    path[path.size() - file.size() - 1] == '/');
+        };
+
+        auto best_line = std::numeric_limits<kstd::u32>::max();
+        std::vector<std::intptr_t> addresses {};
+        for(auto& unit : _units) {
+            if(const auto result = read_files(unit); result.is_error()) {
+                return kstd::Error {result.get_error()};
+            }
+
+            std::vector<bool> file_matches(unit.files.size(), false);
+            std::transform(unit.files.cbegin(), unit.files.cend(), file_matches.begin(), matches_file);
+            if(std::find(file_matches.cbegin(), file_matches.cend(), true) == file_matches.cend()) {
+                continue;
+            }
+
+            const auto decoded = decode_unit(unit);
+            if(decoded.is_error()) {
+                return kstd::Error {decoded.get_error()};
+            }
+
+            // Only the first row of every run of rows with the same line is a location for a breakpoint
+            const auto& rows = *decoded.get();
+            for(std::size_t row = 0; row < rows.addresses.size(); ++row) {
+                const auto file_index = rows.file_indices[row];
+                const auto row_line = rows.lines[row];
+                if(rows.flags[row] != row_is_statement || file_index >= file_matches.size() ||
+                   !file_matches[file_index] || row_line < line || row_line > best_line) {
+                    continue;
+                }
+
+                if(row > 0 && (rows.flags[row - 1] & row_end_sequence) == 0 && rows.lines[row - 1] == row_line &&
+                   rows.file_indices[row - 1] == file_index) {
+                    continue;
+                }
+
+                if(row_line < best_line) {
+                    best_line = row_line;
+                    addresses.clear();
+                }
+                addresses.push_back(static_cast<std::intptr_t>(rows.addresses[row]) + _load_bias);
+            }
+        }
+
+        std::sort(addresses.begin(), addresses.end());
+        addresses.erase(std::unique(addresses.begin(), addresses.end()), addresses.end());
+        return addresses;
+    }
+}// namespace libdebug
+#endif
\ No newline at end of file
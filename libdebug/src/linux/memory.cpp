@@ -0,0 +1,314 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#ifdef PLATFORM_LINUX
+#include "libdebug/process.hpp"
+#include <algorithm>
+#include <climits>
+#include <fcntl.h>
+#include <sys/uio.h>
+
+namespace libdebug {
+    namespace {
+        /**
+         * This function transfers the specified segments between the debugger and the target process. The segments are
+         * transferred in batches of IOV_MAX with process_vm_readv/process_vm_writev. When the kernel stops at a
+         * segment (e.g. because the page is not writable), the segment is transferred through /proc/pid/mem and the
+         * batching continues with the following segments.
+         *
+         * @param process_id      The pid of the target process
+         * @param local_segments  The segments in the debugger
+         * @param remote_segments The segments in the target process
+         * @param write           Whether to write to or read from the target process
+         * @param memory_handle   Callback returning the handle to /proc/pid/mem
+         * @return                Void or an error
+         * @author                Cedric Hammes
+         * @since                 16/10/2026
+         */
+        template<typename F>
+        auto transfer_memory(platform::TaskId process_id, std::vector<iovec>& local_segments,
+                             std::vector<iovec>& remote_segments, bool write, F&& memory_handle) noexcept
+                -> kstd::Result<void> {
+            const auto segment_count = local_segments.size();
+            std::size_t index = 0;
+            while(index < segment_count) {
+                const auto batch_end = std::min<std::size_t>(index + IOV_MAX, segment_count);
+                const auto batch_size = static_cast<unsigned long>(batch_end - index);
+                auto transferred = write ? ::process_vm_writev(process_id, &local_segments[index], batch_size,
+                                                               &remote_segments[index], batch_size, 0)
+                                         : ::process_vm_readv(process_id, &local_segments[index], batch_size,
+                                                              &remote_segments[index], batch_size, 0);
+                if(transferred < 0) {
+                    if(errno != EFAULT && errno != EPERM && errno != ENOSYS) {
+                        return kstd::Error {fmt::format("Unable to {} memory of {}: {}", write ? "write" : "read",
+                                                        process_id, platform::get_last_error())};
+                    }
+                    transferred = 0;
+                }
+
+                // Skip all fully transferred segments and shrink a partially transferred segment
+                auto remaining = static_cast<std::size_t>(transferred);
+                while(index < batch_end && remaining >= local_segments[index].iov_len) {
+                    remaining -= local_segments[index].iov_len;
+                    ++index;
+                }
+
+                if(index == batch_end) {
+                    continue;
+                }
+
+                auto& local_segment = local_segments[index];
+                auto& remote_segment = remote_segments[index];
+                local_segment.iov_base = static_cast<kstd::u8*>(local_segment.iov_base) + remaining;
+                local_segment.iov_len -= remaining;
+                remote_segment.iov_base = static_cast<kstd::u8*>(remote_segment.iov_base) + remaining;
+                remote_segment.iov_len -= remaining;
+
+                // Transfer the failed segment through /proc/pid/mem, which ignores the page protection
+                const auto handle = memory_handle();
+                if(handle.is_error()) {
+                    return kstd::Error {handle.get_error()};
+                }
+
+                auto* buffer = static_cast<kstd::u8*>(local_segment.iov_base);
+                auto address = reinterpret_cast<std::uintptr_t>(remote_segment.iov_base);
+                auto size = local_segment.iov_len;
+                while(size > 0) {
+                    const auto result = write ? ::pwrite(handle.get(), buffer, size, static_cast<off_t>(address))
+                                              : ::pread(handle.get(), buffer, size, static_cast<off_t>(address));
+                    if(result <= 0) {
+                        if(result < 0 && errno == EINTR) {
+                            continue;
+                        }
+                        return kstd::Error {fmt::format("Unable to {} memory of {} at {:#x}: {}",
+                                                        write ? "write" : "read", process_id, address,
+                                                        result == 0 ? "End of memory" : platform::get_last_error())};
+                    }
+
+                    buffer += result;
+                    address += result;
+                    size -= result;
+                }
+                ++index;
+            }
+            return {};
+        }
+    }// namespace
+
+    /**
+     * This function returns the handle to /proc/pid/mem of the process. The handle is opened on the first call.
+     *
+     * @return The handle or an error
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto ProcessContext::get_memory_handle() noexcept -> kstd::Result<platform::FileHandle> {
+        if(!_memory_handle.is_valid()) {
+            const auto handle = ::open(fmt::format("/proc/{}/mem", _process_id).c_str(), O_RDWR | O_CLOEXEC);
+            if(handle < 0) {
+                return kstd::Error {
+                        fmt::format("Unable to open memory of {}: {}", _process_id, platform::get_last_error())};
+            }
+            _memory_handle = platform::OwnedHandle {handle};
+        }
+        return _memory_handle.get();
+    }
+
+    /**
+     * This function returns the memory map of the process. The map is invalidated when a thread is resumed and
+     * only refreshed when it is requested, so it is read at most once per stop.
+     *
+     * @return The memory map or an error
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto ProcessContext::get_memory_map() noexcept -> kstd::Result<const MemoryMap*> {
+        if(_memory_map.is_stale()) {
+            if(const auto result = _memory_map.refresh(_process_id); result.is_error()) {
+                return kstd::Error {result.get_error()};
+            }
+        }
+        return &_memory_map;
+    }
+
+    /**
+     * This function reads the memory at the specified address of the process into the specified buffer. Readable
+     * memory is copied with a single process_vm_readv call, other memory is read through /proc/pid/mem.
+     *
+     * @param address The address of the memory
+     * @param buffer  The buffer to read into
+     * @return        Void or an error
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto ProcessContext::read_memory(std::intptr_t address, std::span<kstd::u8> buffer) noexcept
+            -> kstd::Result<void> {
+        const MemoryReadRequest request {address, buffer};
+        return read_memory({&request, 1});
+    }
+
+    /**
+     * This function performs all specified memory reads with as few process_vm_readv calls as possible. Small reads
+     * are served from the memory cache, pages missing in the cache are fetched together. While any thread is running,
+     * the cache is bypassed.
+     *
+     * @param requests The reads to perform
+     * @return         Void or an error
+     * @author         Cedric Hammes
+     * @since          16/10/2026
+     */
+    auto ProcessContext::read_memory(std::span<const MemoryReadRequest> requests) noexcept -> kstd::Result<void> {
+        // Running threads can modify the memory at any time, so cached pages could be outdated
+        if(_running_thread_count != 0) {
+            return read_memory_uncached(requests);
+        }
+
+        // Reads over this size are bulk transfers (like dumps), which would only evict the working set of the cache
+        constexpr auto cache_size_limit = 16 * MemoryCache::page_size;
+
+        // Look up all pages of the small reads and collect the missing pages
+        std::vector<MemoryReadRequest> direct_requests {};
+        std::vector<MemoryReadRequest> page_requests {};
+        std::vector<const MemoryCache::Page*> pages {};
+        for(const auto& request : requests) {
+            if(request.buffer.empty()) {
+                continue;
+            }
+
+            if(request.buffer.size() > cache_size_limit) {
+                direct_requests.push_back(request);
+                continue;
+            }
+
+            const auto end_address = request.address + static_cast<std::intptr_t>(request.buffer.size());
+            for(auto page_address = MemoryCache::get_page_address(request.address); page_address < end_address;
+                page_address += MemoryCache::page_size) {
+                auto* page = _memory_cache.find_page(page_address);
+                if(page == nullptr) {
+                    auto& new_page = _memory_cache.insert_page(page_address);
+                    page_requests.push_back({page_address, new_page});
+                    page = &new_page;
+                }
+                pages.push_back(page);
+            }
+        }
+
+        // Fetch missing pages. When a page is not fully readable, the small reads are performed without the cache.
+        if(!page_requests.empty() && read_memory_uncached(page_requests).is_error()) {
+            for(const auto& page_request : page_requests) {
+                _memory_cache.invalidate(page_request.address, MemoryCache::page_size);
+            }
+
+            direct_requests.clear();
+            direct_requests.insert(direct_requests.end(), requests.begin(), requests.end());
+            return read_memory_uncached(direct_requests);
+        }
+
+        // Copy the small reads out of the cached pages
+        auto page = pages.cbegin();
+        for(const auto& request : requests) {
+            if(request.buffer.empty() || request.buffer.size() > cache_size_limit) {
+                continue;
+            }
+
+            auto address = request.address;
+            auto buffer = request.buffer;
+            while(!buffer.empty()) {
+                const auto page_offset = static_cast<std::size_t>(address - MemoryCache::get_page_address(address));
+                const auto size = std::min(buffer.size(), MemoryCache::page_size - page_offset);
+                std::copy_n((*page)->cbegin() + static_cast<std::ptrdiff_t>(page_offset), size, buffer.begin());
+                buffer = buffer.subspan(size);
+                address += static_cast<std::intptr_t>(size);
+                ++page;
+            }
+        }
+        return read_memory_uncached(direct_requests);
+    }
+
+    /**
+     * This function performs all specified memory reads with as few process_vm_readv calls as possible, without
+     * using the memory cache.
+     *
+     * @param requests The reads to perform
+     * @return         Void or an error
+     * @author         Cedric Hammes
+     * @since          16/10/2026
+     */
+    auto ProcessContext::read_memory_uncached(std::span<const MemoryReadRequest> requests) noexcept
+            -> kstd::Result<void> {
+        std::vector<iovec> local_segments {};
+        std::vector<iovec> remote_segments {};
+        local_segments.reserve(requests.size());
+        remote_segments.reserve(requests.size());
+        for(const auto& request : requests) {
+            if(request.buffer.empty()) {
+                continue;
+            }
+            local_segments.push_back({request.buffer.data(), request.buffer.size()});
+            remote_segments.push_back({reinterpret_cast<void*>(request.address), request.buffer.size()});
+        }
+        return transfer_memory(_process_id, local_segments, remote_segments, false,
+                               [this]() { return get_memory_handle(); });
+    }
+
+    /**
+     * This function writes the specified data into the memory of the process at the specified address. Writable
+     * memory is written with a single process_vm_writev call, read-only memory (like text pages) is written
+     * through /proc/pid/mem.
+     *
+     * @param address The address of the memory
+     * @param data    The data to write
+     * @return        Void or an error
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto ProcessContext::write_memory(std::intptr_t address, std::span<const kstd::u8> data) noexcept
+            -> kstd::Result<void> {
+        const MemoryWriteRequest request {address, data};
+        return write_memory({&request, 1});
+    }
+
+    /**
+     * This function performs all specified memory writes with as few process_vm_writev calls as possible.
+     *
+     * @param requests The writes to perform
+     * @return         Void or an error
+     * @author         Cedric Hammes
+     * @since          16/10/2026
+     */
+    auto ProcessContext::write_memory(std::span<const MemoryWriteRequest> requests) noexcept -> kstd::Result<void> {
+        std::vector<iovec> local_segments {};
+        std::vector<iovec> remote_segments {};
+        local_segments.reserve(requests.size());
+        remote_segments.reserve(requests.size());
+        for(const auto& request : requests) {
+            if(request.data.empty()) {
+                continue;
+            }
+            _memory_cache.invalidate(request.address, request.data.size());
+
+            // process_vm_writev doesn't modify the local buffer, the cast is only required by the iovec structure
+            local_segments.push_back({const_cast<kstd::u8*>(request.data.data()), request.data.size()});// NOLINT
+            remote_segments.push_back({reinterpret_cast<void*>(request.address), request.data.size()});
+        }
+        return transfer_memory(_process_id, local_segments, remote_segments, true,
+                               [this]() { return get_memory_handle(); });
+    }
+}// namespace libdebug
+#endif
\ No newline at end of file
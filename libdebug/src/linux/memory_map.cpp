@@ -0,0 +1,183 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#ifdef PLATFORM_LINUX
+#include "libdebug/memory_map.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace libdebug {
+    MemoryMap::MemoryMap() noexcept ://NOLINT
+            _buffer {},
+            _next_buffer {},
+            _region_begins {},
+            _regions {},
+            _stale {true} {
+    }
+
+    /**
+     * This function reads the memory map of the specified process. Regions in front of the first change since
+     * the last refresh are kept without parsing them again.
+     *
+     * @param process_id The id of the process
+     * @return           Void or an error
+     * @author           Cedric Hammes
+     * @since            16/10/2026
+     */
+    auto MemoryMap::refresh(platform::TaskId process_id) noexcept -> kstd::Result<void> {
+        const auto path = fmt::format("/proc/{}/maps", process_id);
+        const platform::OwnedHandle file {::open(path.c_str(), O_RDONLY | O_CLOEXEC)};
+        if(!file.is_valid()) {
+            return kstd::Error {fmt::format("Unable to read memory map: {}", platform::get_last_error())};
+        }
+
+        // The buffer is sized for the previous map, so a map of the same size is read without growing the buffer
+        std::size_t size = 0;
+        _next_buffer.resize(std::max<std::size_t>(_buffer.size() + 4096, 65536));
+        while(true) {
+            const auto result = ::read(file.get(), _next_buffer.data() + size, _next_buffer.size() - size);
+            if(result < 0) {
+                return kstd::Error {fmt::format("Unable to read memory map: {}", platform::get_last_error())};
+            }
+
+            if(result == 0) {
+                break;
+            }
+
+            size += static_cast<std::size_t>(result);
+            if(size == _next_buffer.size()) {
+                _next_buffer.resize(_next_buffer.size() * 2);
+            }
+        }
+        _next_buffer.resize(size);
+
+        // Only the regions whose line is completely in front of the first changed byte are kept
+        const auto common_size = std::min(_buffer.size(), _next_buffer.size());
+        const auto first_change = static_cast<std::size_t>(
+                std::mismatch(_buffer.cbegin(), _buffer.cbegin() + static_cast<std::ptrdiff_t>(common_size),
+                              _next_buffer.cbegin())
+                        .first -
+                _buffer.cbegin());
+        const auto changed = first_change != _buffer.size() || _buffer.size() != _next_buffer.size();
+        while(changed && !_regions.empty() && _regions.back().line_end > first_change) {
+            _regions.pop_back();
+            _region_begins.pop_back();
+        }
+
+        std::swap(_buffer, _next_buffer);
+        _stale = false;
+        if(!changed) {
+            return {};
+        }
+        return parse_regions(_regions.empty() ? 0 : _regions.back().line_end);
+    }
+
+    /**
+     * This function parses the lines of the buffer starting at the specified offset and appends their regions. The
+     * fields are parsed in-place, so no memory is allocated per line.
+     *
+     * @param offset The offset of the first line
+     * @return       Void or an error
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    auto MemoryMap::parse_regions(std::size_t offset) noexcept -> kstd::Result<void> {
+        const auto* const buffer_begin = _buffer.data();
+        const auto* const buffer_end = buffer_begin + _buffer.size();
+        const auto skip_field = [](const char* cursor, const char* line_end) {
+            cursor = std::find(cursor, line_end, ' ');
+            return std::find_if(cursor, line_end, [](auto character) { return character != ' '; });
+        };
+
+        for(const auto* line = buffer_begin + offset; line < buffer_end;) {
+            const auto* line_end = std::find(line, buffer_end, '\n');
+
+            // Every line has the format "begin-end permissions offset device inode path"
+            std::uintptr_t begin = 0;
+            Region region {};
+            const auto begin_result = std::from_chars(line, line_end, begin, 16);
+            const auto end_result = begin_result.ptr < line_end && *begin_result.ptr == '-'
+                                            ? std::from_chars(begin_result.ptr + 1, line_end, region.end, 16)
+                                            : std::from_chars_result {line_end, std::errc::invalid_argument};
+            const auto* permissions = end_result.ptr + 1;
+            const auto offset_result = end_result.ec == std::errc {} && line_end - end_result.ptr > 6
+                                               ? std::from_chars(permissions + 5, line_end, region.offset, 16)
+                                               : std::from_chars_result {line_end, std::errc::invalid_argument};
+            if(begin_result.ec != std::errc {} || offset_result.ec != std::errc {}) {
+                return kstd::Error {
+                        fmt::format("Unable to read memory map: Line at {} is invalid", line - buffer_begin)};
+            }
+
+            region.permissions = (permissions[0] == 'r' ? static_cast<kstd::u8>(MemoryPermission::READ) : 0) |
+                                 (permissions[1] == 'w' ? static_cast<kstd::u8>(MemoryPermission::WRITE) : 0) |
+                                 (permissions[2] == 'x' ? static_cast<kstd::u8>(MemoryPermission::EXECUTE) : 0) |
+                                 (permissions[3] == 's' ? static_cast<kstd::u8>(MemoryPermission::SHARED) : 0);
+
+            // The path is the rest of the line after the device and the inode
+            const auto* path = skip_field(skip_field(skip_field(offset_result.ptr, line_end), line_end), line_end);
+            region.path_offset = static_cast<kstd::u32>(path - buffer_begin);
+            region.path_size = static_cast<kstd::u32>(line_end - path);
+            line = line_end == buffer_end ? line_end : line_end + 1;
+            region.line_end = static_cast<kstd::u32>(line - buffer_begin);
+            _region_begins.push_back(begin);
+            _regions.push_back(region);
+        }
+        return {};
+    }
+
+    /**
+     * This function returns the region containing the specified address.
+     *
+     * @param address The address
+     * @return        The region or no value, when the address is not mapped
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto MemoryMap::find_region(std::intptr_t address) const noexcept -> std::optional<MemoryRegion> {
+        const auto unsigned_address = static_cast<std::uintptr_t>(address);
+        const auto begin = std::upper_bound(_region_begins.cbegin(), _region_begins.cend(), unsigned_address);
+        if(begin == _region_begins.cbegin()) {
+            return {};
+        }
+
+        const auto index = static_cast<std::size_t>(begin - _region_begins.cbegin()) - 1;
+        if(unsigned_address >= _regions[index].end) {
+            return {};
+        }
+        return get_region(index);
+    }
+
+    /**
+     * This function returns the region at the specified index, the regions are sorted by address.
+     *
+     * @param index The index of the region
+     * @return      The region
+     * @author      Cedric Hammes
+     * @since       16/10/2026
+     */
+    auto MemoryMap::get_region(std::size_t index) const noexcept -> MemoryRegion {
+        const auto& region = _regions[index];
+        return {static_cast<std::intptr_t>(_region_begins[index]), static_cast<std::intptr_t>(region.end),
+                region.offset, region.permissions, {_buffer.data() + region.path_offset, region.path_size}};
+    }
+}// namespace libdebug
+#endif
\ No newline at end of file
@@ -19,8 +19,110 @@
 
 #ifdef PLATFORM_LINUX
 #include "libdebug/platform/platform.hpp"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <utility>
 
 namespace libdebug::platform {
+    OwnedHandle::OwnedHandle() noexcept ://NOLINT
+            _handle {-1} {
+    }
+
+    OwnedHandle::OwnedHandle(FileHandle handle) noexcept ://NOLINT
+            _handle {handle} {
+    }
+
+    OwnedHandle::~OwnedHandle() noexcept {
+        if(is_valid()) {
+            ::close(_handle);
+        }
+    }
+
+    OwnedHandle::OwnedHandle(OwnedHandle&& other) noexcept ://NOLINT
+            _handle {std::exchange(other._handle, -1)} {
+    }
+
+    auto OwnedHandle::operator=(OwnedHandle&& other) noexcept -> OwnedHandle& {
+        if(this != &other) {
+            if(is_valid()) {
+                ::close(_handle);
+            }
+            _handle = std::exchange(other._handle, -1);
+        }
+        return *this;
+    }
+
+    auto OwnedHandle::is_valid() const noexcept -> bool {
+        return _handle >= 0;
+    }
+
+    FileMapping::FileMapping() noexcept ://NOLINT
+            _data {nullptr},
+            _size {0} {
+    }
+
+    FileMapping::FileMapping(const kstd::u8* data, std::size_t size) noexcept ://NOLINT
+            _data {data},
+            _size {size} {
+    }
+
+    FileMapping::~FileMapping() noexcept {
+        if(_data != nullptr) {
+            ::munmap(const_cast<kstd::u8*>(_data), _size);
+        }
+    }
+
+    FileMapping::FileMapping(FileMapping&& other) noexcept ://NOLINT
+            _data {std::exchange(other._data, nullptr)},
+            _size {std::exchange(other._size, 0)} {
+    }
+
+    auto FileMapping::operator=(FileMapping&& other) noexcept -> FileMapping& {
+        if(this != &other) {
+            if(_data != nullptr) {
+                ::munmap(const_cast<kstd::u8*>(_data), _size);
+            }
+            _data = std::exchange(other._data, nullptr);
+            _size = std::exchange(other._size, 0);
+        }
+        return *this;
+    }
+
+    /**
+     * This function maps the whole specified file read-only into the memory of the debugger. The pages are loaded
+     * by the operating system when they are accessed first.
+     *
+     * @param path The path to the file
+     * @return     The mapping of the file or an error
+     * @author     Cedric Hammes
+     * @since      16/10/2026
+     */
+    auto map_file(const std::filesystem::path& path) noexcept -> kstd::Result<FileMapping> {
+        using namespace std::string_literals;
+        const OwnedHandle file {::open(path.c_str(), O_RDONLY | O_CLOEXEC)};
+        if(!file.is_valid()) {
+            return kstd::Error {fmt::format("Unable to map {}: {}", path.string(), get_last_error())};
+        }
+
+        struct stat file_status {};
+        if(::fstat(file.get(), &file_status) < 0) {
+            return kstd::Error {fmt::format("Unable to map {}: {}", path.string(), get_last_error())};
+        }
+
+        if(file_status.st_size == 0) {
+            return kstd::Error {fmt::format("Unable to map {}: File is empty", path.string())};
+        }
+
+        // The mapping stays valid after the file is closed
+        const auto size = static_cast<std::size_t>(file_status.st_size);
+        auto* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file.get(), 0);
+        if(data == MAP_FAILED) {
+            return kstd::Error {fmt::format("Unable to map {}: {}", path.string(), get_last_error())};
+        }
+        return FileMapping {static_cast<const kstd::u8*>(data), size};
+    }
+
     /**
      * This method returns the last thrown error in this program. This is being used to print the error thrown by the
      * System API to the user.
@@ -0,0 +1,336 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#ifdef PLATFORM_LINUX
+#include "libdebug/platform/waiter.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <poll.h>
+#include <sys/signalfd.h>
+#include <sys/wait.h>
+#include <vector>
+
+namespace libdebug::platform {
+    /**
+     * This function returns a thread of this application, which doesn't block the specified signal. The blocked
+     * signals are read from the status of each thread.
+     *
+     * @param signal The signal
+     * @return       The id of the thread, no value when all threads block the signal
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    static auto find_unblocking_thread(int signal) noexcept -> std::optional<TaskId> {
+        std::error_code error {};
+        for(const auto& task_dir : std::filesystem::directory_iterator {"/proc/self/task", error}) {
+            std::ifstream status_file {task_dir.path() / "status"};
+            for(std::string line {}; std::getline(status_file, line);) {
+                if(!line.starts_with("SigBlk:")) {
+                    continue;
+                }
+
+                const auto blocked_signals = std::strtoull(line.c_str() + 7, nullptr, 16);
+                if((blocked_signals & (1ULL << (signal - 1))) == 0) {
+                    return std::stoi(task_dir.path().filename().c_str());
+                }
+                break;
+            }
+        }
+        return {};
+    }
+
+    TaskWaiter::TaskWaiter() ://NOLINT
+            _signal_handle {-1},
+            _tasks {},
+            _pending_statuses {} {
+    }
+
+    TaskWaiter::~TaskWaiter() noexcept {
+        if(_signal_handle >= 0) {
+            ::close(_signal_handle);
+        }
+    }
+
+    /**
+     * This function returns the process-wide instance of the task waiter. It is created on the first call.
+     *
+     * @return The task waiter instance
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto TaskWaiter::get_instance() -> TaskWaiter& {
+        static TaskWaiter s_instance {};
+        return s_instance;
+    }
+
+    /**
+     * This function sets up the waiter. SIGCHLD is blocked in the calling thread and the signalfd is created. SIGCHLD
+     * has to be blocked in all other threads of the application before, otherwise an error is returned. The setup can
+     * be repeated after a failure, it does nothing after a successful setup.
+     *
+     * @return Void or an error
+     * @author Cedric Hammes
+     * @since  17/10/2026
+     */
+    auto TaskWaiter::setup() noexcept -> kstd::Result<void> {
+        if(_signal_handle >= 0) {
+            return {};
+        }
+
+        // Block SIGCHLD, so it stays pending for the signalfd instead of being delivered
+        sigset_t signal_set {};
+        ::sigemptyset(&signal_set);
+        ::sigaddset(&signal_set, SIGCHLD);
+        if(::pthread_sigmask(SIG_BLOCK, &signal_set, nullptr) != 0) {
+            return kstd::Error {fmt::format("Unable to set up task waiter: Unable to block SIGCHLD: {}",
+                                            get_last_error())};
+        }
+
+        // A thread which doesn't block SIGCHLD consumes the signal, so the signalfd would never get readable
+        if(const auto thread_id = find_unblocking_thread(SIGCHLD); thread_id.has_value()) {
+            return kstd::Error {fmt::format("Unable to set up task waiter: SIGCHLD is not blocked in thread {}, it has "
+                                            "to be blocked before starting threads",
+                                            *thread_id)};
+        }
+
+        _signal_handle = ::signalfd(-1, &signal_set, SFD_NONBLOCK | SFD_CLOEXEC);
+        if(_signal_handle < 0) {
+            return kstd::Error {fmt::format("Unable to set up task waiter: Unable to create signalfd: {}",
+                                            get_last_error())};
+        }
+        return {};
+    }
+
+    /**
+     * This function blocks until a task accepted by the specified filter changes its state or the timeout is
+     * elapsed. No CPU time is consumed while waiting.
+     *
+     * @param filter  The filter selecting the tasks of the caller
+     * @param timeout The maximum time to wait, or no value to wait infinitely
+     * @return        The status of the task, no value when the timeout is elapsed or an error
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto TaskWaiter::wait(const TaskFilter& filter, std::optional<std::chrono::milliseconds> timeout) noexcept
+            -> kstd::Result<std::optional<TaskStatus>> {
+        using namespace std::chrono;
+        using namespace std::string_literals;
+        const auto deadline = steady_clock::now() + timeout.value_or(milliseconds::zero());
+
+        while(true) {
+            // Collect all available statuses before sleeping, SIGCHLD may have been consumed by an earlier call
+            if(const auto collect_result = collect(); collect_result.is_error()) {
+                return kstd::Error {collect_result.get_error()};
+            }
+
+            const auto status = std::find_if(_pending_statuses.cbegin(), _pending_statuses.cend(),
+                                             [&](const auto& pending) { return filter(pending.task_id); });
+            if(status != _pending_statuses.cend()) {
+                const auto task_status = *status;
+                _pending_statuses.erase(status);
+                return {task_status};
+            }
+
+            // No task is traced anymore, so no state change can arrive. Callers check their own tasks, so the registry
+            // isn't scanned on every wait.
+            if(_tasks.empty()) {
+                return kstd::Error {"Unable to wait for task status: No task is traced"s};
+            }
+
+            // Calculate remaining time and sleep until SIGCHLD is pending or the timeout is elapsed
+            auto remaining_time = -1;
+            if(timeout.has_value()) {
+                remaining_time = static_cast<int>(
+                        std::max<milliseconds::rep>(duration_cast<milliseconds>(deadline - steady_clock::now()).count(),
+                                                    0));
+                if(remaining_time == 0) {
+                    return {std::optional<TaskStatus> {}};
+                }
+            }
+
+            pollfd poll_handle {_signal_handle, POLLIN, 0};
+            if(::poll(&poll_handle, 1, remaining_time) < 0 && errno != EINTR) {
+                return kstd::Error {fmt::format("Unable to wait for task status: {}", get_last_error())};
+            }
+
+        }
+    }
+
+    /**
+     * This function registers the specified traced task, so its state changes are reaped by the waiter. Tasks are
+     * unregistered automatically after their exit was reaped.
+     *
+     * @param task_id The id of the task
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto TaskWaiter::add_task(TaskId task_id) noexcept -> void {
+        _tasks.insert(task_id);
+    }
+
+    /**
+     * This function unregisters the specified task, like after it was detached. The pending statuses of the task are
+     * discarded.
+     *
+     * @param task_id The id of the task
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto TaskWaiter::remove_task(TaskId task_id) noexcept -> void {
+        _tasks.erase(task_id);
+        std::erase_if(_pending_statuses, [&](const auto& pending) { return pending.task_id == task_id; });
+    }
+
+    /**
+     * This function reaps all state changes of the registered tasks which are currently available without blocking
+     * and appends them to the pending statuses. The cost scales with the count of state changes, not with the count of
+     * registered tasks. This also resets the readiness of the signalfd.
+     *
+     * @return The count of collected statuses or an error
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto TaskWaiter::collect() noexcept -> kstd::Result<std::size_t> {
+        using namespace std::string_literals;
+        if(_signal_handle < 0) {
+            return kstd::Error {"Unable to collect task status: Task waiter is not set up"s};
+        }
+
+        // Drain signalfd before reaping, all state changes are acquired by waitpid
+        signalfd_siginfo signal_info {};
+        while(::read(_signal_handle, &signal_info, sizeof(signal_info)) > 0) {
+        }
+
+        // The next available state change is peeked without reaping it and only reaped when it belongs to a registered
+        // task, so the cost scales with the count of state changes and the statuses of other children of the
+        // application aren't stolen
+        std::size_t collected_statuses = 0;
+        while(true) {
+            siginfo_t signal_info {};
+            if(::waitid(P_ALL, 0, &signal_info, WEXITED | WSTOPPED | WNOHANG | WNOWAIT | __WALL) < 0) {
+                if(errno == EINTR) {
+                    continue;
+                }
+                if(errno == ECHILD) {
+                    break;
+                }
+                return kstd::Error {fmt::format("Unable to collect task status: {}", get_last_error())};
+            }
+
+            if(signal_info.si_pid == 0) {
+                break;
+            }
+
+            // The pending status of another child hides all statuses behind it until the application reaps it, so the
+            // registered tasks are reaped one by one meanwhile
+            if(!_tasks.contains(signal_info.si_pid)) {
+                const auto scanned_statuses = collect_registered();
+                if(scanned_statuses.is_error()) {
+                    return kstd::Error {scanned_statuses.get_error()};
+                }
+                return collected_statuses + scanned_statuses.get();
+            }
+
+            const auto reaped_status = reap(signal_info.si_pid);
+            if(reaped_status.is_error()) {
+                return kstd::Error {reaped_status.get_error()};
+            }
+            collected_statuses += reaped_status.get() ? 1 : 0;
+        }
+        return collected_statuses;
+    }
+
+    /**
+     * This function reaps the state change of the specified registered task, when one is available, and appends it to
+     * the pending statuses. Tasks which exited or which aren't traced anymore are unregistered.
+     *
+     * @param task_id The id of the task
+     * @return        Whether a status was reaped or an error
+     * @author        Cedric Hammes
+     * @since         17/10/2026
+     */
+    auto TaskWaiter::reap(TaskId task_id) noexcept -> kstd::Result<bool> {
+        int status = 0;
+        auto reaped_task_id = ::waitpid(task_id, &status, WNOHANG | __WALL);
+        while(reaped_task_id < 0 && errno == EINTR) {
+            reaped_task_id = ::waitpid(task_id, &status, WNOHANG | __WALL);
+        }
+
+        if(reaped_task_id < 0 && errno != ECHILD) {
+            return kstd::Error {fmt::format("Unable to collect task status: {}", get_last_error())};
+        }
+
+        if(reaped_task_id > 0) {
+            _pending_statuses.push_back({reaped_task_id, status});
+        }
+
+        // Exited tasks and tasks which aren't traced anymore never change their state again
+        if(reaped_task_id < 0 || (reaped_task_id > 0 && (WIFEXITED(status) || WIFSIGNALED(status)))) {
+            _tasks.erase(task_id);
+        }
+        return reaped_task_id > 0;
+    }
+
+    /**
+     * This function reaps the available state changes of all registered tasks one by one. This is only used while the
+     * status of another child of the application hides the statuses of the registered tasks.
+     *
+     * @return The count of collected statuses or an error
+     * @author Cedric Hammes
+     * @since  17/10/2026
+     */
+    auto TaskWaiter::collect_registered() noexcept -> kstd::Result<std::size_t> {
+        // The tasks are copied, because reaping unregisters exited tasks
+        const std::vector<TaskId> tasks {_tasks.cbegin(), _tasks.cend()};
+        std::size_t collected_statuses = 0;
+        for(const auto task_id : tasks) {
+            const auto reaped_status = reap(task_id);
+            if(reaped_status.is_error()) {
+                return kstd::Error {reaped_status.get_error()};
+            }
+            collected_statuses += reaped_status.get() ? 1 : 0;
+        }
+        return collected_statuses;
+    }
+
+    /**
+     * This function removes all pending statuses of tasks accepted by the specified filter.
+     *
+     * @param filter The filter selecting the discarded tasks
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    auto TaskWaiter::discard(const TaskFilter& filter) noexcept -> void {
+        std::erase_if(_pending_statuses, [&](const auto& pending) { return filter(pending.task_id); });
+    }
+
+    /**
+     * This function appends the specified status to the pending statuses, so it is returned by a later wait.
+     * This is used to hand back statuses which were consumed by an internal wait of the caller.
+     *
+     * @param task_status The status to hand back
+     * @author            Cedric Hammes
+     * @since             16/10/2026
+     */
+    auto TaskWaiter::push(const TaskStatus& task_status) noexcept -> void {
+        _pending_statuses.push_back(task_status);
+    }
+}// namespace libdebug::platform
+#endif
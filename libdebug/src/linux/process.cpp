@@ -19,102 +19,186 @@
 
 #ifdef PLATFORM_LINUX
 #include "libdebug/process.hpp"
+#include "libdebug/cache.hpp"
+#include <algorithm>
+#include <fcntl.h>
+#include <cstddef>
+#include <fstream>
+#include <linux/audit.h>
+#include <linux/filter.h>
+#include <linux/seccomp.h>
+#include <sys/auxv.h>
+#include <sys/prctl.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace libdebug {
+    static constexpr auto trace_options = PTRACE_O_TRACECLONE | PTRACE_O_TRACEEXIT | PTRACE_O_TRACEEXEC |
+                                          PTRACE_O_TRACEFORK | PTRACE_O_TRACEVFORK;
+    static constexpr auto syscall_trace_options = trace_options | PTRACE_O_TRACESECCOMP | PTRACE_O_TRACESYSGOOD;
+    static constexpr auto syscall_exit_signal = SIGTRAP | 0x80;
+
+#if defined(ARCH_X86_64)
+    static constexpr kstd::u32 audit_architecture = AUDIT_ARCH_X86_64;
+#elif defined(ARCH_ARM64)
+    static constexpr kstd::u32 audit_architecture = AUDIT_ARCH_AARCH64;
+#endif
+
     /**
-     * This constructor constructs an empty breakpoint with a reference to the context and the target address of the
-     * breakpoint.
+     * This function builds a seccomp filter program, which stops the process with a seccomp event at the specified
+     * syscalls and allows all other syscalls. Syscalls of other architectures (like the 32-bit ABI) are allowed,
+     * because their numbers differ.
      *
-     * @author Cedric Hammes
-     * @since  09/03/2024
+     * @param syscalls The numbers of the traced syscalls
+     * @return         The filter program or an error
+     * @author         Cedric Hammes
+     * @since          16/10/2026
      */
-    Breakpoint::Breakpoint(std::intptr_t target_address) noexcept ://NOLINT
-            _address {target_address},
-            _enabled {false},
-            _saved_data {} {
+    static auto build_syscall_filter(const std::vector<int>& syscalls) noexcept
+            -> kstd::Result<std::vector<sock_filter>> {
+        // Every comparison jumps forward to the trace instruction, so the count is limited by the 8-bit jump offset
+        constexpr std::size_t max_syscall_count = 255;
+        if(syscalls.size() > max_syscall_count) {
+            return kstd::Error {fmt::format("Unable to build syscall filter: {} syscalls exceed the limit of {}",
+                                            syscalls.size(), max_syscall_count)};
+        }
+
+        std::vector<sock_filter> filter {
+                BPF_STMT(BPF_LD | BPF_W | BPF_ABS, offsetof(seccomp_data, arch)),
+                BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, audit_architecture, 1, 0),
+                BPF_STMT(BPF_RET | BPF_K, SECCOMP_RET_ALLOW),
+                BPF_STMT(BPF_LD | BPF_W | BPF_ABS, offsetof(seccomp_data, nr))};
+        for(std::size_t index = 0; index < syscalls.size(); ++index) {
+            if(syscalls[index] < 0) {
+                return kstd::Error {fmt::format("Unable to build syscall filter: Invalid syscall {}", syscalls[index])};
+            }
+
+            const auto trace_offset = static_cast<kstd::u8>(syscalls.size() - index);
+            filter.push_back(BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, static_cast<kstd::u32>(syscalls[index]), trace_offset,
+                                      0));
+        }
+        filter.push_back(BPF_STMT(BPF_RET | BPF_K, SECCOMP_RET_ALLOW));
+        filter.push_back(BPF_STMT(BPF_RET | BPF_K, SECCOMP_RET_TRACE));
+        return filter;
     }
 
     /**
-     * This function enables the breakpoint by replacing the instruction at the specified address and saving the
-     * original data in this class.
+     * This function returns whether the specified thread is traced by this debugger, by reading the tracer from the
+     * status of the thread.
      *
-     * @return Void or an error
-     * @author Cedric Hammes
-     * @since  09/03/2024
+     * @param thread_id The id of the thread
+     * @return          Whether the thread is traced by this debugger
+     * @author          Cedric Hammes
+     * @since           16/10/2026
      */
-    auto Breakpoint::enable(const ThreadContext& thread_context) noexcept -> kstd::Result<void> {
-        using namespace std::string_literals;
-        const auto thread_id = thread_context.get_thread_id();
-        if(!platform::is_process_running(thread_id)) {
-            return kstd::Error {"Unable to enable breakpoint: No process is running"s};
-        }
-
-        // Read the data at the specified address and save instruction data
-        errno = 0;
-        const auto data = ::ptrace(PTRACE_PEEKDATA, thread_id, _address, nullptr);
-        if(data < 0 && errno != 0) {
-            return kstd::Error {fmt::format("Unable to enable breakpoint: {}", platform::get_last_error())};
+    static auto is_traced_by_debugger(platform::TaskId thread_id) noexcept -> bool {
+        std::ifstream status_file {fmt::format("/proc/{}/status", thread_id)};
+        for(std::string line {}; std::getline(status_file, line);) {
+            if(line.starts_with("TracerPid:")) {
+                return std::strtol(line.c_str() + 10, nullptr, 10) == ::getpid();
+            }
         }
+        return false;
+    }
 
-        // Replace instruction at address with interrupt instruction TODO: Different values for different architectures
-        const kstd::u64 instruction = 0xCC;
-        _saved_data = static_cast<kstd::u8>(data & 0xFF);
-        if(::ptrace(PTRACE_POKEDATA, thread_id, _address, (data & ~0xFF) | instruction) < 0) {
-            return kstd::Error {fmt::format("Unable to enable breakpoint: {}", platform::get_last_error())};
+    /**
+     * This function reads the entry point of the executable from the auxiliary vector of the specified process.
+     *
+     * @param process_id The id of the process
+     * @return           The entry point, no value when the entry point is unknown
+     * @author           Cedric Hammes
+     * @since            17/10/2026
+     */
+    static auto read_entry_address(platform::TaskId process_id) noexcept -> std::optional<std::intptr_t> {
+        std::ifstream auxv_stream {fmt::format("/proc/{}/auxv", process_id), std::ios::binary};
+        std::array<kstd::u64, 2> auxv_entry {};
+        while(auxv_stream.read(reinterpret_cast<char*>(auxv_entry.data()), sizeof(auxv_entry))) {
+            if(auxv_entry[0] == AT_ENTRY) {
+                return static_cast<std::intptr_t>(auxv_entry[1]);
+            }
         }
-
-        // Set breakpoint enabled
-        _enabled = true;
         return {};
     }
 
-
     /**
-     * This function disables the breakpoint by replacing the inserted instruction at the specified address with the
-     * original data saved.
+     * This function reads the identity of the executable image of the specified process.
      *
-     * @return Void or an error
-     * @author Cedric Hammes
-     * @since  09/03/2024
+     * @param process_id The id of the process
+     * @return           The identity of the image, no value when the image is unknown
+     * @author           Cedric Hammes
+     * @since            16/10/2026
      */
-    auto Breakpoint::disable(const ThreadContext& thread_context) noexcept -> kstd::Result<void> {
-        using namespace std::string_literals;
-        const auto thread_id = thread_context.get_thread_id();
-        if(!platform::is_process_running(thread_id)) {
-            return kstd::Error {"Unable to disable breakpoint: No process is running"s};
-        }
-
-        // Read the data at the specified address
-        errno = 0;
-        const auto data = ::ptrace(PTRACE_PEEKDATA, thread_id, _address, nullptr);
-        if(data < 0 && errno != 0) {
-            return kstd::Error {fmt::format("Unable to disable breakpoint: {}", platform::get_last_error())};
+    static auto read_image_identity(platform::TaskId process_id) noexcept -> std::optional<ImageIdentity> {
+        struct stat file_status {};
+        if(::stat(fmt::format("/proc/{}/exe", process_id).c_str(), &file_status) < 0) {
+            return {};
         }
 
-        // Remove interrupt instruction and insert restored data
-        if(::ptrace(PTRACE_POKEDATA, thread_id, _address, (data & ~0xFF) | _saved_data) < 0) {
-            return kstd::Error {fmt::format("Unable to disable breakpoint: {}", platform::get_last_error())};
+        const auto entry_address = read_entry_address(process_id);
+        if(!entry_address.has_value()) {
+            return {};
         }
-
-        // Set breakpoint disabled
-        _enabled = false;
-        return {};
+        return ImageIdentity {file_status.st_dev, file_status.st_ino, *entry_address};
     }
 
     /**
      * This constructor starts the specified path to the executable with the specified arguments in subprocess
-     * and attaches the debugger context to it.
+     * and attaches the debugger context to it. When syscalls are specified, the subprocess installs a seccomp
+     * filter before the executable is started, which only stops the process at the specified syscalls. Their
+     * entry and exit are dispatched to the event callbacks.
      *
-     * @param executable The path to the executable to debug
-     * @param arguments  The command-line arguments
-     * @author           Cedric Hammes
-     * @since            13/03/2024
+     * Children forked by the process inherit the filter, so they are kept traced and their syscalls are dispatched
+     * to the event callbacks too.
+     *
+     * @param executable      The path to the executable to debug
+     * @param arguments       The command-line arguments
+     * @param traced_syscalls The numbers of the syscalls to trace
+     * @author                Cedric Hammes
+     * @since                 13/03/2024
      */
     ProcessContext::ProcessContext(const std::filesystem::path& executable_path,
-                                   const std::vector<std::string>& arguments) ://NOLINT
-            _event_callbacks {},
+                                   const std::vector<std::string>& arguments,
+                                   const std::vector<int>& traced_syscalls) ://NOLINT
             _breakpoints {},
-            _threads {} {
+            _threads {},
+            _child_threads {},
+            _event_callbacks {},
+            _event_dispatcher {},
+            _memory_handle {},
+            _memory_cache {},
+            _memory_map {},
+            _scratch_pages {},
+            _stale_breakpoints {},
+            _dropped_breakpoints {},
+            _image_identity {},
+            _hardware_breakpoints {},
+            _executable_path {executable_path},
+            _symbols {},
+            _line_table {},
+            _call_frame_tables {},
+            _unwind_modules {},
+            _attach_latency {},
+            _is_seized {false},
+            _running_thread_count {0},
+            _traced_syscalls {traced_syscalls},
+            _tracepoints {},
+            _trace_buffer {},
+            _tracepoint_callback {} {
+        if(const auto result = platform::TaskWaiter::get_instance().setup(); result.is_error()) {
+            throw std::runtime_error {fmt::format("Unable to create debugged process: {}", result.get_error())};
+        }
+
+        // The filter is built before forking, so the child doesn't have to allocate it
+        std::vector<sock_filter> syscall_filter {};
+        if(!_traced_syscalls.empty()) {
+            auto filter = build_syscall_filter(_traced_syscalls);
+            if(filter.is_error()) {
+                throw std::runtime_error {fmt::format("Unable to create debugged process: {}", filter.get_error())};
+            }
+            syscall_filter = std::move(filter.get());
+        }
+        const sock_fprog syscall_program {static_cast<unsigned short>(syscall_filter.size()), syscall_filter.data()};
+
         const auto child_process_id = ::fork();
         if(child_process_id == 0) {
             ::personality(ADDR_NO_RANDOMIZE);
@@ -122,6 +206,16 @@ namespace libdebug {
                 exit(-1);
             }
 
+            // Filtered syscalls fail with ENOSYS until the debugger enabled seccomp stops, so the child waits for the
+            // debugger before installing the filter
+            if(!syscall_filter.empty()) {
+                ::raise(SIGSTOP);
+                if(::prctl(PR_SET_NO_NEW_PRIVS, 1, 0, 0, 0) < 0 ||
+                   ::prctl(PR_SET_SECCOMP, SECCOMP_MODE_FILTER, &syscall_program) < 0) {
+                    exit(-1);
+                }
+            }
+
             std::ostringstream joined_args {};
             joined_args << executable_path;
             std::copy(arguments.cbegin(), arguments.cend(), std::ostream_iterator<std::string>(joined_args, " "));
@@ -129,7 +223,19 @@ namespace libdebug {
         }
         else if(child_process_id > 0) {
             _process_id = child_process_id;
-            _threads.insert(std::pair(_process_id, ThreadContext {_process_id, _process_id}));
+            static_cast<void>(register_thread(_process_id));
+            if(!syscall_filter.empty()) {
+                const auto task_status = platform::TaskWaiter::get_instance().wait(
+                        [this](platform::TaskId task_id) { return task_id == _process_id; }, std::nullopt);
+                if(task_status.is_error() || !WIFSTOPPED(task_status.get()->status) ||
+                   ::ptrace(PTRACE_SETOPTIONS, _process_id, nullptr, syscall_trace_options) < 0 ||
+                   ::ptrace(PTRACE_CONT, _process_id, nullptr, 0) < 0) {
+                    throw std::runtime_error {
+                            fmt::format("Unable to enable syscall tracing in {}: {}", _process_id,
+                                        task_status.is_error() ? task_status.get_error() : platform::get_last_error())};
+                }
+                _threads.at(_process_id)._events_traced = true;
+            }
         }
         else {
             throw std::runtime_error {fmt::format("Unable to create debugged process: {}", platform::get_last_error())};
@@ -138,134 +244,1563 @@ namespace libdebug {
 
     /**
      * This constructor attaches the debugger to the specified process, identified by the specified process
-     * id.
+     * id. The threads are seized with the tracing options set atomically and the task list is scanned until no new
+     * thread is found, afterward all threads are interrupted.
      *
      * @param process_id The pid of the target process
      * @author           Cedric Hammes
      * @since            13/03/2024
      */
     ProcessContext::ProcessContext(platform::TaskId process_id) ://NOLINT
-            _event_callbacks {},
-            _breakpoints {},
             _process_id {process_id},
-            _threads {} {
+            _breakpoints {},
+            _threads {},
+            _child_threads {},
+            _event_callbacks {},
+            _event_dispatcher {},
+            _memory_handle {},
+            _memory_cache {},
+            _memory_map {},
+            _scratch_pages {},
+            _stale_breakpoints {},
+            _dropped_breakpoints {},
+            _image_identity {},
+            _hardware_breakpoints {},
+            _executable_path {fmt::format("/proc/{}/exe", process_id)},
+            _symbols {},
+            _line_table {},
+            _call_frame_tables {},
+            _unwind_modules {},
+            _attach_latency {},
+            _is_seized {true},
+            _running_thread_count {0},
+            _traced_syscalls {},
+            _tracepoints {},
+            _trace_buffer {},
+            _tracepoint_callback {} {
         if(!std::filesystem::exists(fmt::format("/proc/{}", _process_id))) {
             throw std::runtime_error {fmt::format("Failed to attach to process: {} doesn't exists", _process_id)};
         }
 
-        for(const auto& task_dir : std::filesystem::directory_iterator {fmt::format("/proc/{}/task", process_id)}) {
-            const auto task_id = std::stoi(task_dir.path().filename().c_str());
-            if(::ptrace(PTRACE_ATTACH, task_id, nullptr, nullptr) < 0) {
-                throw std::runtime_error {fmt::format("Unable to attach to thread {} of {}: {}", task_id, _process_id,
-                                                      platform::get_last_error())};
+        if(const auto result = platform::TaskWaiter::get_instance().setup(); result.is_error()) {
+            throw std::runtime_error {fmt::format("Failed to attach to process: {}", result.get_error())};
+        }
+
+        // Threads cloned by seized threads are traced by the kernel, so the scan only has to be repeated for threads
+        // created by threads which weren't seized yet
+        const auto start_time = std::chrono::steady_clock::now();
+        const auto task_path = fmt::format("/proc/{}/task", process_id);
+        for(auto found_thread = true; found_thread;) {
+            found_thread = false;
+            std::error_code error {};
+            for(const auto& task_dir : std::filesystem::directory_iterator {task_path, error}) {
+                const auto task_id = std::stoi(task_dir.path().filename().c_str());
+                if(_threads.contains(task_id)) {
+                    continue;
+                }
+
+                // Exited threads are skipped, threads cloned by a seized thread are already traced by the kernel and
+                // are registered like seized threads
+                if(::ptrace(PTRACE_SEIZE, task_id, nullptr, trace_options) < 0) {
+                    if(errno == ESRCH) {
+                        continue;
+                    }
+
+                    if(errno != EPERM || !is_traced_by_debugger(task_id)) {
+                        throw std::runtime_error {fmt::format("Unable to attach to thread {} of {}: {}", task_id,
+                                                              _process_id, platform::get_last_error())};
+                    }
+                }
+
+                static_cast<void>(register_thread(task_id));
+                _threads.at(task_id)._events_traced = true;
+                found_thread = true;
+            }
+
+            if(error) {
+                throw std::runtime_error {
+                        fmt::format("Unable to attach to process {}: {}", _process_id, error.message())};
+            }
+        }
+
+        // Stop all threads, so the process is stopped like after a classic attach
+        for(const auto& [thread_id, _] : _threads) {
+            if(::ptrace(PTRACE_INTERRUPT, thread_id, nullptr, nullptr) < 0 && errno != ESRCH) {
+                throw std::runtime_error {fmt::format("Unable to interrupt thread {} of {}: {}", thread_id,
+                                                      _process_id, platform::get_last_error())};
             }
-            _threads.insert(std::pair(task_id, ThreadContext {_process_id, task_id}));
         }
+        _attach_latency = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                                                 start_time);
     }
 
+    /**
+     * This function blocks until any thread of the process receives a signal or changes its state. The calling
+     * thread sleeps in the kernel while waiting, so no CPU time is consumed. Stops of thread lifecycle events are
+     * handled while waiting and are only reported to the event callbacks.
+     *
+     * @return The signal of the thread or an error
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
     auto ProcessContext::wait_for_signal() noexcept -> kstd::Result<Signal> {
-        using namespace std::chrono;
+        while(true) {
+            if(_threads.empty() && _child_threads.empty()) {
+                return kstd::Error {fmt::format("Unable to wait for signal: No thread of {} is traced", _process_id)};
+            }
+
+            const auto task_status = platform::TaskWaiter::get_instance().wait(
+                    [this](platform::TaskId task_id) { return owns_task(task_id); }, std::nullopt);
+            if(task_status.is_error()) {
+                return kstd::Error {task_status.get_error()};
+            }
+
+            auto signal = handle_task_status(task_status.get().value());
+            if(signal.is_error()) {
+                return kstd::Error {signal.get_error()};
+            }
+
+            if(signal.get().has_value()) {
+                return signal.get().value();
+            }
+        }
+    }
 
+    /**
+     * This function blocks until any thread of the process receives a signal, changes its state or the specified
+     * timeout is elapsed. Stops of thread lifecycle events are handled while waiting and are only reported to the
+     * event callbacks.
+     *
+     * @param timeout The maximum time to wait for a signal
+     * @return        The signal of the thread, no value when the timeout is elapsed or an error
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto ProcessContext::wait_for_signal(std::chrono::milliseconds timeout) noexcept
+            -> kstd::Result<std::optional<Signal>> {
+        using namespace std::chrono;
+        const auto deadline = steady_clock::now() + timeout;
         while(true) {
-            // Enumerate threads
-            for(auto& [thread_id, thread_context] : _threads) {
-                int status = 0;
-
-                // Wait for signal in single-thread timeout
-                const auto begin_timestamp = steady_clock::now();
-                while(true) {
-                    // Acquire signal
-                    if(::waitpid(thread_id, &status, WNOHANG) == -1) {
-                        return kstd::Error {fmt::format("Failed signal wait on thread {}: {}", thread_id,
-                                                        platform::get_last_error())};
-                    }
+            if(_threads.empty() && _child_threads.empty()) {
+                return kstd::Error {fmt::format("Unable to wait for signal: No thread of {} is traced", _process_id)};
+            }
+
+            const auto remaining_time =
+                    std::max(duration_cast<milliseconds>(deadline - steady_clock::now()), milliseconds::zero());
+            const auto task_status = platform::TaskWaiter::get_instance().wait(
+                    [this](platform::TaskId task_id) { return owns_task(task_id); }, remaining_time);
+            if(task_status.is_error()) {
+                return kstd::Error {task_status.get_error()};
+            }
+
+            if(!task_status.get().has_value()) {
+                return {std::optional<Signal> {}};
+            }
+
+            auto signal = handle_task_status(task_status.get().value());
+            if(signal.is_error() || signal.get().has_value()) {
+                return signal;
+            }
+        }
+    }
+
+    /**
+     * This function converts the specified status, reported by the wait backend for a thread of this process,
+     * into a signal. The signal info is read from the thread which changed its state. Thread creation, thread exit
+     * and fork stops update the threads of this process, are dispatched to the event callbacks and resume the
+     * thread without a signal.
+     *
+     * @param task_status The status of the thread
+     * @return            The signal of the thread, no value when the stop was handled internally or an error
+     * @author            Cedric Hammes
+     * @since             16/10/2026
+     */
+    auto ProcessContext::handle_task_status(const platform::TaskStatus& task_status) noexcept
+            -> kstd::Result<std::optional<Signal>> {
+        const auto thread_id = task_status.task_id;
+        const auto thread = _threads.find(thread_id);
+        if(thread == _threads.end()) {
+            // The threads of forked children are only traced for their syscalls
+            if(const auto child_thread = _child_threads.find(thread_id); child_thread != _child_threads.end()) {
+                if(const auto result = handle_child_status(child_thread->second, task_status.status);
+                   result.is_error()) {
+                    return kstd::Error {result.get_error()};
+                }
+                return {std::optional<Signal> {}};
+            }
+            return kstd::Error {
+                    fmt::format("Failed signal wait: Thread {} is not owned by {}", thread_id, _process_id)};
+        }
+
+        // The exit of other threads was already reported by their exit event, so they are removed silently
+        if(thread_id != _process_id && (WIFEXITED(task_status.status) || WIFSIGNALED(task_status.status))) {
+            erase_thread(thread);
+            return {std::optional<Signal> {}};
+        }
+        set_thread_state(thread->second, WIFSTOPPED(task_status.status) ? ThreadState::STOPPED : ThreadState::EXITED);
+
+        // Exited threads have no signal info, their exit is reported with the exit status instead
+        if(WIFEXITED(task_status.status) || WIFSIGNALED(task_status.status)) {
+            return {Signal {&thread->second, siginfo_t {}, std::nullopt, task_status.status}};
+        }
+
+        // The lifecycle events are traced from the first stop of a thread, new threads inherit the options
+        if(!thread->second._events_traced) {
+            if(::ptrace(PTRACE_SETOPTIONS, thread_id, nullptr, trace_options) < 0) {
+                return kstd::Error {
+                        fmt::format("Failed signal wait on thread {}: {}", thread_id, platform::get_last_error())};
+            }
+            thread->second._events_traced = true;
+        }
+
+        // Changes of the hardware breakpoints while the thread was running are applied at its next stop
+        if(thread->second._hardware_breakpoints_pending) {
+            if(const auto result = set_hardware_breakpoints(thread->second); result.is_error()) {
+                return kstd::Error {result.get_error()};
+            }
+        }
+
+        // New threads start with a stop, they get the hardware breakpoints before they run. Threads of a seized
+        // process start with an event stop instead of SIGSTOP.
+        const auto event = task_status.status >> 16;
+        const auto is_start_stop =
+                (event == 0 && WSTOPSIG(task_status.status) == SIGSTOP) || event == PTRACE_EVENT_STOP;
+        if(thread->second._is_starting && is_start_stop) {
+            thread->second._is_starting = false;
+            if(const auto result = set_hardware_breakpoints(thread->second); result.is_error()) {
+                return kstd::Error {result.get_error()};
+            }
+
+            if(const auto result = resume_thread(thread_id); result.is_error()) {
+                return kstd::Error {result.get_error()};
+            }
+            return {std::optional<Signal> {}};
+        }
+
+        // The exit of a traced syscall is only reported to the event callbacks
+        if(event == 0 && WSTOPSIG(task_status.status) == syscall_exit_signal) {
+            if(const auto result = handle_syscall_stop(thread->second, false); result.is_error()) {
+                return kstd::Error {result.get_error()};
+            }
+
+            if(const auto result = resume_thread(thread_id); result.is_error()) {
+                return kstd::Error {result.get_error()};
+            }
+            return {std::optional<Signal> {}};
+        }
+
+        // All events except exec are only reported to the event callbacks, exec and interrupts are reported as signal
+        if(event != 0 && event != PTRACE_EVENT_STOP) {
+            if(const auto result = handle_trace_event(thread->second, event); result.is_error()) {
+                return kstd::Error {result.get_error()};
+            }
+
+            if(event != PTRACE_EVENT_EXEC) {
+                if(const auto result = resume_thread(thread_id); result.is_error()) {
+                    return kstd::Error {result.get_error()};
+                }
+                return {std::optional<Signal> {}};
+            }
+        }
 
-                    // Handle signal
-                    if(status != 0) {
-                        siginfo_t signal_info {};
-                        if(::ptrace(PTRACE_GETSIGINFO, _process_id, nullptr, &signal_info) < 0) {
-                            return kstd::Error {fmt::format("Failed signal wait on thread {}: {}", thread_id,
-                                                            platform::get_last_error())};
-                        }
+        // Group-stops of seized threads have no signal info, so the stop signal is reported
+        siginfo_t signal_info {};
+        if(::ptrace(PTRACE_GETSIGINFO, thread_id, nullptr, &signal_info) < 0) {
+            if(event != PTRACE_EVENT_STOP || errno != EINVAL) {
+                return kstd::Error {
+                        fmt::format("Failed signal wait on thread {}: {}", thread_id, platform::get_last_error())};
+            }
+            signal_info.si_signo = WSTOPSIG(task_status.status);
+        }
+
+#ifdef ARCH_X86_64
+        // Remember the breakpoint which stopped the thread, so it can be stepped over on resume. The trap leaves the
+        // instruction pointer behind the interrupt instruction, so the thread is rewound to the breakpoint.
+        thread->second._breakpoint_address.reset();
+        if(signal_info.si_signo == SIGTRAP && (signal_info.si_code == SI_KERNEL || signal_info.si_code == TRAP_BRKPT)) {
+            const auto instruction_pointer = thread->second.get_instruction_pointer();
+            if(instruction_pointer.is_error()) {
+                return kstd::Error {
+                        fmt::format("Failed signal wait on thread {}: {}", thread_id, instruction_pointer.get_error())};
+            }
 
-                        return {Signal {&thread_context, signal_info}};
+            const auto trap_address = instruction_pointer.get() - 1;
+            const auto* breakpoint = _breakpoints.find(trap_address);
+            if(breakpoint != nullptr && breakpoint->is_enabled()) {
+                thread->second._breakpoint_address = breakpoint->get_address();
+                static_cast<void>(thread->second.set_instruction_pointer(breakpoint->get_address()));
+
+                // Tracepoint hits are only recorded, the thread continues without reporting a signal
+                if(const auto tracepoint = _tracepoints.find(breakpoint->get_address());
+                   tracepoint != _tracepoints.end()) {
+                    if(const auto result = record_tracepoint_hit(thread->second, tracepoint->second);
+                       result.is_error()) {
+                        return kstd::Error {result.get_error()};
                     }
 
-                    // Break thread wait because timeout is elapsed // TODO: Configurable timeout
-                    if(duration_cast<milliseconds>(steady_clock::now() - begin_timestamp).count() >= 500) {
-                        break;
+                    if(const auto result = resume_thread(thread_id); result.is_error()) {
+                        return kstd::Error {result.get_error()};
                     }
+                    return {std::optional<Signal> {}};
+                }
+            }
+            else if(_stale_breakpoints.contains(trap_address)) {
+                // Running threads can hit a breakpoint before it was removed or disabled, their traps are rewound
+                if(const auto result = thread->second.set_instruction_pointer(trap_address); result.is_error()) {
+                    return kstd::Error {result.get_error()};
+                }
+
+                if(const auto result = resume_thread(thread_id); result.is_error()) {
+                    return kstd::Error {result.get_error()};
                 }
+                return {std::optional<Signal> {}};
+            }
+        }
+#endif
+
+        // Find the hardware breakpoint which stopped the thread, a hit during a single step is reported as trace trap
+        std::optional<std::size_t> hardware_breakpoint_slot {};
+        if(signal_info.si_signo == SIGTRAP &&
+           (signal_info.si_code == TRAP_HWBKPT || signal_info.si_code == TRAP_TRACE)) {
+            const auto slot = thread->second.take_hardware_breakpoint_hit();
+            if(slot.is_error()) {
+                return kstd::Error {slot.get_error()};
+            }
+            hardware_breakpoint_slot = slot.get();
+        }
+
+        // A breakpoint which was removed while the thread was running can still have stopped the thread, its trap is
+        // suppressed. Trace traps of a step are still reported.
+        if(hardware_breakpoint_slot.has_value() && !_hardware_breakpoints[*hardware_breakpoint_slot].has_value()) {
+            if(signal_info.si_code == TRAP_TRACE) {
+                return {std::optional<Signal> {Signal {&thread->second, signal_info}}};
+            }
+
+            if(const auto result = resume_thread(thread_id); result.is_error()) {
+                return kstd::Error {result.get_error()};
             }
+            return {std::optional<Signal> {}};
         }
+        return {std::optional<Signal> {Signal {&thread->second, signal_info, hardware_breakpoint_slot}}};
     }
 
     /**
-     * This function adds a breakpoint at the specified address when no breakpoint was added before
+     * This function updates the threads of this process for the specified ptrace event and dispatches the matching
+     * process event. The thread stays stopped.
      *
-     * @param address The breakpoint address
-     * @return        Void or an error
-     * @author        Cedric Hammes
-     * @since         09/03/2024
+     * @param thread The thread which stopped at the event
+     * @param event  The ptrace event
+     * @return       Void or an error
+     * @author       Cedric Hammes
+     * @since        16/10/2026
      */
-    auto ProcessContext::add_breakpoint(std::intptr_t address) noexcept -> kstd::Result<void> {
-        using namespace std::string_literals;
-        if(!is_process_running()) {
-            return kstd::Error {"Unable to add breakpoint: No process is running"s};
+    auto ProcessContext::handle_trace_event(ThreadContext& thread, int event) noexcept -> kstd::Result<void> {
+        const auto thread_id = thread.get_thread_id();
+        unsigned long message = 0;
+        if(::ptrace(PTRACE_GETEVENTMSG, thread_id, nullptr, &message) < 0) {
+            return kstd::Error {
+                    fmt::format("Unable to handle event of thread {}: {}", thread_id, platform::get_last_error())};
+        }
+
+        ProcessEvent process_event {};
+        switch(event) {
+            case PTRACE_EVENT_CLONE: {
+                // The new thread may not be stopped yet, so it is set up at its first stop. Threads found by the
+                // attach before their clone event was handled are already registered.
+                const auto new_thread_id = static_cast<platform::TaskId>(message);
+                if(!_threads.contains(new_thread_id)) {
+                    auto& new_thread = insert_thread(new_thread_id);
+                    new_thread._events_traced = true;
+                    new_thread._is_starting = true;
+                }
+                process_event.event_type = ProcessEventType::CREATE_THREAD;
+                process_event.create_thread_event.process_id = _process_id;
+                process_event.create_thread_event.thread_id = new_thread_id;
+                dispatch_event(process_event);
+                break;
+            }
+            case PTRACE_EVENT_EXIT: {
+                // The thread can still be inspected by the callbacks, it is removed when it is reaped
+                process_event.event_type = ProcessEventType::DELETE_THREAD;
+                process_event.delete_thread_event.process_id = _process_id;
+                process_event.delete_thread_event.thread_id = thread_id;
+                dispatch_event(process_event);
+                break;
+            }
+            case PTRACE_EVENT_FORK:
+            case PTRACE_EVENT_VFORK: {
+                const auto child_process_id = static_cast<platform::TaskId>(message);
+                if(const auto result = release_child_process(child_process_id, event == PTRACE_EVENT_VFORK);
+                   result.is_error()) {
+                    return kstd::Error {result.get_error()};
+                }
+
+                process_event.event_type = ProcessEventType::CREATE_PROCESS;
+                process_event.create_process_event.process_id = _process_id;
+                process_event.create_process_event.child_process_id = child_process_id;
+                dispatch_event(process_event);
+                break;
+            }
+            case PTRACE_EVENT_SECCOMP: {
+                if(const auto result = handle_syscall_stop(thread, true); result.is_error()) {
+                    return kstd::Error {result.get_error()};
+                }
+                break;
+            }
+            case PTRACE_EVENT_EXEC: {
+                // All other threads are gone and the address space is replaced, so all state of the old image is reset
+                for(auto other_thread = _threads.begin(); other_thread != _threads.end();) {
+                    if(other_thread->first == thread_id) {
+                        ++other_thread;
+                        continue;
+                    }
+
+                    process_event.event_type = ProcessEventType::DELETE_THREAD;
+                    process_event.delete_thread_event.process_id = _process_id;
+                    process_event.delete_thread_event.thread_id = other_thread->first;
+                    dispatch_event(process_event);
+                    other_thread = erase_thread(other_thread);
+                }
+
+                _memory_handle = platform::OwnedHandle {};
+                _memory_cache.invalidate();
+                _memory_map.invalidate();
+                _scratch_pages.clear();
+                _stale_breakpoints.clear();
+                if(const auto result = restore_breakpoints(thread); result.is_error()) {
+                    return kstd::Error {result.get_error()};
+                }
+                _symbols.reset();
+                _line_table.reset();
+                _call_frame_tables.clear();
+                _unwind_modules.clear();
+                break;
+            }
+            default: break;
+        }
+        return {};
+    }
+
+    /**
+     * This function restores the breakpoints of the old image after the specified thread executed a new image. When
+     * the same executable was started again at the same address, the breakpoints in its code are patched again and
+     * the hardware breakpoints are set in the thread, because the kernel clears the debug registers. All other
+     * breakpoints are dropped and their addresses are kept until the next exec.
+     *
+     * @param thread The thread which executed the new image
+     * @return       Void or an error
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    auto ProcessContext::restore_breakpoints(ThreadContext& thread) noexcept -> kstd::Result<void> {
+        const auto image_identity = read_image_identity(_process_id);
+        const auto is_same_image = image_identity.has_value() && image_identity == _image_identity;
+        _image_identity = image_identity;
+
+        // Only the executable is mapped at the exec stop, so the breakpoints in libraries are always dropped
+        std::optional<const MemoryMap*> memory_map {};
+        std::filesystem::path executable_path {};
+        if(is_same_image) {
+            std::error_code error {};
+            executable_path = std::filesystem::read_symlink(fmt::format("/proc/{}/exe", _process_id), error);
+            if(const auto result = get_memory_map(); result.is_ok()) {
+                memory_map = result.get();
+            }
         }
 
-        if(_breakpoints.contains(address)) {
-            return kstd::Error {"Unable to set breakpoint: Breakpoint is already set"s};
+        std::vector<std::intptr_t> addresses {};
+        _dropped_breakpoints.clear();
+        for(const auto& breakpoint : _breakpoints) {
+            const auto address = breakpoint.get_address();
+            const auto region = memory_map.has_value() ? (*memory_map)->find_region(address) : std::nullopt;
+            if(breakpoint.is_enabled() && region.has_value() && region->has_permission(MemoryPermission::EXECUTE) &&
+               region->path == executable_path.native()) {
+                addresses.push_back(address);
+                continue;
+            }
+            _dropped_breakpoints.push_back(address);
         }
 
-        Breakpoint breakpoint {address};
-        for(const auto& [_, thread] : _threads) {
-            if(const auto enable_result = breakpoint.enable(thread); enable_result.is_error()) {
-                return kstd::Error {enable_result.get_error()};
+        _breakpoints.clear();
+        const auto results = add_breakpoints(addresses);
+        for(std::size_t index = 0; index < addresses.size(); ++index) {
+            if(results[index].is_error()) {
+                _dropped_breakpoints.push_back(addresses[index]);
             }
         }
-        _breakpoints.insert(std::make_pair(address, breakpoint));
+        for(const auto address : _dropped_breakpoints) {
+            _tracepoints.erase(address);
+        }
+
+        if(is_same_image) {
+            return set_hardware_breakpoints(thread);
+        }
+
+        // The addresses of the hardware breakpoints have no meaning in another image
+        for(std::size_t slot = 0; slot < _hardware_breakpoints.size(); ++slot) {
+            _hardware_breakpoints[slot].reset();
+            static_cast<void>(thread.clear_hardware_breakpoint(slot));
+        }
         return {};
     }
 
     /**
-     * This function removes the breakpoint from the specified address when no breakpoint was added before
+     * This function dispatches the entry or exit of a traced syscall by the specified thread. The arguments are read
+     * at the entry and kept until the exit, because the registers holding them can be changed by the syscall.
      *
-     * @param address The breakpoint address
-     * @return        Void or an error
-     * @author        Cedric Hammes
-     * @since         09/03/2024
+     * @param thread   The thread which stopped at the syscall
+     * @param is_entry Whether the thread enters the syscall
+     * @return         Void or an error
+     * @author         Cedric Hammes
+     * @since          16/10/2026
      */
-    auto ProcessContext::remove_breakpoint(std::intptr_t address) noexcept -> kstd::Result<void> {
-        using namespace std::string_literals;
-        if(!is_process_running()) {
-            return kstd::Error {"Unable to remove breakpoint: No process is running"s};
+    auto ProcessContext::handle_syscall_stop(ThreadContext& thread, bool is_entry) noexcept -> kstd::Result<void> {
+        // Threads are only resumed until the syscall exit after a traced entry, so other exit stops are ignored
+        if(!is_entry && !thread._syscall_number.has_value()) {
+            return {};
+        }
+
+        const auto registers = thread.get_registers();
+        if(registers.is_error()) {
+            return kstd::Error {fmt::format("Unable to handle syscall of thread {}: {}", thread.get_thread_id(),
+                                            registers.get_error())};
         }
 
-        const auto breakpoint = _breakpoints.find(address);
-        if(breakpoint == _breakpoints.cend()) {
-            return kstd::Error {"Unable to set breakpoint: Breakpoint is not set"s};
+        if(is_entry) {
+            thread._syscall_number = arch::get_syscall_number(registers.get());
+            thread._syscall_arguments = arch::get_syscall_arguments(registers.get());
         }
 
-        for(const auto& [_, thread] : _threads) {
-            if(const auto disable_result = breakpoint->second.disable(thread); disable_result.is_error()) {
-                return kstd::Error {disable_result.get_error()};
+        ProcessEvent process_event {};
+        process_event.event_type = is_entry ? ProcessEventType::SYSCALL_ENTER : ProcessEventType::SYSCALL_EXIT;
+        process_event.syscall_event.process_id = thread.get_process_id();
+        process_event.syscall_event.thread_id = thread.get_thread_id();
+        process_event.syscall_event.number = *thread._syscall_number;
+        process_event.syscall_event.arguments = thread._syscall_arguments;
+        process_event.syscall_event.return_value =
+                is_entry ? 0 : static_cast<kstd::i64>(arch::get_return_value(registers.get()));
+        dispatch_event(process_event);
+
+        if(!is_entry) {
+            thread._syscall_number.reset();
+        }
+        return {};
+    }
+
+    /**
+     * This function releases the specified forked child process at its first stop. The child of a fork inherits a
+     * copy of the software breakpoints of this process, so their original code is restored in the child before it
+     * continues. The child of a vfork shares the address space with this process, so the breakpoints are kept and the
+     * child is kept traced until it executes a new image or exits, so it steps over the breakpoints. While syscalls
+     * are traced, the child inherits the seccomp filter and its filtered syscalls would fail without a tracer, so the
+     * child is kept traced too. Otherwise the child is detached.
+     *
+     * @param child_process_id The id of the child process
+     * @param shares_memory    Whether the child shares the address space with this process
+     * @return                 Void or an error
+     * @author                 Cedric Hammes
+     * @since                  16/10/2026
+     */
+    auto ProcessContext::release_child_process(platform::TaskId child_process_id, bool shares_memory) noexcept
+            -> kstd::Result<void> {
+        auto& task_waiter = platform::TaskWaiter::get_instance();
+        task_waiter.add_task(child_process_id);
+        const auto task_status = task_waiter.wait(
+                [child_process_id](platform::TaskId task_id) { return task_id == child_process_id; }, std::nullopt);
+        if(task_status.is_error()) {
+            return kstd::Error {task_status.get_error()};
+        }
+
+        if(!WIFSTOPPED(task_status.get()->status)) {
+            return {};
+        }
+
+        if(!shares_memory) {
+            if(const auto result = restore_child_breakpoints(child_process_id); result.is_error()) {
+                return kstd::Error {fmt::format("Unable to release child process {}: {}", child_process_id,
+                                                result.get_error())};
             }
         }
-        _breakpoints.erase(address);
+
+        // The child inherited the tracing options, so its syscalls and its own children are reported like ours
+        if(!_traced_syscalls.empty() || shares_memory) {
+            auto& child_thread = _child_threads.insert_or_assign(child_process_id,
+                                                                 ThreadContext {child_process_id, child_process_id})
+                                         .first->second;
+            child_thread._events_traced = true;
+            child_thread._shares_memory = shares_memory;
+            if(::ptrace(PTRACE_CONT, child_process_id, nullptr, 0) < 0) {
+                return kstd::Error {fmt::format("Unable to release child process {}: {}", child_process_id,
+                                                platform::get_last_error())};
+            }
+            return {};
+        }
+
+        if(::ptrace(PTRACE_DETACH, child_process_id, nullptr, 0) < 0) {
+            return kstd::Error {fmt::format("Unable to release child process {}: {}", child_process_id,
+                                            platform::get_last_error())};
+        }
+        task_waiter.remove_task(child_process_id);
         return {};
     }
 
     /**
-     * This function checks whether the process bound with the debug context is still running or has been
-     * terminated.
+     * This function restores the original code of all enabled software breakpoints in the specified forked child. The
+     * breakpoints are restored one page at a time with a single read-modify-write of the range between the first and
+     * the last breakpoint in the page.
      *
-     * @return Whether the process is still running
-     * @author Cedric Hammes
-     * @since  09/03/2024
+     * @param child_process_id The id of the child process
+     * @return                 Void or an error
+     * @author                 Cedric Hammes
+     * @since                  17/10/2026
      */
-    auto ProcessContext::is_process_running() const noexcept -> kstd::Result<bool> {
-        return platform::is_process_running(_process_id);
+    auto ProcessContext::restore_child_breakpoints(platform::TaskId child_process_id) noexcept -> kstd::Result<void> {
+        std::vector<std::pair<std::intptr_t, kstd::u8>> saved_data {};
+        for(const auto& breakpoint : _breakpoints) {
+            if(breakpoint.is_enabled()) {
+                saved_data.emplace_back(breakpoint.get_address(), breakpoint._saved_data);
+            }
+        }
+
+        if(saved_data.empty()) {
+            return {};
+        }
+        std::sort(saved_data.begin(), saved_data.end());
+
+        const platform::OwnedHandle memory_handle {
+                ::open(fmt::format("/proc/{}/mem", child_process_id).c_str(), O_RDWR | O_CLOEXEC)};
+        if(!memory_handle.is_valid()) {
+            return kstd::Error {platform::get_last_error()};
+        }
+
+        std::vector<kstd::u8> data {};
+        for(auto begin = saved_data.cbegin(); begin != saved_data.cend();) {
+            const auto page_address = MemoryCache::get_page_address(begin->first);
+            const auto end = std::find_if(begin, saved_data.cend(), [&](const auto& entry) {
+                return MemoryCache::get_page_address(entry.first) != page_address;
+            });
+
+            const auto address = begin->first;
+            const auto size = static_cast<std::size_t>(std::prev(end)->first - address) + 1;
+            data.resize(size);
+            if(::pread(memory_handle.get(), data.data(), size, static_cast<off_t>(address)) !=
+               static_cast<ssize_t>(size)) {
+                return kstd::Error {platform::get_last_error()};
+            }
+
+            for(auto entry = begin; entry != end; ++entry) {
+                data[static_cast<std::size_t>(entry->first - address)] = entry->second;
+            }
+
+            if(::pwrite(memory_handle.get(), data.data(), size, static_cast<off_t>(address)) !=
+               static_cast<ssize_t>(size)) {
+                return kstd::Error {platform::get_last_error()};
+            }
+            begin = end;
+        }
+        return {};
+    }
+
+    /**
+     * This function handles the specified status of a thread of a forked child process, which is kept traced for its
+     * syscalls or while it shares the memory of this process. The syscalls are dispatched to the event callbacks, new
+     * threads and children are traced too. Breakpoint traps of a vfork child are stepped over, all other stops resume
+     * the thread with their signal.
+     *
+     * @param thread The thread of the child process
+     * @param status The status of the thread
+     * @return       Void or an error
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    auto ProcessContext::handle_child_status(ThreadContext& thread, int status) noexcept -> kstd::Result<void> {
+        const auto thread_id = thread.get_thread_id();
+        if(WIFEXITED(status) || WIFSIGNALED(status)) {
+            _child_threads.erase(thread_id);
+            return {};
+        }
+
+        auto signal = 0;
+        const auto event = status >> 16;
+        switch(event) {
+            case 0: {
+                // New threads start with SIGSTOP, all other signals are delivered to the thread
+                const auto stop_signal = WSTOPSIG(status);
+                if(stop_signal == syscall_exit_signal) {
+                    if(const auto result = handle_syscall_stop(thread, false); result.is_error()) {
+                        return kstd::Error {result.get_error()};
+                    }
+                }
+                else if(stop_signal == SIGTRAP && thread._shares_memory) {
+                    const auto step_status = step_child_over_breakpoint(thread);
+                    if(step_status.is_error()) {
+                        return kstd::Error {step_status.get_error()};
+                    }
+
+                    // The step can end with the exit or an event of the child, which is handled like any other stop
+                    if(!step_status.get().has_value()) {
+                        signal = stop_signal;
+                    }
+                    else if(!WIFSTOPPED(step_status.get()->status) || (step_status.get()->status >> 16) != 0) {
+                        return handle_child_status(thread, step_status.get()->status);
+                    }
+                }
+                else if(!thread._is_starting || stop_signal != SIGSTOP) {
+                    signal = stop_signal;
+                }
+                thread._is_starting = false;
+                break;
+            }
+            case PTRACE_EVENT_CLONE:
+            case PTRACE_EVENT_FORK:
+            case PTRACE_EVENT_VFORK: {
+                unsigned long message = 0;
+                if(::ptrace(PTRACE_GETEVENTMSG, thread_id, nullptr, &message) < 0) {
+                    return kstd::Error {fmt::format("Unable to handle event of thread {}: {}", thread_id,
+                                                    platform::get_last_error())};
+                }
+
+                const auto new_task_id = static_cast<platform::TaskId>(message);
+                if(event != PTRACE_EVENT_CLONE) {
+                    if(const auto result = release_child_process(new_task_id, event == PTRACE_EVENT_VFORK);
+                       result.is_error()) {
+                        return kstd::Error {result.get_error()};
+                    }
+                    break;
+                }
+
+                auto& new_thread = _child_threads.insert_or_assign(new_task_id,
+                                                                   ThreadContext {thread.get_process_id(), new_task_id})
+                                           .first->second;
+                new_thread._events_traced = true;
+                new_thread._is_starting = true;
+                platform::TaskWaiter::get_instance().add_task(new_task_id);
+                break;
+            }
+            case PTRACE_EVENT_SECCOMP: {
+                if(const auto result = handle_syscall_stop(thread, true); result.is_error()) {
+                    return kstd::Error {result.get_error()};
+                }
+                break;
+            }
+            case PTRACE_EVENT_EXEC: {
+                // The other threads of the child are gone after the exec
+                std::erase_if(_child_threads, [&](const auto& child_thread) {
+                    return child_thread.second.get_process_id() == thread.get_process_id() &&
+                           child_thread.first != thread_id;
+                });
+
+                // A vfork child gets its own address space with the exec, so it is only kept traced for its syscalls
+                if(thread._shares_memory && _traced_syscalls.empty()) {
+                    if(::ptrace(PTRACE_DETACH, thread_id, nullptr, 0) < 0 && errno != ESRCH) {
+                        return kstd::Error {fmt::format("Unable to release child process {}: {}", thread_id,
+                                                        platform::get_last_error())};
+                    }
+                    platform::TaskWaiter::get_instance().remove_task(thread_id);
+                    _child_threads.erase(thread_id);
+                    return {};
+                }
+                thread._shares_memory = false;
+                break;
+            }
+            case PTRACE_EVENT_STOP: thread._is_starting = false; break;
+            default: break;
+        }
+
+        // Threads in a traced syscall stop again when leaving it
+        if(const auto result = thread.flush_registers(); result.is_error()) {
+            return kstd::Error {fmt::format("Unable to resume thread {}: {}", thread_id, result.get_error())};
+        }
+
+        const auto request = thread._syscall_number.has_value() ? PTRACE_SYSCALL : PTRACE_CONT;
+        if(::ptrace(request, thread_id, nullptr, signal) < 0 && errno != ESRCH) {
+            return kstd::Error {fmt::format("Unable to resume thread {}: {}", thread_id, platform::get_last_error())};
+        }
+        return {};
+    }
+
+    /**
+     * This function steps the specified thread of a vfork child over the breakpoint which stopped it. The child runs
+     * in the address space of this process, so it hits the breakpoints of this process. Tracepoint hits of the child
+     * are recorded like the hits of the threads of this process.
+     *
+     * @param thread The thread of the child process
+     * @return       The status of the thread after the step, no value when the thread wasn't stopped by a breakpoint or
+     *               an error
+     * @author       Cedric Hammes
+     * @since        17/10/2026
+     */
+    auto ProcessContext::step_child_over_breakpoint(ThreadContext& thread) noexcept
+            -> kstd::Result<std::optional<platform::TaskStatus>> {
+#ifdef ARCH_X86_64
+        const auto instruction_pointer = thread.get_instruction_pointer();
+        if(instruction_pointer.is_error()) {
+            return kstd::Error {instruction_pointer.get_error()};
+        }
+
+        const auto trap_address = instruction_pointer.get() - 1;
+        const auto* breakpoint = _breakpoints.find(trap_address);
+        if(breakpoint == nullptr || !breakpoint->is_enabled()) {
+            return {std::optional<platform::TaskStatus> {}};
+        }
+
+        if(const auto result = thread.set_instruction_pointer(trap_address); result.is_error()) {
+            return kstd::Error {result.get_error()};
+        }
+
+        if(const auto tracepoint = _tracepoints.find(trap_address); tracepoint != _tracepoints.end()) {
+            if(const auto result = record_tracepoint_hit(thread, tracepoint->second); result.is_error()) {
+                return kstd::Error {result.get_error()};
+            }
+        }
+        return step_over_breakpoint(thread, trap_address);
+#else
+        return {std::optional<platform::TaskStatus> {}};
+#endif
+    }
+
+    /**
+     * This function continues the execution of the specified stopped thread. All cached state of the process, like
+     * the memory cache, is invalidated and the modified registers are written back before the thread is resumed.
+     *
+     * @param thread_id The id of the thread
+     * @param signal    The signal to deliver to the thread, or 0 to deliver no signal
+     * @return          Void or an error
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    auto ProcessContext::resume_thread(platform::TaskId thread_id, int signal) noexcept -> kstd::Result<void> {
+        const auto thread = _threads.find(thread_id);
+        if(thread != _threads.end() && !thread->second.is_stopped()) {
+            return kstd::Error {fmt::format("Unable to resume thread {}: Thread is not stopped", thread_id)};
+        }
+
+        if(thread != _threads.end() && thread->second._breakpoint_address.has_value()) {
+            const auto address = *std::exchange(thread->second._breakpoint_address, std::nullopt);
+            const auto step_status = step_over_breakpoint(thread->second, address);
+            if(step_status.is_error()) {
+                return kstd::Error {step_status.get_error()};
+            }
+
+            // The thread exited or hit a hardware breakpoint while stepping, so the stop is reported by the next wait.
+            // The signal is raised again, so it's delivered after the reported stop.
+            if(step_status.get().has_value()) {
+                const auto is_reported = is_step_reported(thread->second, step_status.get().value());
+                if(is_reported.is_error()) {
+                    return kstd::Error {is_reported.get_error()};
+                }
+
+                if(is_reported.get()) {
+                    if(signal != 0 && WIFSTOPPED(step_status.get()->status)) {
+                        ::tgkill(_process_id, thread_id, signal);
+                    }
+                    platform::TaskWaiter::get_instance().push(step_status.get().value());
+                    set_thread_state(thread->second, ThreadState::RUNNING);
+                    return {};
+                }
+            }
+        }
+
+        if(thread != _threads.end()) {
+            if(const auto result = thread->second.flush_registers(); result.is_error()) {
+                return kstd::Error {fmt::format("Unable to resume thread {}: {}", thread_id, result.get_error())};
+            }
+        }
+
+        // Threads in a traced syscall stop again when leaving it
+        const auto is_in_syscall = thread != _threads.end() && thread->second._syscall_number.has_value();
+        _memory_cache.invalidate();
+        _memory_map.invalidate();
+        if(::ptrace(is_in_syscall ? PTRACE_SYSCALL : PTRACE_CONT, thread_id, nullptr, signal) < 0) {
+            return kstd::Error {fmt::format("Unable to resume thread {}: {}", thread_id, platform::get_last_error())};
+        }
+
+        if(thread != _threads.end()) {
+            set_thread_state(thread->second, ThreadState::RUNNING);
+        }
+        return {};
+    }
+
+    /**
+     * This function executes a single instruction in the specified stopped thread. All cached state of the
+     * process, like the memory cache, is invalidated and the modified registers are written back before the thread
+     * is resumed.
+     *
+     * @param thread_id The id of the thread
+     * @param signal    The signal to deliver to the thread, or 0 to deliver no signal
+     * @return          Void or an error
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    auto ProcessContext::step_thread(platform::TaskId thread_id, int signal) noexcept -> kstd::Result<void> {
+        const auto thread = _threads.find(thread_id);
+        if(thread != _threads.end() && !thread->second.is_stopped()) {
+            return kstd::Error {fmt::format("Unable to step thread {}: Thread is not stopped", thread_id)};
+        }
+
+        if(thread != _threads.end() && thread->second._breakpoint_address.has_value()) {
+            const auto address = *std::exchange(thread->second._breakpoint_address, std::nullopt);
+            const auto step_status = step_over_breakpoint(thread->second, address);
+            if(step_status.is_error()) {
+                return kstd::Error {step_status.get_error()};
+            }
+
+            // The instruction is already stepped, so the stop is handed back to the next wait. With a signal, the
+            // thread is stepped again into the signal handler instead, unless the step has to be reported.
+            if(step_status.get().has_value()) {
+                const auto is_reported = is_step_reported(thread->second, step_status.get().value());
+                if(is_reported.is_error()) {
+                    return kstd::Error {is_reported.get_error()};
+                }
+
+                if(signal == 0 || is_reported.get()) {
+                    if(signal != 0 && WIFSTOPPED(step_status.get()->status)) {
+                        ::tgkill(_process_id, thread_id, signal);
+                    }
+                    platform::TaskWaiter::get_instance().push(step_status.get().value());
+                    set_thread_state(thread->second, ThreadState::RUNNING);
+                    return {};
+                }
+            }
+        }
+
+        if(thread != _threads.end()) {
+            if(const auto result = thread->second.flush_registers(); result.is_error()) {
+                return kstd::Error {fmt::format("Unable to step thread {}: {}", thread_id, result.get_error())};
+            }
+        }
+
+        _memory_cache.invalidate();
+        _memory_map.invalidate();
+        if(::ptrace(PTRACE_SINGLESTEP, thread_id, nullptr, signal) < 0) {
+            return kstd::Error {fmt::format("Unable to step thread {}: {}", thread_id, platform::get_last_error())};
+        }
+
+        if(thread != _threads.end()) {
+            set_thread_state(thread->second, ThreadState::RUNNING);
+        }
+        return {};
+    }
+
+    /**
+     * This function stops the specified running thread, while all other threads keep running. Threads of an attached
+     * process are interrupted with PTRACE_INTERRUPT, threads of a started process are stopped with SIGSTOP.
+     *
+     * @param thread_id The id of the thread
+     * @return          Void or an error
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    auto ProcessContext::interrupt_thread(platform::TaskId thread_id) noexcept -> kstd::Result<void> {
+        const auto thread = _threads.find(thread_id);
+        if(thread == _threads.end()) {
+            return kstd::Error {
+                    fmt::format("Unable to interrupt thread {}: Thread is not owned by {}", thread_id, _process_id)};
+        }
+
+        if(thread->second._state != ThreadState::RUNNING) {
+            return {};
+        }
+
+        // PTRACE_INTERRUPT is only supported for seized threads
+        const auto result = _is_seized ? ::ptrace(PTRACE_INTERRUPT, thread_id, nullptr, nullptr)
+                                       : ::tgkill(_process_id, thread_id, SIGSTOP);
+        if(result < 0) {
+            return kstd::Error {
+                    fmt::format("Unable to interrupt thread {}: {}", thread_id, platform::get_last_error())};
+        }
+        return {};
+    }
+
+    /**
+     * This function adds the specified thread to the threads of this process. All hardware breakpoints of the
+     * process are set in the new thread.
+     *
+     * @param thread_id The id of the thread
+     * @return          Void or an error
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    auto ProcessContext::register_thread(platform::TaskId thread_id) noexcept -> kstd::Result<void> {
+        return set_hardware_breakpoints(insert_thread(thread_id));
+    }
+
+    /**
+     * This function adds a new context for the specified running thread to the threads of this process. An existing
+     * context of the thread is replaced.
+     *
+     * @param thread_id The id of the thread
+     * @return          The context of the thread
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    auto ProcessContext::insert_thread(platform::TaskId thread_id) noexcept -> ThreadContext& {
+        if(const auto thread = _threads.find(thread_id); thread != _threads.end()) {
+            set_thread_state(thread->second, ThreadState::EXITED);
+        }
+
+        ++_running_thread_count;
+        platform::TaskWaiter::get_instance().add_task(thread_id);
+        return _threads.insert_or_assign(thread_id, ThreadContext {_process_id, thread_id}).first->second;
+    }
+
+    /**
+     * This function removes the specified thread from the threads of this process.
+     *
+     * @param thread The thread
+     * @return       The iterator to the next thread
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    auto ProcessContext::erase_thread(std::unordered_map<platform::TaskId, ThreadContext>::iterator thread) noexcept
+            -> std::unordered_map<platform::TaskId, ThreadContext>::iterator {
+        set_thread_state(thread->second, ThreadState::EXITED);
+        platform::TaskWaiter::get_instance().remove_task(thread->first);
+        return _threads.erase(thread);
+    }
+
+    /**
+     * This function changes the run state of the specified thread and updates the count of running threads.
+     *
+     * @param thread The thread
+     * @param state  The new run state
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    auto ProcessContext::set_thread_state(ThreadContext& thread, ThreadState state) noexcept -> void {
+        if(thread._state == ThreadState::RUNNING && state != ThreadState::RUNNING) {
+            --_running_thread_count;
+        }
+        else if(thread._state != ThreadState::RUNNING && state == ThreadState::RUNNING) {
+            // All stops were handled, so no thread can report a trap of a removed breakpoint anymore
+            if(_running_thread_count == 0) {
+                _stale_breakpoints.clear();
+            }
+            ++_running_thread_count;
+        }
+        thread._state = state;
+    }
+
+    /**
+     * This function remembers the address of the specified breakpoint, which was removed from the memory. Running
+     * threads may have hit the breakpoint already, their traps are reported after the removal.
+     *
+     * @param address The address of the breakpoint
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto ProcessContext::mark_stale_breakpoint(std::intptr_t address) noexcept -> void {
+        if(_running_thread_count > 0) {
+            _stale_breakpoints.insert(address);
+        }
+    }
+
+    /**
+     * This function sets all hardware breakpoints of the process in the specified stopped thread and clears the
+     * breakpoints of the thread which were removed from the process meanwhile.
+     *
+     * @param thread The thread
+     * @return       Void or an error
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    auto ProcessContext::set_hardware_breakpoints(ThreadContext& thread) noexcept -> kstd::Result<void> {
+        for(std::size_t slot = 0; slot < _hardware_breakpoints.size(); ++slot) {
+            const auto result = _hardware_breakpoints[slot].has_value()
+                                        ? thread.set_hardware_breakpoint(slot, *_hardware_breakpoints[slot])
+                                        : thread.clear_hardware_breakpoint(slot);
+            if(result.is_error()) {
+                return kstd::Error {result.get_error()};
+            }
+        }
+        thread._hardware_breakpoints_pending = false;
+        return {};
+    }
+
+    /**
+     * This function adds the specified hardware breakpoint to a free debug register slot of all threads. Threads
+     * registered later get the breakpoint too. The debug registers can only be written while a thread is stopped, so
+     * running threads get the breakpoint at their next stop.
+     *
+     * @param breakpoint The hardware breakpoint
+     * @return           The slot of the breakpoint or an error
+     * @author           Cedric Hammes
+     * @since            16/10/2026
+     */
+    auto ProcessContext::add_hardware_breakpoint(const HardwareBreakpoint& breakpoint) noexcept
+            -> kstd::Result<std::size_t> {
+        using namespace std::string_literals;
+
+        // A slot is only free when no running thread still has a removed breakpoint in it
+        std::optional<std::size_t> free_slot {};
+        for(std::size_t slot = 0; slot < _hardware_breakpoints.size() && !free_slot.has_value(); ++slot) {
+            if(!_hardware_breakpoints[slot].has_value() &&
+               std::none_of(_threads.cbegin(), _threads.cend(), [&](const auto& thread) {
+                   return thread.second.get_hardware_breakpoints()[slot].has_value();
+               })) {
+                free_slot = slot;
+            }
+        }
+
+        if(!free_slot.has_value()) {
+            return kstd::Error {"Unable to add hardware breakpoint: All debug registers are in use"s};
+        }
+
+        if(!_image_identity.has_value()) {
+            _image_identity = read_image_identity(_process_id);
+        }
+
+        // Set the breakpoint in all stopped threads, the threads already modified are rolled back on failure.
+        // Starting threads get the breakpoint at their first stop, running threads at their next stop.
+        const auto slot = *free_slot;
+        for(auto& [thread_id, thread] : _threads) {
+            if(thread._is_starting) {
+                continue;
+            }
+
+            if(!thread.is_stopped()) {
+                thread._hardware_breakpoints_pending = true;
+                continue;
+            }
+
+            if(const auto result = thread.set_hardware_breakpoint(slot, breakpoint); result.is_error()) {
+                for(auto& [_, other_thread] : _threads) {
+                    if(other_thread.is_stopped()) {
+                        static_cast<void>(other_thread.clear_hardware_breakpoint(slot));
+                    }
+                }
+                return kstd::Error {result.get_error()};
+            }
+        }
+
+        _hardware_breakpoints[slot] = breakpoint;
+        return slot;
+    }
+
+    /**
+     * This function removes the hardware breakpoint in the specified slot from all threads. Running threads clear the
+     * breakpoint at their next stop, the slot stays in use until then.
+     *
+     * @param slot The slot of the breakpoint
+     * @return     Void or an error
+     * @author     Cedric Hammes
+     * @since      16/10/2026
+     */
+    auto ProcessContext::remove_hardware_breakpoint(std::size_t slot) noexcept -> kstd::Result<void> {
+        if(slot >= _hardware_breakpoints.size() || !_hardware_breakpoints[slot].has_value()) {
+            return kstd::Error {fmt::format("Unable to remove hardware breakpoint: Slot {} is not in use", slot)};
+        }
+
+        // Clear the breakpoint in all stopped threads, even when some of them fail
+        kstd::Result<void> result {};
+        for(auto& [thread_id, thread] : _threads) {
+            if(thread._is_starting) {
+                continue;
+            }
+
+            if(!thread.is_stopped()) {
+                thread._hardware_breakpoints_pending = true;
+                continue;
+            }
+
+            if(auto thread_result = thread.clear_hardware_breakpoint(slot); thread_result.is_error()) {
+                result = kstd::Error {thread_result.get_error()};
+            }
+        }
+        _hardware_breakpoints[slot].reset();
+        return result;
+    }
+
+    /**
+     * This function adds a breakpoint at the address of the symbol with the specified name.
+     *
+     * @param symbol_name The name of the symbol
+     * @return            Void or an error
+     * @author            Cedric Hammes
+     * @since             16/10/2026
+     */
+    auto ProcessContext::add_breakpoint(std::string_view symbol_name) noexcept -> kstd::Result<void> {
+        const auto symbols = get_symbols();
+        if(symbols.is_error()) {
+            return kstd::Error {fmt::format("Unable to set breakpoint: {}", symbols.get_error())};
+        }
+
+        const auto address = symbols.get()->find_address(symbol_name);
+        if(!address.has_value()) {
+            return kstd::Error {fmt::format("Unable to set breakpoint: Symbol {} doesn't exist", symbol_name)};
+        }
+        return add_breakpoint(*address);
+    }
+
+    /**
+     * This function adds breakpoints at the statements of the specified line in the specified source file.
+     *
+     * @param file The path or the end of the path of the source file
+     * @param line The line in the source file
+     * @return     Void or an error
+     * @author     Cedric Hammes
+     * @since      16/10/2026
+     */
+    auto ProcessContext::add_breakpoint(std::string_view file, kstd::u32 line) noexcept -> kstd::Result<void> {
+        const auto line_table = get_line_table();
+        if(line_table.is_error()) {
+            return kstd::Error {fmt::format("Unable to set breakpoint: {}", line_table.get_error())};
+        }
+
+        const auto addresses = line_table.get()->find_addresses(file, line);
+        if(addresses.is_error()) {
+            return kstd::Error {fmt::format("Unable to set breakpoint: {}", addresses.get_error())};
+        }
+
+        if(addresses.get().empty()) {
+            return kstd::Error {fmt::format("Unable to set breakpoint: No code at {}:{}", file, line)};
+        }
+
+        for(auto& result : add_breakpoints(addresses.get())) {
+            if(result.is_error()) {
+                return result;
+            }
+        }
+        return {};
+    }
+
+    /**
+     * This function adds a breakpoint at the specified address when no breakpoint was added before
+     *
+     * @param address The breakpoint address
+     * @return        Void or an error
+     * @author        Cedric Hammes
+     * @since         09/03/2024
+     */
+    auto ProcessContext::add_breakpoint(std::intptr_t address) noexcept -> kstd::Result<void> {
+        return add_breakpoints({&address, 1}).front();
+    }
+
+    /**
+     * This function removes the breakpoint from the specified address when no breakpoint was added before
+     *
+     * @param address The breakpoint address
+     * @return        Void or an error
+     * @author        Cedric Hammes
+     * @since         09/03/2024
+     */
+    auto ProcessContext::remove_breakpoint(std::intptr_t address) noexcept -> kstd::Result<void> {
+        return remove_breakpoints({&address, 1}).front();
+    }
+
+    /**
+     * This function adds breakpoints at all specified addresses. The addresses are grouped by page, so every page
+     * is patched with a single read-modify-write instead of one per breakpoint.
+     *
+     * @param addresses The breakpoint addresses
+     * @return          The result for each address, in the order of the specified addresses
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    auto ProcessContext::add_breakpoints(std::span<const std::intptr_t> addresses) noexcept
+            -> std::vector<kstd::Result<void>> {
+        using namespace std::string_literals;
+        std::vector<kstd::Result<void>> results(addresses.size());
+        if(const auto running = is_process_running(); running.is_error() || !running.get()) {
+            std::fill(results.begin(), results.end(), kstd::Error {"Unable to add breakpoint: No process is running"s});
+            return results;
+        }
+
+        // The image is remembered, so the breakpoints can be restored after the same image is executed again
+        if(!_image_identity.has_value()) {
+            _image_identity = read_image_identity(_process_id);
+        }
+
+        // Sort the new addresses, so breakpoints in the same page are adjacent
+        std::vector<std::size_t> indices {};
+        indices.reserve(addresses.size());
+        for(std::size_t i = 0; i < addresses.size(); ++i) {
+            if(_breakpoints.contains(addresses[i])) {
+                results[i] = kstd::Error {"Unable to set breakpoint: Breakpoint is already set"s};
+                continue;
+            }
+            indices.push_back(i);
+        }
+        std::sort(indices.begin(), indices.end(), [&](auto left, auto right) {
+            return addresses[left] < addresses[right];
+        });
+
+        std::vector<std::intptr_t> sorted_addresses {};
+        std::vector<std::size_t> sorted_indices {};
+        sorted_addresses.reserve(indices.size());
+        sorted_indices.reserve(indices.size());
+        for(const auto index : indices) {
+            if(!sorted_addresses.empty() && sorted_addresses.back() == addresses[index]) {
+                results[index] = kstd::Error {"Unable to set breakpoint: Breakpoint is already set"s};
+                continue;
+            }
+            sorted_addresses.push_back(addresses[index]);
+            sorted_indices.push_back(index);
+        }
+
+        // Insert interrupt instructions and keep the original bytes
+        std::vector<kstd::u8> saved_data(sorted_addresses.size());
+        const auto patch_results = patch_breakpoint_pages(sorted_addresses, [&](std::size_t index, kstd::u8& data) {
+            saved_data[index] = data;
+            data = Breakpoint::interrupt_instruction;
+        });
+
+        for(std::size_t i = 0; i < sorted_addresses.size(); ++i) {
+            results[sorted_indices[i]] = patch_results[i];
+            if(patch_results[i].is_error()) {
+                continue;
+            }
+
+            Breakpoint breakpoint {sorted_addresses[i]};
+            breakpoint._saved_data = saved_data[i];
+            breakpoint._enabled = true;
+            _breakpoints.insert(breakpoint);
+        }
+        return results;
+    }
+
+    /**
+     * This function removes the breakpoints from all specified addresses. The addresses are grouped by page, so
+     * every page is restored with a single read-modify-write instead of one per breakpoint.
+     *
+     * @param addresses The breakpoint addresses
+     * @return          The result for each address, in the order of the specified addresses
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    auto ProcessContext::remove_breakpoints(std::span<const std::intptr_t> addresses) noexcept
+            -> std::vector<kstd::Result<void>> {
+        using namespace std::string_literals;
+        std::vector<kstd::Result<void>> results(addresses.size());
+        if(const auto running = is_process_running(); running.is_error() || !running.get()) {
+            std::fill(results.begin(), results.end(),
+                      kstd::Error {"Unable to remove breakpoint: No process is running"s});
+            return results;
+        }
+
+        // Sort the enabled breakpoints, so breakpoints in the same page are adjacent. Disabled breakpoints don't
+        // modify the memory and are removed directly.
+        std::vector<std::size_t> indices {};
+        indices.reserve(addresses.size());
+        for(std::size_t i = 0; i < addresses.size(); ++i) {
+            const auto* breakpoint = _breakpoints.find(addresses[i]);
+            if(breakpoint == nullptr) {
+                results[i] = kstd::Error {"Unable to remove breakpoint: Breakpoint is not set"s};
+            }
+            else if(!breakpoint->is_enabled()) {
+                _breakpoints.erase(addresses[i]);
+                _tracepoints.erase(addresses[i]);
+                for(auto& scratch_page : _scratch_pages) {
+                    if(scratch_page.breakpoint == addresses[i]) {
+                        scratch_page.breakpoint = 0;
+                    }
+                }
+            }
+            else {
+                indices.push_back(i);
+            }
+        }
+        std::sort(indices.begin(), indices.end(), [&](auto left, auto right) {
+            return addresses[left] < addresses[right];
+        });
+
+        std::vector<std::intptr_t> sorted_addresses {};
+        std::vector<std::size_t> sorted_indices {};
+        for(const auto index : indices) {
+            if(!sorted_addresses.empty() && sorted_addresses.back() == addresses[index]) {
+                results[index] = kstd::Error {"Unable to remove breakpoint: Breakpoint is not set"s};
+                continue;
+            }
+            sorted_addresses.push_back(addresses[index]);
+            sorted_indices.push_back(index);
+        }
+
+        // Restore the original bytes
+        const auto patch_results = patch_breakpoint_pages(sorted_addresses, [&](std::size_t index, kstd::u8& data) {
+            data = _breakpoints.find(sorted_addresses[index])->_saved_data;
+        });
+
+        for(std::size_t i = 0; i < sorted_addresses.size(); ++i) {
+            results[sorted_indices[i]] = patch_results[i];
+            if(patch_results[i].is_ok()) {
+                mark_stale_breakpoint(sorted_addresses[i]);
+                _breakpoints.erase(sorted_addresses[i]);
+                _tracepoints.erase(sorted_addresses[i]);
+                for(auto& scratch_page : _scratch_pages) {
+                    if(scratch_page.breakpoint == sorted_addresses[i]) {
+                        scratch_page.breakpoint = 0;
+                    }
+                }
+            }
+        }
+        return results;
+    }
+
+    /**
+     * This function patches the bytes at the specified sorted addresses. All addresses in the same page are
+     * patched with a single read-modify-write of the range between the first and the last address. The reads and
+     * writes of all pages are batched, so only pages which fail are retried separately.
+     *
+     * @param addresses The sorted, unique addresses to patch
+     * @param patch     The function patching the byte at the address with the specified index
+     * @return          The result for each address
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    auto ProcessContext::patch_breakpoint_pages(std::span<const std::intptr_t> addresses,
+                                                const std::function<void(std::size_t, kstd::u8&)>& patch) noexcept
+            -> std::vector<kstd::Result<void>> {
+        struct PageGroup final {
+            std::intptr_t address;
+            std::size_t size;
+            std::size_t data_offset;
+            std::size_t begin;
+            std::size_t end;
+            bool failed;
+        };
+
+        // Group addresses by page
+        std::vector<PageGroup> groups {};
+        std::size_t data_size = 0;
+        for(std::size_t i = 0; i < addresses.size(); ++i) {
+            const auto page_address = MemoryCache::get_page_address(addresses[i]);
+            if(groups.empty() || MemoryCache::get_page_address(groups.back().address) != page_address) {
+                groups.push_back({addresses[i], 0, data_size, i, i, false});
+            }
+
+            auto& group = groups.back();
+            data_size -= group.size;
+            group.size = static_cast<std::size_t>(addresses[i] - group.address) + 1;
+            group.end = i + 1;
+            data_size += group.size;
+        }
+
+        std::vector<kstd::Result<void>> results(addresses.size());
+        const auto fail_group = [&](PageGroup& group, const std::string& error) {
+            group.failed = true;
+            std::fill(results.begin() + static_cast<std::ptrdiff_t>(group.begin),
+                      results.begin() + static_cast<std::ptrdiff_t>(group.end), kstd::Error {error});
+        };
+
+        // Read all groups at once, retry the groups separately when the batch fails
+        std::vector<kstd::u8> data(data_size);
+        std::vector<MemoryReadRequest> read_requests {};
+        read_requests.reserve(groups.size());
+        for(const auto& group : groups) {
+            read_requests.push_back({group.address, {data.data() + group.data_offset, group.size}});
+        }
+
+        if(read_memory_uncached(read_requests).is_error()) {
+            for(std::size_t i = 0; i < groups.size(); ++i) {
+                if(const auto result = read_memory_uncached({&read_requests[i], 1}); result.is_error()) {
+                    fail_group(groups[i], result.get_error());
+                }
+            }
+        }
+
+        // Patch the bytes and write all groups at once, retry the groups separately when the batch fails
+        std::vector<MemoryWriteRequest> write_requests {};
+        std::vector<PageGroup*> written_groups {};
+        for(auto& group : groups) {
+            if(group.failed) {
+                continue;
+            }
+
+            for(auto i = group.begin; i < group.end; ++i) {
+                patch(i, data[group.data_offset + static_cast<std::size_t>(addresses[i] - group.address)]);
+            }
+            write_requests.push_back({group.address, {data.data() + group.data_offset, group.size}});
+            written_groups.push_back(&group);
+        }
+
+        if(write_memory(write_requests).is_error()) {
+            for(std::size_t i = 0; i < write_requests.size(); ++i) {
+                if(const auto result = write_memory({&write_requests[i], 1}); result.is_error()) {
+                    fail_group(*written_groups[i], result.get_error());
+                }
+            }
+        }
+        return results;
+    }
+
+    /**
+     * This function checks whether the process bound with the debug context is still running or has been
+     * terminated.
+     *
+     * @return Whether the process is still running
+     * @author Cedric Hammes
+     * @since  09/03/2024
+     */
+    auto ProcessContext::is_process_running() const noexcept -> kstd::Result<bool> {
+        return platform::is_process_running(_process_id);
+    }
+
+    /**
+     * This function reads the entry point of the executable from the auxiliary vector of the process.
+     *
+     * @return The entry point or an error
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto ProcessContext::get_entry_address() const noexcept -> kstd::Result<std::intptr_t> {
+        using namespace std::string_literals;
+        if(const auto entry_address = read_entry_address(_process_id); entry_address.has_value()) {
+            return *entry_address;
+        }
+        return kstd::Error {"Unable to read entry point: Entry point is unknown"s};
+    }
+
+    /**
+     * This function returns the symbol table of the executable of the process. The symbols are loaded when this
+     * function is called first, the addresses are relocated to the load address of the executable. The symbols
+     * are cached in the cache directory of the user.
+     *
+     * @return The symbol table or an error
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto ProcessContext::get_symbols() noexcept -> kstd::Result<SymbolTable*> {
+        if(!_symbols.has_value()) {
+            try {
+                _symbols.emplace(_executable_path, get_cache_directory());
+            }
+            catch(const std::exception& error) {
+                return kstd::Error {std::string {error.what()}};
+            }
+
+            // The load bias is only known after the executable was loaded, so the entry point is compared
+            if(const auto entry_address = get_entry_address(); entry_address.is_ok()) {
+                _symbols->set_load_bias(entry_address.get() - _symbols->get_entry_address());
+            }
+        }
+        return &*_symbols;
+    }
+
+    /**
+     * This function returns the line table of the executable of the process. The line table is loaded when this
+     * function is called first, the addresses are relocated like the addresses of the symbols. The index of the
+     * line table is cached in the cache directory of the user.
+     *
+     * @return The line table or an error
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto ProcessContext::get_line_table() noexcept -> kstd::Result<LineTable*> {
+        if(!_line_table.has_value()) {
+            const auto symbols = get_symbols();
+            if(symbols.is_error()) {
+                return kstd::Error {symbols.get_error()};
+            }
+
+            try {
+                _line_table.emplace(_executable_path, get_cache_directory());
+            }
+            catch(const std::exception& error) {
+                return kstd::Error {std::string {error.what()}};
+            }
+            _line_table->set_load_bias(symbols.get()->get_load_bias());
+        }
+        return &*_line_table;
     }
 }// namespace libdebug
 #endif
\ No newline at end of file
@@ -0,0 +1,303 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#ifdef PLATFORM_LINUX
+#include "libdebug/profiler.hpp"
+#include "libdebug/cache.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <map>
+#include <thread>
+#include <unordered_set>
+
+namespace libdebug {
+    /**
+     * This function hashes the addresses of the specified stack with FNV-1a.
+     *
+     * @param stack The addresses of the stack
+     * @return      The hash of the stack
+     * @author      Cedric Hammes
+     * @since       16/10/2026
+     */
+    auto Profiler::StackHash::operator()(const std::vector<std::intptr_t>& stack) const noexcept -> std::size_t {
+        std::size_t hash = 14695981039346656037ULL;
+        for(const auto address : stack) {
+            hash = (hash ^ static_cast<std::size_t>(address)) * 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    /**
+     * This constructor creates a profiler without samples for the specified process.
+     *
+     * @param process_context The process
+     * @param max_depth       The maximal count of frames of a stack
+     * @author                Cedric Hammes
+     * @since                 16/10/2026
+     */
+    Profiler::Profiler(ProcessContext& process_context, std::size_t max_depth) noexcept ://NOLINT
+            _process_context {&process_context},
+            _max_depth {max_depth},
+            _stacks {},
+            _sample_count {0},
+            _thread_sample_count {0},
+            _sample_time {} {
+    }
+
+    /**
+     * This function unwinds the stack of the specified stopped thread and counts the stack.
+     *
+     * @param thread The stopped thread
+     * @return       Void or an error
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    auto Profiler::sample_thread(ThreadContext& thread) noexcept -> kstd::Result<void> {
+        auto stack = _process_context->get_backtrace(thread.get_thread_id(), _max_depth);
+        if(stack.is_error()) {
+            return kstd::Error {
+                    fmt::format("Unable to sample thread {}: {}", thread.get_thread_id(), stack.get_error())};
+        }
+
+        ++_stacks[std::move(stack.get())];
+        ++_thread_sample_count;
+        return {};
+    }
+
+    /**
+     * This function takes a single sample of all threads of the process. Running threads are interrupted and
+     * resumed after they were sampled, stopped threads are sampled and stay stopped. Other signals arriving while
+     * waiting for the interrupts are delivered to their thread.
+     *
+     * @return Void or an error
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto Profiler::sample() noexcept -> kstd::Result<void> {
+        using namespace std::chrono_literals;
+        const auto start_time = std::chrono::steady_clock::now();
+        auto& threads = _process_context->get_threads();
+
+        // Interrupt all running threads at once, so the threads are sampled at nearly the same time
+        std::unordered_set<platform::TaskId> interrupted_threads {};
+        for(auto& [thread_id, thread] : threads) {
+            if(thread.get_state() == ThreadState::RUNNING) {
+                if(const auto result = _process_context->interrupt_thread(thread_id); result.is_error()) {
+                    return kstd::Error {fmt::format("Unable to sample process: {}", result.get_error())};
+                }
+                interrupted_threads.insert(thread_id);
+            }
+            else if(thread.is_stopped()) {
+                if(const auto result = sample_thread(thread); result.is_error()) {
+                    return kstd::Error {fmt::format("Unable to sample process: {}", result.get_error())};
+                }
+            }
+        }
+
+        // Sample and resume each thread as soon as it stopped
+        while(!interrupted_threads.empty()) {
+            const auto signal = _process_context->wait_for_signal(10ms);
+            if(signal.is_error()) {
+                return kstd::Error {fmt::format("Unable to sample process: {}", signal.get_error())};
+            }
+
+            // Threads exiting before their interrupt never report it
+            if(!signal.get().has_value()) {
+                std::erase_if(interrupted_threads,
+                              [&](platform::TaskId thread_id) { return !threads.contains(thread_id); });
+                continue;
+            }
+
+            const auto thread_id = signal.get()->get_thread()->get_thread_id();
+            auto& thread = threads.at(thread_id);
+            if(thread.get_state() == ThreadState::EXITED) {
+                return kstd::Error {fmt::format("Unable to sample process: Process {} exited",
+                                                _process_context->get_process_id())};
+            }
+
+            // Other signals are delivered, traps are caused by the debugger and suppressed
+            const auto signal_number = signal.get()->get_signal_info().si_signo;
+            if(!signal.get()->is_interrupt() || !interrupted_threads.contains(thread_id)) {
+                const auto delivered_signal = signal_number == SIGTRAP ? 0 : signal_number;
+                const auto result = _process_context->resume_thread(thread_id, delivered_signal);
+                if(result.is_error()) {
+                    return kstd::Error {fmt::format("Unable to sample process: {}", result.get_error())};
+                }
+                continue;
+            }
+
+            interrupted_threads.erase(thread_id);
+            if(const auto result = sample_thread(thread); result.is_error()) {
+                return kstd::Error {fmt::format("Unable to sample process: {}", result.get_error())};
+            }
+
+            if(const auto result = _process_context->resume_thread(thread_id); result.is_error()) {
+                return kstd::Error {fmt::format("Unable to sample process: {}", result.get_error())};
+            }
+        }
+
+        ++_sample_count;
+        _sample_time += std::chrono::steady_clock::now() - start_time;
+        return {};
+    }
+
+    /**
+     * This function samples the process at the specified interval until the specified duration is elapsed or the
+     * process exited. Samples which are missed, because sampling took longer than the interval, are skipped.
+     *
+     * @param interval The time between the start of two samples
+     * @param duration The time to profile
+     * @return         Void or an error
+     * @author         Cedric Hammes
+     * @since          16/10/2026
+     */
+    auto Profiler::run(std::chrono::microseconds interval, std::chrono::milliseconds duration) noexcept
+            -> kstd::Result<void> {
+        const auto end_time = std::chrono::steady_clock::now() + duration;
+        auto next_sample_time = std::chrono::steady_clock::now();
+        while(next_sample_time < end_time) {
+            std::this_thread::sleep_until(next_sample_time);
+            if(const auto result = sample(); result.is_error()) {
+                const auto is_running = _process_context->is_process_running();
+                if(is_running.is_ok() && !is_running.get()) {
+                    return {};
+                }
+                return result;
+            }
+
+            next_sample_time += interval;
+            next_sample_time = std::max(next_sample_time, std::chrono::steady_clock::now());
+        }
+        return {};
+    }
+
+    /**
+     * This function loads the symbols of the specified mapped file with the symbol cache. The load bias is derived
+     * from the first mapping of the file, like the load bias of the unwind modules.
+     *
+     * @param path       The path of the mapped file
+     * @param memory_map The memory map
+     * @return           The symbol table, no value when the file has no symbols
+     * @author           Cedric Hammes
+     * @since            17/10/2026
+     */
+    static auto load_module_symbols(std::string_view path, const MemoryMap& memory_map) noexcept
+            -> std::optional<SymbolTable> {
+        if(!path.starts_with('/')) {
+            return {};
+        }
+
+        std::optional<SymbolTable> symbols {};
+        try {
+            symbols.emplace(std::filesystem::path {path}, get_cache_directory());
+        }
+        catch(const std::exception&) {
+            return {};
+        }
+
+        for(std::size_t index = 0; index < memory_map.size(); ++index) {
+            const auto region = memory_map.get_region(index);
+            if(region.path == path) {
+                const auto file_address = region.begin - static_cast<std::intptr_t>(region.offset);
+                symbols->set_load_bias(file_address - symbols->get_base_address());
+                break;
+            }
+        }
+        return symbols;
+    }
+
+    /**
+     * This function returns the name of the specified address. Addresses in the executable are named by their
+     * symbol, addresses in other mapped files by the symbol of the file. The symbols of a file are loaded on its
+     * first frame. Addresses without symbol are named by the file name of their mapping and the offset in the file.
+     *
+     * @param address        The address
+     * @param symbols        The symbol table or nullptr
+     * @param memory_map     The memory map or nullptr
+     * @param module_symbols The symbols of the mapped files by path, which were loaded already
+     * @return               The name of the address
+     * @author               Cedric Hammes
+     * @since                16/10/2026
+     */
+    auto Profiler::format_frame(std::intptr_t address, const SymbolTable* symbols, const MemoryMap* memory_map,
+                                ModuleSymbols& module_symbols) const noexcept -> std::string {
+        if(symbols != nullptr) {
+            if(const auto symbol = symbols->find_symbol(address); symbol.has_value()) {
+                return std::string {symbol->name};
+            }
+        }
+
+        if(memory_map != nullptr) {
+            if(const auto region = memory_map->find_region(address); region.has_value() && !region->path.empty()) {
+                auto module = module_symbols.find(std::string {region->path});
+                if(module == module_symbols.end()) {
+                    auto loaded_symbols = load_module_symbols(region->path, *memory_map);
+                    module = module_symbols.emplace(std::string {region->path}, std::move(loaded_symbols)).first;
+                }
+
+                if(module->second.has_value()) {
+                    if(const auto symbol = module->second->find_symbol(address); symbol.has_value()) {
+                        return std::string {symbol->name};
+                    }
+                }
+
+                const auto file_offset = static_cast<kstd::u64>(address - region->begin) + region->offset;
+                return fmt::format("{}+{:#x}", std::filesystem::path {region->path}.filename().string(), file_offset);
+            }
+        }
+        return fmt::format("{:#x}", address);
+    }
+
+    /**
+     * This function writes the aggregated stacks in the folded format, with one line of semicolon-separated
+     * frames from the outermost to the innermost frame and the count of samples per stack. Frames are symbolized
+     * with the symbol table of their mapped file, frames without symbol are written as module and offset.
+     *
+     * @param stream The stream to write into
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    auto Profiler::write_folded(std::ostream& stream) noexcept -> void {
+        const auto symbols = _process_context->get_symbols();
+        const auto memory_map = _process_context->get_memory_map();
+        const auto* symbol_table = symbols.is_ok() ? symbols.get() : nullptr;
+        const auto* map = memory_map.is_ok() ? memory_map.get() : nullptr;
+
+        // Stacks with different addresses can end up in the same functions, so they are merged by their names. The
+        // return addresses are looked up one byte before, so calls at the end of a function stay in the function.
+        std::map<std::string, std::size_t> folded_stacks {};
+        ModuleSymbols module_symbols {};
+        for(const auto& [stack, count] : _stacks) {
+            std::string folded_stack {};
+            for(auto frame = stack.rbegin(); frame != stack.rend(); ++frame) {
+                if(!folded_stack.empty()) {
+                    folded_stack += ';';
+                }
+                const auto address = frame + 1 == stack.rend() ? *frame : *frame - 1;
+                folded_stack += format_frame(address, symbol_table, map, module_symbols);
+            }
+            folded_stacks[folded_stack] += count;
+        }
+
+        for(const auto& [folded_stack, count] : folded_stacks) {
+            stream << folded_stack << ' ' << count << '\n';
+        }
+    }
+}// namespace libdebug
+#endif
\ No newline at end of file
@@ -0,0 +1,249 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#ifdef PLATFORM_LINUX
+#include "libdebug/session.hpp"
+#include "libdebug/platform/waiter.hpp"
+#include <array>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace libdebug {
+    /**
+     * This constructor creates an empty debug session with its epoll instance.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    DebugSession::DebugSession() ://NOLINT
+            _poll_handle {-1},
+            _wake_handle {-1},
+            _processes {},
+            _thread_owners {},
+            _process_handles {} {
+        if(const auto result = platform::TaskWaiter::get_instance().setup(); result.is_error()) {
+            throw std::runtime_error {fmt::format("Unable to create debug session: {}", result.get_error())};
+        }
+
+        _poll_handle = ::epoll_create1(EPOLL_CLOEXEC);
+        if(_poll_handle < 0) {
+            throw std::runtime_error {fmt::format("Unable to create debug session: {}", platform::get_last_error())};
+        }
+
+        _wake_handle = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if(_wake_handle < 0) {
+            ::close(_poll_handle);
+            throw std::runtime_error {fmt::format("Unable to create debug session: {}", platform::get_last_error())};
+        }
+
+        // Register SIGCHLD notifications of the wait backend and the wake handle in the epoll instance
+        for(const auto handle : {platform::TaskWaiter::get_instance().get_handle(), _wake_handle}) {
+            epoll_event event {};
+            event.events = EPOLLIN;
+            event.data.fd = handle;
+            if(::epoll_ctl(_poll_handle, EPOLL_CTL_ADD, handle, &event) < 0) {
+                ::close(_wake_handle);
+                ::close(_poll_handle);
+                throw std::runtime_error {
+                        fmt::format("Unable to create debug session: {}", platform::get_last_error())};
+            }
+        }
+    }
+
+    DebugSession::~DebugSession() noexcept {
+        ::close(_wake_handle);
+        ::close(_poll_handle);
+    }
+
+    /**
+     * This function moves the specified process context into the session. All following stop notifications of
+     * the process are handled by this session.
+     *
+     * @param process_context The process context to add
+     * @return                A reference to the process context owned by the session
+     * @author                Cedric Hammes
+     * @since                 16/10/2026
+     */
+    auto DebugSession::add_process(ProcessContext&& process_context) noexcept -> ProcessContext& {
+        const auto process_id = process_context.get_process_id();
+        for(const auto& [thread_id, _] : process_context.get_threads()) {
+            _thread_owners.insert_or_assign(thread_id, process_id);
+        }
+
+        // The pidfd gets readable once when the process exits. Without pidfd support, the exit is only noticed through
+        // SIGCHLD.
+        platform::OwnedHandle process_handle {
+                static_cast<platform::FileHandle>(::syscall(SYS_pidfd_open, process_id, 0))};
+        if(process_handle.is_valid()) {
+            epoll_event event {};
+            event.events = EPOLLIN | EPOLLONESHOT;
+            event.data.fd = process_handle.get();
+            if(::epoll_ctl(_poll_handle, EPOLL_CTL_ADD, process_handle.get(), &event) == 0) {
+                _process_handles.insert_or_assign(process_id, std::move(process_handle));
+            }
+        }
+        return _processes.insert_or_assign(process_id, std::move(process_context)).first->second;
+    }
+
+    /**
+     * This function removes the process context of the specified process from the session and returns it to the
+     * caller.
+     *
+     * @param process_id The pid of the process
+     * @return           The process context or an error
+     * @author           Cedric Hammes
+     * @since            16/10/2026
+     */
+    auto DebugSession::remove_process(platform::TaskId process_id) noexcept -> kstd::Result<ProcessContext> {
+        auto process = _processes.extract(process_id);
+        if(process.empty()) {
+            return kstd::Error {fmt::format("Unable to remove process {}: Process is not in session", process_id)};
+        }
+
+        std::erase_if(_thread_owners, [&](const auto& owner) { return owner.second == process_id; });
+        if(const auto process_handle = _process_handles.find(process_id); process_handle != _process_handles.end()) {
+            ::epoll_ctl(_poll_handle, EPOLL_CTL_DEL, process_handle->second.get(), nullptr);
+            _process_handles.erase(process_handle);
+        }
+        return {std::move(process.mapped())};
+    }
+
+    /**
+     * This function returns the process context owning the specified thread. When the cached owner doesn't own the
+     * thread anymore or the thread is unknown, the owner is resolved by asking every process context, so threads added
+     * by the process contexts while polling are picked up.
+     *
+     * @param thread_id The id of the thread
+     * @return          The owning process context or nullptr
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    auto DebugSession::find_owner(platform::TaskId thread_id) noexcept -> ProcessContext* {
+        if(const auto owner = _thread_owners.find(thread_id); owner != _thread_owners.end()) {
+            auto& process = _processes.at(owner->second);
+            if(process.owns_task(thread_id)) {
+                return &process;
+            }
+            _thread_owners.erase(owner);
+        }
+
+        for(auto& [process_id, process] : _processes) {
+            if(process.owns_task(thread_id)) {
+                _thread_owners.insert_or_assign(thread_id, process_id);
+                return &process;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * This function waits until at least one thread of any process in the session changes its state, the session
+     * is woken up or the timeout is elapsed. All available events are dispatched to the event callbacks of their
+     * process context as signal events.
+     *
+     * @param timeout The maximum time to wait, or no value to wait infinitely
+     * @return        The count of dispatched events or an error
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto DebugSession::poll_events(std::optional<std::chrono::milliseconds> timeout) noexcept
+            -> kstd::Result<std::size_t> {
+        using namespace std::chrono;
+        auto& task_waiter = platform::TaskWaiter::get_instance();
+        const auto deadline = steady_clock::now() + timeout.value_or(milliseconds::zero());
+        const auto filter = [&](platform::TaskId task_id) { return find_owner(task_id) != nullptr; };
+
+        while(true) {
+            // Dispatch all available events without blocking
+            std::size_t dispatched_events = 0;
+            while(true) {
+                const auto task_status = task_waiter.wait(filter, milliseconds::zero());
+                if(task_status.is_error()) {
+                    return kstd::Error {task_status.get_error()};
+                }
+
+                if(!task_status.get().has_value()) {
+                    break;
+                }
+
+                auto* process = find_owner(task_status.get()->task_id);
+                const auto signal = process->handle_task_status(task_status.get().value());
+                if(signal.is_error()) {
+                    return kstd::Error {signal.get_error()};
+                }
+
+                // Thread lifecycle stops were already dispatched by the process context
+                if(!signal.get().has_value()) {
+                    continue;
+                }
+
+                ProcessEvent event {};
+                event.event_type = ProcessEventType::SIGNAL;
+                event.signal_event.process_id = process->get_process_id();
+                event.signal_event.thread_id = signal.get()->get_thread()->get_thread_id();
+                event.signal_event.signal_info = signal.get()->get_signal_info();
+                event.signal_event.is_exit = signal.get()->is_exit();
+                event.signal_event.exit_status = signal.get()->get_exit_status().value_or(0);
+                process->dispatch_event(event);
+                ++dispatched_events;
+            }
+
+            if(dispatched_events > 0) {
+                return dispatched_events;
+            }
+
+            // Sleep until SIGCHLD is pending, a process exited, the session is woken up or the timeout is elapsed
+            auto remaining_time = -1;
+            if(timeout.has_value()) {
+                remaining_time = static_cast<int>(std::max<milliseconds::rep>(
+                        duration_cast<milliseconds>(deadline - steady_clock::now()).count(), 0));
+                if(remaining_time == 0) {
+                    return dispatched_events;
+                }
+            }
+
+            std::array<epoll_event, 16> events {};
+            const auto event_count = ::epoll_wait(_poll_handle, events.data(), events.size(), remaining_time);
+            if(event_count < 0 && errno != EINTR) {
+                return kstd::Error {fmt::format("Unable to poll debug session: {}", platform::get_last_error())};
+            }
+
+            for(auto i = 0; i < event_count; ++i) {
+                if(events[i].data.fd == _wake_handle) {
+                    eventfd_t value = 0;
+                    ::eventfd_read(_wake_handle, &value);
+                    return dispatched_events;
+                }
+            }
+        }
+    }
+
+    /**
+     * This function wakes up a thread blocked in poll_events. This function can be called from any thread.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto DebugSession::wake() const noexcept -> void {
+        ::eventfd_write(_wake_handle, 1);
+    }
+}// namespace libdebug
+#endif
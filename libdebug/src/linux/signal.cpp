@@ -34,7 +34,20 @@ namespace libdebug {
             return false;
 
         const auto sig_code = _signal_info.si_code;
-        return sig_code == TRAP_BRKPT || sig_code == TRAP_TRACE;
+        return sig_code == TRAP_BRKPT || sig_code == TRAP_TRACE || sig_code == TRAP_HWBKPT || sig_code == SI_KERNEL;
+    }
+
+    /**
+     * This function checks whether the signal is the stop of an interrupted thread. Seized threads report the
+     * stop of PTRACE_INTERRUPT, other threads are interrupted with SIGSTOP.
+     *
+     * @return Whether the signal is an interrupt
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto Signal::is_interrupt() const noexcept -> bool {
+        return _signal_info.si_signo == SIGSTOP ||
+               (_signal_info.si_signo == SIGTRAP && _signal_info.si_code == (SIGTRAP | (PTRACE_EVENT_STOP << 8)));
     }
 }// namespace libdebug
 #endif
\ No newline at end of file
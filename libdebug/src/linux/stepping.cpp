@@ -0,0 +1,440 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#ifdef PLATFORM_LINUX
+#include "libdebug/arch/instruction.hpp"
+#include "libdebug/process.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/user.h>
+
+namespace libdebug {
+    /**
+     * This function executes a single instruction in the specified stopped thread and waits until the step is
+     * finished. Signals arriving while stepping are suppressed and raised again after the step, so they are reported
+     * by a later wait. The modified registers of the thread are written back before the step.
+     *
+     * @param thread The thread
+     * @return       The status of the thread after the step or an error
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    auto ProcessContext::single_step(ThreadContext& thread) noexcept -> kstd::Result<platform::TaskStatus> {
+        const auto thread_id = thread.get_thread_id();
+        auto& task_waiter = platform::TaskWaiter::get_instance();
+        auto suppressed_signal = 0;
+        while(true) {
+            if(const auto result = thread.flush_registers(); result.is_error()) {
+                return kstd::Error {fmt::format("Unable to step thread {}: {}", thread_id, result.get_error())};
+            }
+
+            _memory_cache.invalidate();
+            _memory_map.invalidate();
+            if(::ptrace(PTRACE_SINGLESTEP, thread_id, nullptr, 0) < 0) {
+                return kstd::Error {
+                        fmt::format("Unable to step thread {}: {}", thread_id, platform::get_last_error())};
+            }
+
+            const auto task_status =
+                    task_waiter.wait([thread_id](platform::TaskId task_id) { return task_id == thread_id; },
+                                     std::nullopt);
+            if(task_status.is_error()) {
+                return kstd::Error {task_status.get_error()};
+            }
+
+            // Lifecycle events of the stepped instruction, like a clone syscall, are handled before the step continues
+            const auto status = task_status.get().value();
+            const auto event = status.status >> 16;
+            if(WIFSTOPPED(status.status) && event != 0 && event != PTRACE_EVENT_EXEC) {
+                if(const auto result = handle_trace_event(thread, event); result.is_error()) {
+                    return kstd::Error {result.get_error()};
+                }
+                continue;
+            }
+
+            if(!WIFSTOPPED(status.status) || WSTOPSIG(status.status) == SIGTRAP) {
+                if(suppressed_signal != 0 && WIFSTOPPED(status.status)) {
+                    ::tgkill(thread.get_process_id(), thread_id, suppressed_signal);
+                }
+
+                // A traced syscall executed by the step has no exit stop, so its exit is dispatched after the step
+                if(WIFSTOPPED(status.status) && thread._syscall_number.has_value()) {
+                    if(const auto result = handle_syscall_stop(thread, false); result.is_error()) {
+                        return kstd::Error {result.get_error()};
+                    }
+                }
+                return status;
+            }
+            suppressed_signal = WSTOPSIG(status.status);
+        }
+    }
+
+    /**
+     * This function executes the specified syscall in the specified stopped thread. The syscall instruction is
+     * injected at the entry point of the executable, which is never executed again after the start of the process.
+     * The code and the registers of the thread are restored after the syscall, even when the syscall fails.
+     *
+     * @param thread    The stopped thread executing the syscall
+     * @param number    The number of the syscall
+     * @param arguments The arguments of the syscall
+     * @return          The raw return value of the syscall or an error
+     * @author          Cedric Hammes
+     * @since           17/10/2026
+     */
+    auto ProcessContext::inject_syscall(ThreadContext& thread, kstd::u64 number,
+                                        const std::array<kstd::u64, arch::syscall_argument_count>& arguments) noexcept
+            -> kstd::Result<kstd::u64> {
+#ifdef ARCH_X86_64
+        using namespace std::string_literals;
+
+        const auto entry_address_result = get_entry_address();
+        if(entry_address_result.is_error()) {
+            return kstd::Error {fmt::format("Unable to inject syscall: {}", entry_address_result.get_error())};
+        }
+        const auto entry_address = entry_address_result.get();
+
+        // Replace the entry point with a syscall instruction and prepare the arguments of the syscall
+        const auto saved_registers = thread.get_registers();
+        if(saved_registers.is_error()) {
+            return kstd::Error {fmt::format("Unable to inject syscall: {}", saved_registers.get_error())};
+        }
+
+        std::array<kstd::u8, 2> saved_code {};
+        if(const auto result = read_memory(entry_address, saved_code); result.is_error()) {
+            return kstd::Error {fmt::format("Unable to inject syscall: {}", result.get_error())};
+        }
+
+        constexpr std::array<kstd::u8, 2> syscall_instruction {0x0F, 0x05};
+        if(const auto result = write_memory(entry_address, syscall_instruction); result.is_error()) {
+            return kstd::Error {fmt::format("Unable to inject syscall: {}", result.get_error())};
+        }
+
+        auto registers = saved_registers.get();
+        registers.rip = entry_address;
+        registers.orig_rax = -1;
+        registers.rax = number;
+        registers.rdi = arguments[0];
+        registers.rsi = arguments[1];
+        registers.rdx = arguments[2];
+        registers.r10 = arguments[3];
+        registers.r8 = arguments[4];
+        registers.r9 = arguments[5];
+
+        // Execute the syscall, the code and the registers are restored even when the syscall fails
+        thread.set_registers(registers);
+        const auto task_status = single_step(thread);
+        std::optional<kstd::u64> syscall_result {};
+        if(task_status.is_ok() && WIFSTOPPED(task_status.get().status)) {
+            if(const auto result_registers = thread.get_registers(); result_registers.is_ok()) {
+                syscall_result = arch::get_return_value(result_registers.get());
+            }
+            thread.set_registers(saved_registers.get());
+        }
+
+        const auto restore_result = write_memory(entry_address, saved_code);
+        if(task_status.is_error()) {
+            return kstd::Error {fmt::format("Unable to inject syscall: {}", task_status.get_error())};
+        }
+
+        if(!WIFSTOPPED(task_status.get().status)) {
+            platform::TaskWaiter::get_instance().push(task_status.get());
+            return kstd::Error {fmt::format("Unable to inject syscall: Thread {} exited", thread.get_thread_id())};
+        }
+
+        if(restore_result.is_error()) {
+            return kstd::Error {fmt::format("Unable to inject syscall: {}", restore_result.get_error())};
+        }
+
+        if(!syscall_result.has_value()) {
+            return kstd::Error {"Unable to inject syscall: Unable to read result of syscall"s};
+        }
+        return *syscall_result;
+#else
+        using namespace std::string_literals;
+        return kstd::Error {"Unable to inject syscall: Architecture is not supported"s};
+#endif
+    }
+
+    /**
+     * This function maps a page for out-of-line execution into the process near the specified address, so
+     * RIP-relative operands can reach their targets from it. The placement is requested without replacing existing
+     * mappings and checked afterward, because kernels without MAP_FIXED_NOREPLACE treat the address as a hint only.
+     *
+     * @param thread  The stopped thread executing the syscall
+     * @param address The address the page should be placed near
+     * @return        The address of the page or an error
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto ProcessContext::allocate_scratch_page(ThreadContext& thread, std::intptr_t address) noexcept
+            -> kstd::Result<std::intptr_t> {
+        using namespace std::string_literals;
+
+        // Try the candidates from far to near, so the page doesn't block the growth of the mappings around the address
+        const auto page_address = MemoryCache::get_page_address(address);
+        for(auto distance = ScratchPage::reach; distance >= ScratchPage::min_distance; distance /= 2) {
+            for(const auto candidate : {page_address - distance, page_address + distance}) {
+                if(candidate <= 0) {
+                    continue;
+                }
+
+                const auto result = inject_syscall(thread, SYS_mmap,
+                                                   {static_cast<kstd::u64>(candidate), MemoryCache::page_size,
+                                                    PROT_READ | PROT_EXEC,
+                                                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE,
+                                                    static_cast<kstd::u64>(-1), 0});
+                if(result.is_error()) {
+                    return kstd::Error {fmt::format("Unable to allocate scratch page: {}", result.get_error())};
+                }
+
+                const auto scratch_address = static_cast<std::intptr_t>(result.get());
+                if(scratch_address < 0 && scratch_address > -4096) {
+                    continue;
+                }
+
+                if(std::abs(scratch_address - page_address) <= ScratchPage::reach) {
+                    return scratch_address;
+                }
+
+                // The kernel ignored the requested address, so the page is released again
+                const auto unmap_result = inject_syscall(thread, SYS_munmap,
+                                                         {static_cast<kstd::u64>(scratch_address),
+                                                          MemoryCache::page_size, 0, 0, 0, 0});
+                if(unmap_result.is_error()) {
+                    return kstd::Error {fmt::format("Unable to allocate scratch page: {}", unmap_result.get_error())};
+                }
+            }
+        }
+        return kstd::Error {"Unable to allocate scratch page: No free address in reach"s};
+    }
+
+    /**
+     * This function returns the scratch page in reach of the specified address. When no page is in reach, a new page
+     * is mapped near the address, so each window of the address space gets its own page.
+     *
+     * @param thread  The stopped thread mapping a new page
+     * @param address The address of the breakpoint
+     * @return        The scratch page or an error
+     * @author        Cedric Hammes
+     * @since         17/10/2026
+     */
+    auto ProcessContext::find_scratch_page(ThreadContext& thread, std::intptr_t address) noexcept
+            -> kstd::Result<ScratchPage*> {
+        const auto page_address = MemoryCache::get_page_address(address);
+        const auto scratch_page = std::find_if(_scratch_pages.begin(), _scratch_pages.end(), [&](const auto& page) {
+            return std::abs(page.address - page_address) <= ScratchPage::reach;
+        });
+        if(scratch_page != _scratch_pages.end()) {
+            return &*scratch_page;
+        }
+
+        const auto scratch_address = allocate_scratch_page(thread, address);
+        if(scratch_address.is_error()) {
+            return kstd::Error {scratch_address.get_error()};
+        }
+        return &_scratch_pages.emplace_back(ScratchPage {scratch_address.get(), 0, {}});
+    }
+
+    /**
+     * This function relocates the original instruction at the specified breakpoint into the scratch page. The
+     * interrupt instructions of all breakpoints inside of the instruction are replaced with the original bytes.
+     *
+     * @param address         The address of the breakpoint
+     * @param scratch_address The address of the scratch page
+     * @return                The relocated instruction or an error
+     * @author                Cedric Hammes
+     * @since                 16/10/2026
+     */
+    auto ProcessContext::relocate_breakpoint_instruction(std::intptr_t address, std::intptr_t scratch_address) noexcept
+            -> kstd::Result<arch::RelocatedInstruction> {
+        // Read the original instruction, the instruction may end in the next, unmapped page
+        std::array<kstd::u8, arch::max_instruction_size> code {};
+        auto code_size = code.size();
+        if(read_memory(address, code).is_error()) {
+            code_size = std::min(code_size, static_cast<std::size_t>(MemoryCache::get_page_address(address) +
+                                                                     MemoryCache::page_size - address));
+            if(const auto result = read_memory(address, {code.data(), code_size}); result.is_error()) {
+                return kstd::Error {result.get_error()};
+            }
+        }
+
+        for(std::size_t i = 0; i < code_size; ++i) {
+            const auto* breakpoint = _breakpoints.find(address + static_cast<std::intptr_t>(i));
+            if(breakpoint != nullptr && breakpoint->is_enabled()) {
+                code[i] = breakpoint->_saved_data;
+            }
+        }
+
+#ifdef ARCH_X86_64
+        return arch::relocate_instruction({code.data(), code_size}, address, scratch_address);
+#else
+        using namespace std::string_literals;
+        return kstd::Error {"Unable to relocate instruction: Architecture is not supported"s};
+#endif
+    }
+
+    /**
+     * This function executes the original instruction of the specified breakpoint in-place. The breakpoint is
+     * removed from the memory while stepping, so other running threads can miss it. This is only used for
+     * instructions which can't be relocated.
+     *
+     * @param thread     The thread
+     * @param breakpoint The breakpoint to step over
+     * @return           The status of the thread after the step or an error
+     * @author           Cedric Hammes
+     * @since            16/10/2026
+     */
+    auto ProcessContext::step_over_breakpoint_in_place(ThreadContext& thread, Breakpoint& breakpoint) noexcept
+            -> kstd::Result<std::optional<platform::TaskStatus>> {
+        if(const auto result = breakpoint.disable(*this); result.is_error()) {
+            return kstd::Error {fmt::format("Unable to step over breakpoint: {}", result.get_error())};
+        }
+
+        const auto task_status = single_step(thread);
+        if(task_status.is_error()) {
+            return kstd::Error {fmt::format("Unable to step over breakpoint: {}", task_status.get_error())};
+        }
+
+        if(const auto result = breakpoint.enable(*this); result.is_error()) {
+            return kstd::Error {fmt::format("Unable to step over breakpoint: {}", result.get_error())};
+        }
+        return {std::optional<platform::TaskStatus> {task_status.get()}};
+    }
+
+    /**
+     * This function executes the original instruction of the specified breakpoint in the specified thread, which is
+     * stopped at the breakpoint. The instruction is relocated into the scratch page and executed there, so the
+     * breakpoint is never removed from the memory. Instructions which can't be relocated are stepped in-place by
+     * removing the breakpoint temporarily. When the instruction pointer was changed, no step is done. Signals are
+     * delivered by the caller after the step, so the breakpoint isn't hit again when the signal handler returns.
+     *
+     * @param thread  The thread
+     * @param address The address of the breakpoint
+     * @return        The status of the thread after the step, no value when no step was done or an error
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto ProcessContext::step_over_breakpoint(ThreadContext& thread, std::intptr_t address) noexcept
+            -> kstd::Result<std::optional<platform::TaskStatus>> {
+#ifdef ARCH_X86_64
+        // The instruction isn't stepped, when the instruction pointer was moved away from the breakpoint
+        const auto instruction_pointer = thread.get_instruction_pointer();
+        if(instruction_pointer.is_error()) {
+            return kstd::Error {fmt::format("Unable to step over breakpoint: {}", instruction_pointer.get_error())};
+        }
+
+        auto* breakpoint = _breakpoints.find(address);
+        if(breakpoint == nullptr || !breakpoint->is_enabled() || instruction_pointer.get() != address) {
+            return {std::optional<platform::TaskStatus> {}};
+        }
+
+        // Relocate the instruction into the scratch page in reach, the last relocated instruction is kept in the page
+        const auto scratch_page = find_scratch_page(thread, address);
+        if(scratch_page.is_error()) {
+            return kstd::Error {fmt::format("Unable to step over breakpoint: {}", scratch_page.get_error())};
+        }
+
+        auto& page = *scratch_page.get();
+        if(page.breakpoint != address) {
+            const auto relocated = relocate_breakpoint_instruction(address, page.address);
+            if(relocated.is_error()) {
+                return step_over_breakpoint_in_place(thread, *breakpoint);
+            }
+
+            const auto& instruction = relocated.get();
+            page.breakpoint = 0;
+            if(const auto result = write_memory(page.address, {instruction.code.data(), instruction.size});
+               result.is_error()) {
+                return kstd::Error {fmt::format("Unable to step over breakpoint: {}", result.get_error())};
+            }
+            page.instruction = instruction;
+            page.breakpoint = address;
+        }
+
+        // Execute the instruction out-of-line
+        const auto scratch_address = page.address;
+        const auto instruction = page.instruction;
+        if(const auto result = thread.set_instruction_pointer(scratch_address); result.is_error()) {
+            return kstd::Error {fmt::format("Unable to step over breakpoint: {}", result.get_error())};
+        }
+
+        const auto task_status = single_step(thread);
+        if(task_status.is_error()) {
+            return kstd::Error {fmt::format("Unable to step over breakpoint: {}", task_status.get_error())};
+        }
+
+        if(!WIFSTOPPED(task_status.get().status)) {
+            return {std::optional<platform::TaskStatus> {task_status.get()}};
+        }
+
+        // Move the instruction pointer and the pushed return address back into the original code
+        const auto registers = thread.get_registers();
+        if(registers.is_error()) {
+            return kstd::Error {fmt::format("Unable to step over breakpoint: {}", registers.get_error())};
+        }
+
+        const auto next_address = address + static_cast<std::intptr_t>(instruction.original_size);
+        const auto scratch_end = scratch_address + static_cast<std::intptr_t>(instruction.size);
+        if(arch::get_instruction_pointer(registers.get()) == scratch_end) {
+            static_cast<void>(thread.set_instruction_pointer(next_address));
+        }
+
+        if(instruction.is_call) {
+            const auto return_address = static_cast<kstd::u64>(next_address);
+            const auto result = write_memory(arch::get_stack_pointer(registers.get()),
+                                             {reinterpret_cast<const kstd::u8*>(&return_address),
+                                              sizeof(return_address)});
+            if(result.is_error()) {
+                return kstd::Error {fmt::format("Unable to step over breakpoint: {}", result.get_error())};
+            }
+        }
+        return {std::optional<platform::TaskStatus> {task_status.get()}};
+#else
+        using namespace std::string_literals;
+        return kstd::Error {"Unable to step over breakpoint: Architecture is not supported"s};
+#endif
+    }
+
+    /**
+     * This function checks whether the stop after stepping over a breakpoint has to be reported by the next wait
+     * instead of resuming the thread. This is the case when the thread exited or the stepped instruction hit a
+     * hardware breakpoint.
+     *
+     * @param thread The stepped thread
+     * @param status The status of the thread after the step
+     * @return       Whether the stop is reported or an error
+     * @author       Cedric Hammes
+     * @since        17/10/2026
+     */
+    auto ProcessContext::is_step_reported(const ThreadContext& thread, const platform::TaskStatus& status) noexcept
+            -> kstd::Result<bool> {
+        if(!WIFSTOPPED(status.status)) {
+            return true;
+        }
+
+        const auto hardware_breakpoint_slot = thread.get_hardware_breakpoint_hit();
+        if(hardware_breakpoint_slot.is_error()) {
+            return kstd::Error {hardware_breakpoint_slot.get_error()};
+        }
+        return hardware_breakpoint_slot.get().has_value();
+    }
+}// namespace libdebug
+#endif
\ No newline at end of file
@@ -0,0 +1,405 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#ifdef PLATFORM_LINUX
+#include "libdebug/symbols.hpp"
+#include "libdebug/cache.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <elf.h>
+#include <limits>
+#include <stdexcept>
+
+namespace libdebug {
+    static constexpr std::array<char, 8> symbol_cache_magic {'L', 'D', 'S', 'Y', 'M', 'B', 'O', 'L'};
+
+    /**
+     * This structure is the header of a symbol cache file. The header is followed by the entries, the name index and
+     * the names, the name offsets of the entries are relative to the start of the cache file.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct SymbolCacheHeader final {
+        std::array<char, 8> magic;
+        kstd::u32 version;
+        kstd::u32 entry_count;
+        kstd::u32 name_index_size;
+        kstd::u32 names_size;
+        kstd::u64 executable_size;
+    };
+
+    /**
+     * This function copies the structure at the specified offset out of the specified data. The structures in the
+     * file are not guaranteed to be aligned, so they are never accessed in-place.
+     *
+     * @param data   The data of the file
+     * @param offset The offset of the structure
+     * @param value  The structure to copy into
+     * @return       Whether the structure is inside of the data
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    template<typename T>
+    static auto read_structure(std::span<const kstd::u8> data, std::size_t offset, T& value) noexcept -> bool {
+        if(offset > data.size() || data.size() - offset < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, data.data() + offset, sizeof(T));
+        return true;
+    }
+
+    /**
+     * This function returns the first slot of the probe sequence of the specified name in a name index with the
+     * specified capacity. The name index is stored in the cache files, so the name is hashed with FNV-1a instead of
+     * std::hash, which can differ between builds of the application.
+     *
+     * @param name     The name of the symbol
+     * @param capacity The capacity of the index, a power of two
+     * @return         The first slot of the probe sequence
+     * @author         Cedric Hammes
+     * @since          16/10/2026
+     */
+    static auto get_name_slot(std::string_view name, std::size_t capacity) noexcept -> std::size_t {
+        const auto shift = 64 - std::countr_zero(capacity);
+        kstd::u64 hash = 14695981039346656037ULL;
+        for(const auto character : name) {
+            hash = (hash ^ static_cast<kstd::u8>(character)) * 1099511628211ULL;
+        }
+        return static_cast<std::size_t>((hash * 0x9E3779B97F4A7C15ULL) >> shift);
+    }
+
+    /**
+     * This constructor maps the specified ELF executable and reads the symbols from the .symtab section, or from
+     * the .dynsym section when the executable is stripped. When a cache directory is specified, the symbols are
+     * loaded from the cache file of the executable or the cache file is created.
+     *
+     * @param path            The path to the executable
+     * @param cache_directory The directory of the cache files or no value to disable the cache
+     * @author                Cedric Hammes
+     * @since                 16/10/2026
+     */
+    SymbolTable::SymbolTable(const std::filesystem::path& path,
+                             const std::optional<std::filesystem::path>& cache_directory) ://NOLINT
+            _mapping {},
+            _entry_storage {},
+            _name_index_storage {},
+            _entries {},
+            _name_index {},
+            _entry_address {0},
+            _base_address {0},
+            _load_bias {0} {
+        auto mapping = platform::map_file(path);
+        if(mapping.is_error()) {
+            throw std::runtime_error {fmt::format("Unable to load symbols: {}", mapping.get_error())};
+        }
+        _mapping = std::move(mapping.get());
+
+        // Names are stored as 32-bit offsets into the mapping
+        const auto data = _mapping.get_data();
+        if(data.size() > std::numeric_limits<kstd::u32>::max()) {
+            throw std::runtime_error {fmt::format("Unable to load symbols: {} is too large", path.string())};
+        }
+
+        Elf64_Ehdr header {};
+        if(!read_structure(data, 0, header) || std::memcmp(header.e_ident, ELFMAG, SELFMAG) != 0 ||
+           header.e_ident[EI_CLASS] != ELFCLASS64 || header.e_shentsize != sizeof(Elf64_Shdr)) {
+            throw std::runtime_error {
+                    fmt::format("Unable to load symbols: {} is not a 64-bit ELF file", path.string())};
+        }
+        _entry_address = static_cast<std::intptr_t>(header.e_entry);
+
+        // The segments are sorted by address, so the first loadable segment is mapped at the base address
+        for(std::size_t index = 0; index < header.e_phnum; ++index) {
+            Elf64_Phdr segment {};
+            if(read_structure(data, header.e_phoff + index * sizeof(Elf64_Phdr), segment) &&
+               segment.p_type == PT_LOAD) {
+                _base_address = static_cast<std::intptr_t>(segment.p_vaddr - segment.p_offset);
+                break;
+            }
+        }
+
+        // The cache is keyed by the build-id, so executables without a build-id are never cached
+        std::optional<std::filesystem::path> cache_path {};
+        if(const auto build_id = read_build_id(data); cache_directory.has_value() && build_id.has_value()) {
+            cache_path = *cache_directory / fmt::format("{}.symbols", *build_id);
+            if(load_cache(*cache_path)) {
+                return;
+            }
+        }
+
+        // Find the symbol table, the dynamic symbols are a subset of the full symbol table
+        std::optional<Elf64_Shdr> symbol_section {};
+        for(std::size_t index = 0; index < header.e_shnum; ++index) {
+            Elf64_Shdr section {};
+            if(!read_structure(data, header.e_shoff + index * sizeof(Elf64_Shdr), section)) {
+                throw std::runtime_error {
+                        fmt::format("Unable to load symbols: Section {} of {} is truncated", index, path.string())};
+            }
+
+            if(section.sh_type == SHT_SYMTAB || (section.sh_type == SHT_DYNSYM && !symbol_section.has_value())) {
+                symbol_section = section;
+            }
+        }
+
+        if(!symbol_section.has_value()) {
+            return;
+        }
+
+        // The string table must be terminated, so names can be read without their length
+        Elf64_Shdr string_section {};
+        if(!read_structure(data, header.e_shoff + symbol_section->sh_link * sizeof(Elf64_Shdr), string_section) ||
+           string_section.sh_size == 0 || string_section.sh_offset > data.size() ||
+           data.size() - string_section.sh_offset < string_section.sh_size ||
+           data[string_section.sh_offset + string_section.sh_size - 1] != 0) {
+            throw std::runtime_error {
+                    fmt::format("Unable to load symbols: String table of {} is invalid", path.string())};
+        }
+
+        // Collect the defined functions and objects, the first symbol is always the undefined symbol
+        const auto symbol_count = symbol_section->sh_size / sizeof(Elf64_Sym);
+        _entry_storage.reserve(symbol_count);
+        for(std::size_t index = 1; index < symbol_count; ++index) {
+            Elf64_Sym symbol {};
+            if(!read_structure(data, symbol_section->sh_offset + index * sizeof(Elf64_Sym), symbol)) {
+                throw std::runtime_error {
+                        fmt::format("Unable to load symbols: Symbol table of {} is truncated", path.string())};
+            }
+
+            const auto type = ELF64_ST_TYPE(symbol.st_info);
+            if((type != STT_FUNC && type != STT_OBJECT && type != STT_GNU_IFUNC) || symbol.st_shndx == SHN_UNDEF ||
+               symbol.st_value == 0 || symbol.st_name == 0 || symbol.st_name >= string_section.sh_size) {
+                continue;
+            }
+
+            // The size shares its word with the function flag, so it is limited to 31 bits
+            const auto size = std::min<kstd::u64>(symbol.st_size, std::numeric_limits<kstd::u32>::max() >> 1);
+            _entry_storage.push_back({static_cast<std::intptr_t>(symbol.st_value), static_cast<kstd::u32>(size),
+                                      type != STT_OBJECT,
+                                      static_cast<kstd::u32>(string_section.sh_offset + symbol.st_name)});
+        }
+
+        std::sort(_entry_storage.begin(), _entry_storage.end(), [](const auto& left, const auto& right) {
+            return left.address < right.address;
+        });
+        _entry_storage.shrink_to_fit();
+        _entries = _entry_storage;
+
+        // The cache is only an optimization, so the symbols are usable when it can't be written
+        if(cache_path.has_value()) {
+            build_name_index();
+            static_cast<void>(write_cache(*cache_path));
+        }
+    }
+
+    /**
+     * This function maps the specified cache file and uses its entries and its name index in-place. The cache file is
+     * validated, so a damaged cache file is never used.
+     *
+     * @param path The path of the cache file
+     * @return     Whether the cache file was loaded
+     * @author     Cedric Hammes
+     * @since      16/10/2026
+     */
+    auto SymbolTable::load_cache(const std::filesystem::path& path) noexcept -> bool {
+        auto mapping = platform::map_file(path);
+        if(mapping.is_error()) {
+            return false;
+        }
+
+        const auto data = mapping.get().get_data();
+        SymbolCacheHeader header {};
+        if(!read_structure(data, 0, header) || header.magic != symbol_cache_magic || header.version != cache_version ||
+           header.executable_size != _mapping.get_data().size()) {
+            return false;
+        }
+
+        const auto name_index_offset = sizeof(header) + static_cast<std::size_t>(header.entry_count) * sizeof(Entry);
+        const auto names_offset = name_index_offset + static_cast<std::size_t>(header.name_index_size) * 4;
+        if(names_offset + header.names_size != data.size() || header.names_size == 0 || data.back() != 0) {
+            return false;
+        }
+
+        // The probe sequence of the name index only terminates when the index has an empty slot
+        if(header.entry_count != 0 &&
+           (!std::has_single_bit(header.name_index_size) || header.name_index_size <= header.entry_count)) {
+            return false;
+        }
+
+        const std::span entries {reinterpret_cast<const Entry*>(data.data() + sizeof(header)), header.entry_count};
+        const std::span name_index {reinterpret_cast<const kstd::u32*>(data.data() + name_index_offset),
+                                    header.name_index_size};
+        if(std::any_of(entries.begin(), entries.end(),
+                       [&](const auto& entry) {
+                           return entry.name_offset < names_offset || entry.name_offset >= data.size();
+                       }) ||
+           std::any_of(name_index.begin(), name_index.end(),
+                       [&](auto index) { return index != empty_index && index >= header.entry_count; })) {
+            return false;
+        }
+
+        _mapping = std::move(mapping.get());
+        _entries = entries;
+        _name_index = name_index;
+        return true;
+    }
+
+    /**
+     * This function writes the entries, the name index and the names of this symbol table into the specified cache
+     * file. The names are copied out of the executable, so the cache file can be used without the executable.
+     *
+     * @param path The path of the cache file
+     * @return     Void or an error
+     * @author     Cedric Hammes
+     * @since      16/10/2026
+     */
+    auto SymbolTable::write_cache(const std::filesystem::path& path) const noexcept -> kstd::Result<void> {
+        const auto names_offset = sizeof(SymbolCacheHeader) + _entries.size_bytes() + _name_index.size_bytes();
+        std::vector<Entry> entries {_entries.begin(), _entries.end()};
+        std::vector<kstd::u8> names {};
+        for(auto& entry : entries) {
+            const auto name = get_name(entry);
+            if(names_offset + names.size() + name.size() >= std::numeric_limits<kstd::u32>::max()) {
+                return kstd::Error {fmt::format("Unable to write cache {}: Names are too large", path.string())};
+            }
+
+            entry.name_offset = static_cast<kstd::u32>(names_offset + names.size());
+            names.insert(names.end(), name.begin(), name.end());
+            names.push_back(0);
+        }
+        names.push_back(0);
+
+        const SymbolCacheHeader header {symbol_cache_magic,
+                                        cache_version,
+                                        static_cast<kstd::u32>(entries.size()),
+                                        static_cast<kstd::u32>(_name_index.size()),
+                                        static_cast<kstd::u32>(names.size()),
+                                        _mapping.get_data().size()};
+        const std::array<std::span<const kstd::u8>, 4> parts {
+                std::span {reinterpret_cast<const kstd::u8*>(&header), sizeof(header)},
+                std::span {reinterpret_cast<const kstd::u8*>(entries.data()), entries.size() * sizeof(Entry)},
+                std::span {reinterpret_cast<const kstd::u8*>(_name_index.data()), _name_index.size_bytes()},
+                std::span<const kstd::u8> {names}};
+        return write_cache_file(path, parts);
+    }
+
+    /**
+     * This function returns the name of the specified entry from the mapped string table.
+     *
+     * @param entry The entry of the symbol
+     * @return      The name of the symbol
+     * @author      Cedric Hammes
+     * @since       16/10/2026
+     */
+    auto SymbolTable::get_name(const Entry& entry) const noexcept -> std::string_view {
+        return {reinterpret_cast<const char*>(_mapping.get_data().data() + entry.name_offset)};
+    }
+
+    /**
+     * This function builds the open-addressing index over the names of all symbols. When multiple symbols have
+     * the same name, the symbol with the lowest address is found.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto SymbolTable::build_name_index() noexcept -> void {
+        const auto capacity = std::bit_ceil(std::max<std::size_t>(_entries.size() * 2, 16));
+        _name_index_storage.assign(capacity, empty_index);
+
+        const auto mask = capacity - 1;
+        for(std::size_t index = 0; index < _entries.size(); ++index) {
+            auto slot = get_name_slot(get_name(_entries[index]), capacity);
+            while(_name_index_storage[slot] != empty_index) {
+                slot = (slot + 1) & mask;
+            }
+            _name_index_storage[slot] = static_cast<kstd::u32>(index);
+        }
+        _name_index = _name_index_storage;
+    }
+
+    /**
+     * This function returns the symbol containing the specified address in the process.
+     *
+     * @param address The address in the process
+     * @return        The symbol or no value, when no symbol contains the address
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto SymbolTable::find_symbol(std::intptr_t address) const noexcept -> std::optional<Symbol> {
+        const auto file_address = address - _load_bias;
+        auto entry = std::upper_bound(_entries.begin(), _entries.end(), file_address,
+                                      [](auto value, const auto& element) { return value < element.address; });
+        if(entry == _entries.begin()) {
+            return {};
+        }
+
+        // Symbols without a size only contain their own address
+        --entry;
+        if(file_address - entry->address >= std::max<std::intptr_t>(entry->size, 1)) {
+            return {};
+        }
+        return Symbol {entry->address + _load_bias, entry->size, get_name(*entry), entry->is_function != 0};
+    }
+
+    /**
+     * This function returns the symbol at the specified index in the process, the symbols are sorted by address.
+     *
+     * @param index The index of the symbol
+     * @return      The symbol
+     * @author      Cedric Hammes
+     * @since       16/10/2026
+     */
+    auto SymbolTable::get_symbol(std::size_t index) const noexcept -> Symbol {
+        const auto& entry = _entries[index];
+        return Symbol {entry.address + _load_bias, entry.size, get_name(entry), entry.is_function != 0};
+    }
+
+    /**
+     * This function returns the address of the symbol with the specified name in the process.
+     *
+     * @param name The name of the symbol
+     * @return     The address or no value, when no symbol has the name
+     * @author     Cedric Hammes
+     * @since      16/10/2026
+     */
+    auto SymbolTable::find_address(std::string_view name) noexcept -> std::optional<std::intptr_t> {
+        if(_entries.empty()) {
+            return {};
+        }
+
+        if(_name_index.empty()) {
+            build_name_index();
+        }
+
+        const auto mask = _name_index.size() - 1;
+        for(auto slot = get_name_slot(name, _name_index.size());; slot = (slot + 1) & mask) {
+            const auto index = _name_index[slot];
+            if(index == empty_index) {
+                return {};
+            }
+
+            if(get_name(_entries[index]) == name) {
+                return _entries[index].address + _load_bias;
+            }
+        }
+    }
+}// namespace libdebug
+#endif
\ No newline at end of file
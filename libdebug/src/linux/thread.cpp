@@ -19,8 +19,619 @@
 
 #ifdef PLATFORM_LINUX
 #include "libdebug/thread.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <elf.h>
+#include <sys/uio.h>
+#include <sys/user.h>
 #include <thread>
+#include <tuple>
 
 namespace libdebug {
+#ifdef ARCH_X86_64
+    static constexpr std::size_t debug_status_register = 6;
+    static constexpr std::size_t debug_control_register = 7;
+
+    /**
+     * This function returns the offset of the specified debug register in the user area of a thread.
+     *
+     * @param index The index of the debug register
+     * @return      The offset in the user area
+     * @author      Cedric Hammes
+     * @since       16/10/2026
+     */
+    static constexpr auto get_debug_register_offset(std::size_t index) noexcept -> std::size_t {
+        return offsetof(user, u_debugreg) + index * sizeof(user::u_debugreg[0]);
+    }
+#endif
+
+    /**
+     * This function writes the debug control register of this thread, which enables all hardware breakpoints of
+     * this thread with their type and size.
+     *
+     * @return Void or an error
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto ThreadContext::write_debug_control() const noexcept -> kstd::Result<void> {
+#ifdef ARCH_X86_64
+        kstd::u64 debug_control = 0;
+        for(std::size_t slot = 0; slot < _hardware_breakpoints.size(); ++slot) {
+            const auto& breakpoint = _hardware_breakpoints[slot];
+            if(!breakpoint.has_value()) {
+                continue;
+            }
+
+            // The length is encoded as 1 = 0b00, 2 = 0b01, 8 = 0b10 and 4 = 0b11
+            const kstd::u64 length = breakpoint->size == 8 ? 0b10 : breakpoint->size - 1;
+            const auto condition = static_cast<kstd::u64>(breakpoint->type) | (length << 2);
+            debug_control |= (1ULL << (slot * 2)) | (condition << (16 + slot * 4));
+        }
+
+        if(::ptrace(PTRACE_POKEUSER, _thread_id, get_debug_register_offset(debug_control_register), debug_control) <
+           0) {
+            return kstd::Error {fmt::format("Unable to write debug control register of thread {}: {}", _thread_id,
+                                            platform::get_last_error())};
+        }
+        return {};
+#else
+        using namespace std::string_literals;
+        return kstd::Error {"Unable to write debug control register: Architecture is not supported"s};
+#endif
+    }
+
+    /**
+     * This function programs the specified hardware breakpoint into the debug registers of this thread. The
+     * previous breakpoint in the slot is replaced.
+     *
+     * @param slot       The index of the debug register
+     * @param breakpoint The hardware breakpoint
+     * @return           Void or an error
+     * @author           Cedric Hammes
+     * @since            16/10/2026
+     */
+    auto ThreadContext::set_hardware_breakpoint(std::size_t slot, const HardwareBreakpoint& breakpoint) noexcept
+            -> kstd::Result<void> {
+        using namespace std::string_literals;
+        if(slot >= _hardware_breakpoints.size()) {
+            return kstd::Error {fmt::format("Unable to set hardware breakpoint: Slot {} doesn't exist", slot)};
+        }
+
+        const auto size = breakpoint.size;
+        if(breakpoint.type == HardwareBreakpointType::EXECUTE ? size != 1
+                                                               : size != 1 && size != 2 && size != 4 && size != 8) {
+            return kstd::Error {fmt::format("Unable to set hardware breakpoint: Size {} is not supported", size)};
+        }
+
+        if(breakpoint.address % size != 0) {
+            return kstd::Error {"Unable to set hardware breakpoint: Address is not aligned to the size"s};
+        }
+
+#ifdef ARCH_X86_64
+        // Disable the slot before the address is replaced
+        if(_hardware_breakpoints[slot].has_value()) {
+            _hardware_breakpoints[slot].reset();
+            if(const auto result = write_debug_control(); result.is_error()) {
+                return kstd::Error {fmt::format("Unable to set hardware breakpoint: {}", result.get_error())};
+            }
+        }
+
+        if(::ptrace(PTRACE_POKEUSER, _thread_id, get_debug_register_offset(slot), breakpoint.address) < 0) {
+            return kstd::Error {fmt::format("Unable to set hardware breakpoint: {}", platform::get_last_error())};
+        }
+
+        _hardware_breakpoints[slot] = breakpoint;
+        if(const auto result = write_debug_control(); result.is_error()) {
+            _hardware_breakpoints[slot].reset();
+            return kstd::Error {fmt::format("Unable to set hardware breakpoint: {}", result.get_error())};
+        }
+        return {};
+#else
+        return kstd::Error {"Unable to set hardware breakpoint: Architecture is not supported"s};
+#endif
+    }
+
+    /**
+     * This function disables the hardware breakpoint in the specified slot of this thread.
+     *
+     * @param slot The index of the debug register
+     * @return     Void or an error
+     * @author     Cedric Hammes
+     * @since      16/10/2026
+     */
+    auto ThreadContext::clear_hardware_breakpoint(std::size_t slot) noexcept -> kstd::Result<void> {
+        if(slot >= _hardware_breakpoints.size()) {
+            return kstd::Error {fmt::format("Unable to clear hardware breakpoint: Slot {} doesn't exist", slot)};
+        }
+
+        if(!_hardware_breakpoints[slot].has_value()) {
+            return {};
+        }
+
+        const auto breakpoint = std::exchange(_hardware_breakpoints[slot], std::nullopt);
+        if(const auto result = write_debug_control(); result.is_error()) {
+            _hardware_breakpoints[slot] = breakpoint;
+            return kstd::Error {fmt::format("Unable to clear hardware breakpoint: {}", result.get_error())};
+        }
+        return {};
+    }
+
+    /**
+     * This function reads the debug status register of this thread and returns the slot of the hardware breakpoint,
+     * which stopped this thread. The register is kept, so the hit is still reported by the next wait.
+     *
+     * @return The slot, no value when no hardware breakpoint was hit or an error
+     * @author Cedric Hammes
+     * @since  17/10/2026
+     */
+    auto ThreadContext::get_hardware_breakpoint_hit() const noexcept -> kstd::Result<std::optional<std::size_t>> {
+#ifdef ARCH_X86_64
+        errno = 0;
+        const auto debug_status =
+                ::ptrace(PTRACE_PEEKUSER, _thread_id, get_debug_register_offset(debug_status_register), nullptr);
+        if(errno != 0) {
+            return kstd::Error {fmt::format("Unable to read debug status register of thread {}: {}", _thread_id,
+                                            platform::get_last_error())};
+        }
+
+        for(std::size_t slot = 0; slot < _hardware_breakpoints.size(); ++slot) {
+            if((debug_status & (1L << slot)) != 0 && _hardware_breakpoints[slot].has_value()) {
+                return {std::optional<std::size_t> {slot}};
+            }
+        }
+        return {std::optional<std::size_t> {}};
+#else
+        using namespace std::string_literals;
+        return kstd::Error {"Unable to read debug status register: Architecture is not supported"s};
+#endif
+    }
+
+    /**
+     * This function reads and resets the debug status register of this thread and returns the slot of the
+     * hardware breakpoint, which stopped this thread.
+     *
+     * @return The slot, no value when no hardware breakpoint was hit or an error
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto ThreadContext::take_hardware_breakpoint_hit() noexcept -> kstd::Result<std::optional<std::size_t>> {
+#ifdef ARCH_X86_64
+        const auto slot = get_hardware_breakpoint_hit();
+        if(slot.is_error()) {
+            return kstd::Error {slot.get_error()};
+        }
+
+        // The status register is sticky, so it's reset for the next hit
+        if(::ptrace(PTRACE_POKEUSER, _thread_id, get_debug_register_offset(debug_status_register), 0) < 0) {
+            return kstd::Error {fmt::format("Unable to reset debug status register of thread {}: {}", _thread_id,
+                                            platform::get_last_error())};
+        }
+        return {slot.get()};
+#else
+        using namespace std::string_literals;
+        return kstd::Error {"Unable to read debug status register: Architecture is not supported"s};
+#endif
+    }
+
+    /**
+     * This function reads the general-purpose registers of this thread into the register cache, when they weren't
+     * read since the last stop of the thread.
+     *
+     * @return The cached registers or an error
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto ThreadContext::fetch_registers() noexcept -> kstd::Result<arch::GeneralRegisters*> {
+        if(_registers.has_value()) {
+            return &*_registers;
+        }
+
+        arch::GeneralRegisters registers {};
+        iovec vector {&registers, sizeof(registers)};
+        if(::ptrace(PTRACE_GETREGSET, _thread_id, NT_PRSTATUS, &vector) < 0) {
+            return kstd::Error {fmt::format("Unable to read registers of thread {}: {}", _thread_id,
+                                            platform::get_last_error())};
+        }
+        _registers = registers;
+        return &*_registers;
+    }
+
+    /**
+     * This function writes the modified registers and the modified extended state back to this thread and
+     * invalidates the register cache. This is called before the thread is resumed.
+     *
+     * @return Void or an error
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto ThreadContext::flush_registers() noexcept -> kstd::Result<void> {
+        auto registers = std::exchange(_registers, std::nullopt);
+        const auto registers_dirty = std::exchange(_registers_dirty, false);
+        const auto extended_state_dirty = std::exchange(_extended_state_dirty, false);
+        _extended_state_complete = false;
+
+        kstd::Result<void> result {};
+        if(registers_dirty && registers.has_value()) {
+            iovec vector {&*registers, sizeof(*registers)};
+            if(::ptrace(PTRACE_SETREGSET, _thread_id, NT_PRSTATUS, &vector) < 0) {
+                result = kstd::Error {fmt::format("Unable to write registers of thread {}: {}", _thread_id,
+                                                  platform::get_last_error())};
+            }
+        }
+
+#ifdef ARCH_X86_64
+        if(extended_state_dirty) {
+            iovec vector {_extended_state.data(), _extended_state.size()};
+            if(::ptrace(PTRACE_SETREGSET, _thread_id, NT_X86_XSTATE, &vector) < 0) {
+                result = kstd::Error {fmt::format("Unable to write extended state of thread {}: {}", _thread_id,
+                                                  platform::get_last_error())};
+            }
+        }
+#endif
+
+        // The buffer is kept allocated for the next stop of the thread
+        _extended_state.clear();
+        return result;
+    }
+
+    /**
+     * This function reads the XSAVE area of this thread up to the specified size into the extended state cache,
+     * when this part wasn't read since the last stop of the thread. The legacy region and the header are always
+     * read.
+     *
+     * @param size The number of bytes required from the start of the XSAVE area
+     * @return     Void or an error
+     * @author     Cedric Hammes
+     * @since      16/10/2026
+     */
+    auto ThreadContext::fetch_extended_state(std::size_t size) noexcept -> kstd::Result<void> {
+#ifdef ARCH_X86_64
+        size = std::max(size, arch::extended_state_header_offset + arch::extended_state_header_size);
+        if(_extended_state_complete || _extended_state.size() >= size) {
+            return {};
+        }
+
+        // The kernel shortens the read to the size of the area, so a shorter read means the whole area was read. The
+        // area is never larger than the area with all components supported by the CPU.
+        _extended_state.resize(size);
+        iovec vector {_extended_state.data(), size};
+        if(::ptrace(PTRACE_GETREGSET, _thread_id, NT_X86_XSTATE, &vector) < 0) {
+            _extended_state.clear();
+            return kstd::Error {fmt::format("Unable to read extended state of thread {}: {}", _thread_id,
+                                            platform::get_last_error())};
+        }
+        _extended_state_complete = vector.iov_len < size || size >= arch::get_max_extended_state_size();
+        _extended_state.resize(vector.iov_len);
+        return {};
+#else
+        using namespace std::string_literals;
+        return kstd::Error {"Unable to read extended state: Architecture is not supported"s};
+#endif
+    }
+
+#ifdef ARCH_X86_64
+    /**
+     * This function reads the specified bytes of a state component from the extended state. Components in their
+     * initial state are zero and not read from the thread.
+     *
+     * @param component The state component
+     * @param offset    The offset of the bytes in the component
+     * @param data      The buffer for the bytes
+     * @return          Void or an error
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    auto ThreadContext::read_extended_state(arch::ExtendedStateComponent component, std::size_t offset,
+                                            std::span<kstd::u8> data) noexcept -> kstd::Result<void> {
+        const auto layout = arch::get_extended_state_layout(component);
+        if(layout.size == 0 || offset + data.size() > layout.size) {
+            return kstd::Error {fmt::format("Unable to read extended state: Component {} is not supported",
+                                            static_cast<int>(component))};
+        }
+
+        const auto components = get_extended_state_components();
+        if(components.is_error()) {
+            return kstd::Error {components.get_error()};
+        }
+
+        if(layout.offset >= arch::extended_state_header_offset &&
+           (components.get() & (1ULL << static_cast<kstd::u64>(component))) == 0) {
+            std::fill(data.begin(), data.end(), 0);
+            return {};
+        }
+
+        if(const auto result = fetch_extended_state(layout.offset + layout.size); result.is_error()) {
+            return kstd::Error {result.get_error()};
+        }
+
+        if(_extended_state.size() < layout.offset + offset + data.size()) {
+            return kstd::Error {fmt::format("Unable to read extended state: Component {} was not read",
+                                            static_cast<int>(component))};
+        }
+        std::copy_n(_extended_state.cbegin() + static_cast<std::ptrdiff_t>(layout.offset + offset), data.size(),
+                    data.begin());
+        return {};
+    }
+
+    /**
+     * This function writes the specified bytes of a state component into the extended state and marks the
+     * component as in use. The whole XSAVE area is read for this, because it can only be written back as a whole.
+     *
+     * @param component The state component
+     * @param offset    The offset of the bytes in the component
+     * @param data      The new bytes
+     * @return          Void or an error
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    auto ThreadContext::write_extended_state(arch::ExtendedStateComponent component, std::size_t offset,
+                                             std::span<const kstd::u8> data) noexcept -> kstd::Result<void> {
+        const auto layout = arch::get_extended_state_layout(component);
+        if(layout.size == 0 || offset + data.size() > layout.size) {
+            return kstd::Error {fmt::format("Unable to write extended state: Component {} is not supported",
+                                            static_cast<int>(component))};
+        }
+
+        if(const auto result = fetch_extended_state(arch::get_max_extended_state_size()); result.is_error()) {
+            return kstd::Error {result.get_error()};
+        }
+
+        if(!_extended_state_complete || _extended_state.size() < layout.offset + offset + data.size()) {
+            return kstd::Error {fmt::format("Unable to write extended state: Component {} was not read",
+                                            static_cast<int>(component))};
+        }
+        std::copy(data.begin(), data.end(),
+                  _extended_state.begin() + static_cast<std::ptrdiff_t>(layout.offset + offset));
+
+        kstd::u64 components = 0;
+        std::memcpy(&components, _extended_state.data() + arch::extended_state_header_offset, sizeof(components));
+        components |= 1ULL << static_cast<kstd::u64>(component);
+        std::memcpy(_extended_state.data() + arch::extended_state_header_offset, &components, sizeof(components));
+        _extended_state_dirty = true;
+        return {};
+    }
+#endif
+
+    /**
+     * This function returns the general-purpose registers of this thread. The registers are read once per stop
+     * of the thread, later calls return the cached snapshot until the thread is resumed.
+     *
+     * @return The registers or an error
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto ThreadContext::get_registers() noexcept -> kstd::Result<arch::GeneralRegisters> {
+        const auto registers = fetch_registers();
+        if(registers.is_error()) {
+            return kstd::Error {registers.get_error()};
+        }
+        return *registers.get();
+    }
+
+    /**
+     * This function replaces the general-purpose registers of this thread. The registers are only written into
+     * the cached snapshot, all changes are written back to the thread at once when it's resumed.
+     *
+     * @param registers The new registers
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    auto ThreadContext::set_registers(const arch::GeneralRegisters& registers) noexcept -> void {
+        _registers = registers;
+        _registers_dirty = true;
+    }
+
+    /**
+     * This function returns the instruction pointer of this thread from the cached register snapshot.
+     *
+     * @return The instruction pointer or an error
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto ThreadContext::get_instruction_pointer() noexcept -> kstd::Result<std::intptr_t> {
+        const auto registers = fetch_registers();
+        if(registers.is_error()) {
+            return kstd::Error {registers.get_error()};
+        }
+        return arch::get_instruction_pointer(*registers.get());
+    }
+
+    /**
+     * This function sets the instruction pointer of this thread in the cached register snapshot. The change is
+     * written back to the thread when it's resumed.
+     *
+     * @param address The new instruction pointer
+     * @return        Void or an error
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto ThreadContext::set_instruction_pointer(std::intptr_t address) noexcept -> kstd::Result<void> {
+        const auto registers = fetch_registers();
+        if(registers.is_error()) {
+            return kstd::Error {registers.get_error()};
+        }
+        arch::set_instruction_pointer(*registers.get(), address);
+        _registers_dirty = true;
+        return {};
+    }
+
+    /**
+     * This function returns the stack pointer of this thread from the cached register snapshot.
+     *
+     * @return The stack pointer or an error
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto ThreadContext::get_stack_pointer() noexcept -> kstd::Result<std::intptr_t> {
+        const auto registers = fetch_registers();
+        if(registers.is_error()) {
+            return kstd::Error {registers.get_error()};
+        }
+        return arch::get_stack_pointer(*registers.get());
+    }
+
+    /**
+     * This function returns the bitmap of the extended state components, which are not in their initial state.
+     * Only the legacy region and the header of the XSAVE area are read for this.
+     *
+     * @return The state-component bitmap or an error
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto ThreadContext::get_extended_state_components() noexcept -> kstd::Result<kstd::u64> {
+#ifdef ARCH_X86_64
+        if(const auto result = fetch_extended_state(0); result.is_error()) {
+            return kstd::Error {result.get_error()};
+        }
+
+        kstd::u64 components = 0;
+        std::memcpy(&components, _extended_state.data() + arch::extended_state_header_offset, sizeof(components));
+        return components;
+#else
+        using namespace std::string_literals;
+        return kstd::Error {"Unable to read extended state: Architecture is not supported"s};
+#endif
+    }
+
+    /**
+     * This function returns the specified 80-bit x87 register of this thread.
+     *
+     * @param index The index of the register in the register stack
+     * @return      The value of the register or an error
+     * @author      Cedric Hammes
+     * @since       16/10/2026
+     */
+    auto ThreadContext::get_x87_register(std::size_t index) noexcept -> kstd::Result<std::array<kstd::u8, 10>> {
+#ifdef ARCH_X86_64
+        if(index >= 8) {
+            return kstd::Error {fmt::format("Unable to read x87 register: Register {} doesn't exist", index)};
+        }
+
+        // The registers are stored in 16-byte slots after the control and status words
+        std::array<kstd::u8, 10> value {};
+        if(const auto result = read_extended_state(arch::ExtendedStateComponent::X87, 32 + index * 16, value);
+           result.is_error()) {
+            return kstd::Error {result.get_error()};
+        }
+        return value;
+#else
+        using namespace std::string_literals;
+        return kstd::Error {"Unable to read x87 register: Architecture is not supported"s};
+#endif
+    }
+
+    /**
+     * This function returns the specified vector register of this thread as a 512-bit value. The lower bytes
+     * are the XMM and YMM register, the state components of the wider parts are only read when they are in use.
+     *
+     * @param index The index of the register
+     * @return      The value of the register or an error
+     * @author      Cedric Hammes
+     * @since       16/10/2026
+     */
+    auto ThreadContext::get_vector_register(std::size_t index) noexcept -> kstd::Result<std::array<kstd::u8, 64>> {
+#ifdef ARCH_X86_64
+        using enum arch::ExtendedStateComponent;
+        if(index >= 32) {
+            return kstd::Error {fmt::format("Unable to read vector register: Register {} doesn't exist", index)};
+        }
+
+        // The upper 16 registers are stored as a whole, the lower ones are split over three components
+        std::array<kstd::u8, 64> value {};
+        if(index >= 16) {
+            if(const auto result = read_extended_state(HI16_ZMM, (index - 16) * 64, value); result.is_error()) {
+                return kstd::Error {result.get_error()};
+            }
+            return value;
+        }
+
+        const std::array<std::tuple<arch::ExtendedStateComponent, std::size_t, std::size_t>, 3> parts {
+                {{SSE, 0, 16}, {AVX, 16, 16}, {ZMM_HI256, 32, 32}}};
+        for(const auto& [component, value_offset, size] : parts) {
+            if(arch::get_extended_state_layout(component).size == 0) {
+                continue;
+            }
+
+            if(const auto result = read_extended_state(component, index * size, {value.data() + value_offset, size});
+               result.is_error()) {
+                return kstd::Error {result.get_error()};
+            }
+        }
+        return value;
+#else
+        using namespace std::string_literals;
+        return kstd::Error {"Unable to read vector register: Architecture is not supported"s};
+#endif
+    }
+
+    /**
+     * This function sets the lower bytes of the specified vector register of this thread. The change is written
+     * back to the thread when it's resumed.
+     *
+     * @param index The index of the register
+     * @param value The new value with up to 64 bytes
+     * @return      Void or an error
+     * @author      Cedric Hammes
+     * @since       16/10/2026
+     */
+    auto ThreadContext::set_vector_register(std::size_t index, std::span<const kstd::u8> value) noexcept
+            -> kstd::Result<void> {
+#ifdef ARCH_X86_64
+        using enum arch::ExtendedStateComponent;
+        if(index >= 32 || value.size() > 64) {
+            return kstd::Error {fmt::format("Unable to write vector register: Register {} with {} bytes doesn't exist",
+                                            index, value.size())};
+        }
+
+        if(index >= 16) {
+            return write_extended_state(HI16_ZMM, (index - 16) * 64, value);
+        }
+
+        const std::array<std::tuple<arch::ExtendedStateComponent, std::size_t, std::size_t>, 3> parts {
+                {{SSE, 0, 16}, {AVX, 16, 16}, {ZMM_HI256, 32, 32}}};
+        for(const auto& [component, value_offset, size] : parts) {
+            if(value_offset >= value.size()) {
+                break;
+            }
+
+            const auto part = value.subspan(value_offset, std::min(size, value.size() - value_offset));
+            if(const auto result = write_extended_state(component, index * size, part); result.is_error()) {
+                return kstd::Error {result.get_error()};
+            }
+        }
+        return {};
+#else
+        using namespace std::string_literals;
+        return kstd::Error {"Unable to write vector register: Architecture is not supported"s};
+#endif
+    }
+
+    /**
+     * This function returns the specified AVX-512 opmask register of this thread.
+     *
+     * @param index The index of the register
+     * @return      The value of the register or an error
+     * @author      Cedric Hammes
+     * @since       16/10/2026
+     */
+    auto ThreadContext::get_mask_register(std::size_t index) noexcept -> kstd::Result<kstd::u64> {
+#ifdef ARCH_X86_64
+        if(index >= 8) {
+            return kstd::Error {fmt::format("Unable to read mask register: Register {} doesn't exist", index)};
+        }
+
+        kstd::u64 value = 0;
+        const auto result = read_extended_state(arch::ExtendedStateComponent::OPMASK, index * sizeof(value),
+                                                {reinterpret_cast<kstd::u8*>(&value), sizeof(value)});
+        if(result.is_error()) {
+            return kstd::Error {result.get_error()};
+        }
+        return value;
+#else
+        using namespace std::string_literals;
+        return kstd::Error {"Unable to read mask register: Architecture is not supported"s};
+#endif
+    }
 }// namespace libdebug
 #endif
\ No newline at end of file
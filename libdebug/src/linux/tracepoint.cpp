@@ -0,0 +1,152 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#ifdef PLATFORM_LINUX
+#include "libdebug/process.hpp"
+#include "libdebug/tracepoint.hpp"
+#include <algorithm>
+#include <chrono>
+
+namespace libdebug {
+    /**
+     * This function returns the value of the specified trace register in the specified registers.
+     *
+     * @param registers      The general-purpose registers
+     * @param trace_register The register to read
+     * @return               The value of the register
+     * @author               Cedric Hammes
+     * @since                16/10/2026
+     */
+    static auto get_trace_register(const arch::GeneralRegisters& registers, TraceRegister trace_register) noexcept
+            -> kstd::u64 {
+        switch(trace_register) {
+            case TraceRegister::RETURN_VALUE: return arch::get_return_value(registers);
+            case TraceRegister::INSTRUCTION_POINTER:
+                return static_cast<kstd::u64>(arch::get_instruction_pointer(registers));
+            case TraceRegister::STACK_POINTER: return static_cast<kstd::u64>(arch::get_stack_pointer(registers));
+            case TraceRegister::FRAME_POINTER: return static_cast<kstd::u64>(arch::get_frame_pointer(registers));
+            default: return arch::get_argument(registers, static_cast<std::size_t>(trace_register));
+        }
+    }
+
+    /**
+     * This function adds tracepoints at all specified addresses. The breakpoints are added in one batch, a hit
+     * records the selected registers into the trace buffer and resumes the thread without reporting a signal or
+     * calling the event callbacks. The trace buffer is allocated with the default capacity, when it has no
+     * capacity yet. Tracepoints are removed with their breakpoints.
+     *
+     * Tracepoints without records only count their hits, so they never read registers or fill the trace buffer.
+     *
+     * @param addresses   The tracepoint addresses
+     * @param registers   The registers to record at each hit
+     * @param hit_budget  The count of hits after which the breakpoint is disabled, or zero for no limit
+     * @param is_recorded Whether a hit is recorded into the trace buffer
+     * @return            The result for each address, in the order of the specified addresses
+     * @author            Cedric Hammes
+     * @since             16/10/2026
+     */
+    auto ProcessContext::add_tracepoints(std::span<const std::intptr_t> addresses,
+                                         std::span<const TraceRegister> registers, kstd::u64 hit_budget,
+                                         bool is_recorded) noexcept -> std::vector<kstd::Result<void>> {
+        if(registers.size() > max_trace_registers) {
+            return std::vector<kstd::Result<void>>(
+                    addresses.size(), kstd::Error {fmt::format("Unable to add tracepoint: More than {} registers",
+                                                               max_trace_registers)});
+        }
+
+        if(is_recorded && _trace_buffer.get_capacity() == 0) {
+            _trace_buffer.set_capacity(TraceBuffer::default_capacity);
+        }
+
+        Tracepoint tracepoint {0, 0, hit_budget, {}, static_cast<kstd::u8>(registers.size()), is_recorded};
+        std::copy(registers.begin(), registers.end(), tracepoint.registers.begin());
+        auto results = add_breakpoints(addresses);
+        for(std::size_t index = 0; index < addresses.size(); ++index) {
+            if(results[index].is_ok()) {
+                tracepoint.address = addresses[index];
+                _tracepoints.insert_or_assign(addresses[index], tracepoint);
+            }
+        }
+        return results;
+    }
+
+    /**
+     * This function adds a tracepoint at the specified address.
+     *
+     * @param address     The tracepoint address
+     * @param registers   The registers to record at each hit
+     * @param hit_budget  The count of hits after which the breakpoint is disabled, or zero for no limit
+     * @param is_recorded Whether a hit is recorded into the trace buffer
+     * @return            Void or an error
+     * @author            Cedric Hammes
+     * @since             16/10/2026
+     */
+    auto ProcessContext::add_tracepoint(std::intptr_t address, std::span<const TraceRegister> registers,
+                                        kstd::u64 hit_budget, bool is_recorded) noexcept -> kstd::Result<void> {
+        return add_tracepoints({&address, 1}, registers, hit_budget, is_recorded).front();
+    }
+
+    /**
+     * This function records a hit of the specified tracepoint by the specified thread, which is stopped at the
+     * address of the tracepoint. Tracepoints without records only count the hit, the tracepoint callback is called
+     * for every hit. When the budget of the tracepoint is exhausted, its breakpoint is disabled and the thread
+     * continues without stepping over it.
+     *
+     * @param thread     The thread which hit the tracepoint
+     * @param tracepoint The tracepoint
+     * @return           Void or an error
+     * @author           Cedric Hammes
+     * @since            16/10/2026
+     */
+    auto ProcessContext::record_tracepoint_hit(ThreadContext& thread, Tracepoint& tracepoint) noexcept
+            -> kstd::Result<void> {
+        if(tracepoint.is_recorded) {
+            const auto registers = thread.get_registers();
+            if(registers.is_error()) {
+                return kstd::Error {fmt::format("Unable to record tracepoint at {:#x}: {}", tracepoint.address,
+                                                registers.get_error())};
+            }
+
+            using namespace std::chrono;
+            const auto timestamp = duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+            TraceRecord record {static_cast<kstd::u64>(timestamp), tracepoint.address, thread.get_thread_id(), {}};
+            for(std::size_t index = 0; index < tracepoint.register_count; ++index) {
+                record.registers[index] = get_trace_register(registers.get(), tracepoint.registers[index]);
+            }
+            _trace_buffer.push(record);
+        }
+        ++tracepoint.hit_count;
+
+        if(const auto& [callback, data] = _tracepoint_callback; callback) {
+            callback(tracepoint, data);
+        }
+
+        if(tracepoint.is_exhausted()) {
+            auto* breakpoint = _breakpoints.find(tracepoint.address);
+            if(const auto result = breakpoint->disable(*this); result.is_error()) {
+                return kstd::Error {fmt::format("Unable to record tracepoint at {:#x}: {}", tracepoint.address,
+                                                result.get_error())};
+            }
+            mark_stale_breakpoint(tracepoint.address);
+            thread._breakpoint_address.reset();
+        }
+        return {};
+    }
+}// namespace libdebug
+#endif
\ No newline at end of file
@@ -0,0 +1,844 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#ifdef PLATFORM_LINUX
+#include "libdebug/unwind.hpp"
+#include "libdebug/dwarf_reader.hpp"
+#include "libdebug/process.hpp"
+#include <algorithm>
+#include <cstring>
+#include <elf.h>
+#include <stdexcept>
+
+namespace libdebug {
+    static constexpr kstd::u8 pointer_omit = 0xFF;
+    static constexpr kstd::u8 pointer_format_mask = 0x0F;
+    static constexpr kstd::u8 pointer_absolute = 0x00;
+    static constexpr kstd::u8 pointer_uleb128 = 0x01;
+    static constexpr kstd::u8 pointer_udata2 = 0x02;
+    static constexpr kstd::u8 pointer_udata4 = 0x03;
+    static constexpr kstd::u8 pointer_udata8 = 0x04;
+    static constexpr kstd::u8 pointer_sleb128 = 0x09;
+    static constexpr kstd::u8 pointer_sdata2 = 0x0A;
+    static constexpr kstd::u8 pointer_sdata4 = 0x0B;
+    static constexpr kstd::u8 pointer_sdata8 = 0x0C;
+    static constexpr kstd::u8 pointer_application_mask = 0x70;
+    static constexpr kstd::u8 pointer_pc_relative = 0x10;
+    static constexpr kstd::u8 pointer_data_relative = 0x30;
+    static constexpr kstd::u8 table_encoding_sdata4_data_relative = pointer_data_relative | pointer_sdata4;
+
+    static constexpr kstd::u8 cfa_advance_loc = 0x40;
+    static constexpr kstd::u8 cfa_offset = 0x80;
+    static constexpr kstd::u8 cfa_restore = 0xC0;
+    static constexpr kstd::u8 cfa_nop = 0x00;
+    static constexpr kstd::u8 cfa_set_loc = 0x01;
+    static constexpr kstd::u8 cfa_advance_loc1 = 0x02;
+    static constexpr kstd::u8 cfa_advance_loc2 = 0x03;
+    static constexpr kstd::u8 cfa_advance_loc4 = 0x04;
+    static constexpr kstd::u8 cfa_offset_extended = 0x05;
+    static constexpr kstd::u8 cfa_restore_extended = 0x06;
+    static constexpr kstd::u8 cfa_undefined = 0x07;
+    static constexpr kstd::u8 cfa_same_value = 0x08;
+    static constexpr kstd::u8 cfa_register = 0x09;
+    static constexpr kstd::u8 cfa_remember_state = 0x0A;
+    static constexpr kstd::u8 cfa_restore_state = 0x0B;
+    static constexpr kstd::u8 cfa_def_cfa = 0x0C;
+    static constexpr kstd::u8 cfa_def_cfa_register = 0x0D;
+    static constexpr kstd::u8 cfa_def_cfa_offset = 0x0E;
+    static constexpr kstd::u8 cfa_def_cfa_expression = 0x0F;
+    static constexpr kstd::u8 cfa_expression = 0x10;
+    static constexpr kstd::u8 cfa_offset_extended_sf = 0x11;
+    static constexpr kstd::u8 cfa_def_cfa_sf = 0x12;
+    static constexpr kstd::u8 cfa_def_cfa_offset_sf = 0x13;
+    static constexpr kstd::u8 cfa_val_offset = 0x14;
+    static constexpr kstd::u8 cfa_val_offset_sf = 0x15;
+    static constexpr kstd::u8 cfa_val_expression = 0x16;
+    static constexpr kstd::u8 cfa_gnu_args_size = 0x2E;
+    static constexpr kstd::u8 cfa_gnu_negative_offset_extended = 0x2F;
+
+    static constexpr kstd::u64 segment_page_mask = ~kstd::u64 {0xFFF};
+
+    /**
+     * This structure is the common information entry, which is shared by multiple FDEs. The initial instructions of
+     * the CIE describe the first row of every FDE referencing it.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    struct CommonInformationEntry final {
+        kstd::u64 code_alignment;
+        kstd::i64 data_alignment;
+        kstd::u64 return_register;
+        kstd::u8 fde_encoding;
+        bool has_augmentation_data;
+        std::size_t instructions_begin;
+        std::size_t instructions_end;
+    };
+
+    /**
+     * This function reads a pointer with the specified encoding of the .eh_frame and .eh_frame_hdr sections.
+     * Indirect pointers are returned without being dereferenced, because they are only used for the personality
+     * routine.
+     *
+     * @param reader          The reader of the section
+     * @param encoding        The encoding of the pointer
+     * @param section_address The address of the section
+     * @return                The pointer
+     * @author                Cedric Hammes
+     * @since                 16/10/2026
+     */
+    static auto read_encoded_pointer(DwarfReader& reader, kstd::u8 encoding, kstd::u64 section_address) noexcept
+            -> kstd::u64 {
+        if(encoding == pointer_omit) {
+            return 0;
+        }
+
+        const auto field_address = section_address + reader.get_offset();
+        kstd::u64 value = 0;
+        switch(encoding & pointer_format_mask) {
+            case pointer_absolute: value = reader.read<kstd::u64>(); break;
+            case pointer_uleb128: value = reader.read_uleb128(); break;
+            case pointer_udata2: value = reader.read<kstd::u16>(); break;
+            case pointer_udata4: value = reader.read<kstd::u32>(); break;
+            case pointer_udata8: value = reader.read<kstd::u64>(); break;
+            case pointer_sleb128: value = static_cast<kstd::u64>(reader.read_sleb128()); break;
+            case pointer_sdata2: value = static_cast<kstd::u64>(kstd::i64 {reader.read<kstd::i16>()}); break;
+            case pointer_sdata4: value = static_cast<kstd::u64>(kstd::i64 {reader.read<kstd::i32>()}); break;
+            case pointer_sdata8: value = reader.read<kstd::u64>(); break;
+            default: reader.fail(); return 0;
+        }
+
+        switch(encoding & pointer_application_mask) {
+            case 0: return value;
+            case pointer_pc_relative: return value + field_address;
+            case pointer_data_relative: return value + section_address;
+            default: reader.fail(); return 0;
+        }
+    }
+
+    /**
+     * This function reads the common information entry at the specified offset in the .eh_frame section.
+     *
+     * @param eh_frame The data of the .eh_frame section
+     * @param offset   The offset of the CIE
+     * @return         The CIE or an error
+     * @author         Cedric Hammes
+     * @since          16/10/2026
+     */
+    static auto read_common_information_entry(std::span<const kstd::u8> eh_frame, kstd::u64 offset) noexcept
+            -> kstd::Result<CommonInformationEntry> {
+        DwarfReader reader {eh_frame, static_cast<std::size_t>(offset)};
+        bool is_64_bit = false;
+        const auto length = reader.read_unit_length(is_64_bit);
+        const auto end = reader.get_offset() + length;
+        if(reader.read<kstd::u32>() != 0 || reader.is_failed() || end > eh_frame.size()) {
+            return kstd::Error {fmt::format("Unable to read CIE at {:#x}: Invalid header", offset)};
+        }
+
+        const auto version = reader.read<kstd::u8>();
+        const auto augmentation = reader.read_string();
+        if(version != 1 && version != 3) {
+            return kstd::Error {fmt::format("Unable to read CIE at {:#x}: Unsupported version {}", offset, version)};
+        }
+
+        // The legacy "eh" augmentation is followed by the address of the exception table
+        if(augmentation.find("eh") != std::string_view::npos) {
+            reader.skip(sizeof(kstd::u64));
+        }
+
+        CommonInformationEntry entry {};
+        entry.code_alignment = reader.read_uleb128();
+        entry.data_alignment = reader.read_sleb128();
+        entry.return_register = version == 1 ? reader.read<kstd::u8>() : reader.read_uleb128();
+        entry.fde_encoding = pointer_absolute;
+        entry.has_augmentation_data = augmentation.starts_with('z');
+        if(entry.has_augmentation_data) {
+            const auto augmentation_size = reader.read_uleb128();
+            const auto augmentation_end = reader.get_offset() + augmentation_size;
+            for(const auto character : augmentation.substr(1)) {
+                switch(character) {
+                    case 'L': static_cast<void>(reader.read<kstd::u8>()); break;
+                    case 'P': {
+                        const auto personality_encoding = reader.read<kstd::u8>();
+                        static_cast<void>(read_encoded_pointer(reader, personality_encoding, 0));
+                        break;
+                    }
+                    case 'R': entry.fde_encoding = reader.read<kstd::u8>(); break;
+                    default: break;
+                }
+            }
+            reader.set_offset(augmentation_end);
+        }
+
+        if(reader.is_failed() || reader.get_offset() > end) {
+            return kstd::Error {fmt::format("Unable to read CIE at {:#x}: Invalid augmentation", offset)};
+        }
+        entry.instructions_begin = reader.get_offset();
+        entry.instructions_end = end;
+        return entry;
+    }
+
+    /**
+     * This function executes the specified call frame instructions and appends a row for every advance of the
+     * location. The current row is updated in place, so the initial instructions of the CIE can be executed with the
+     * same function.
+     *
+     * @param reader          The reader positioned at the instructions
+     * @param end             The offset behind the instructions
+     * @param entry           The CIE of the instructions
+     * @param initial_row     The row after the initial instructions of the CIE
+     * @param section_address The address of the .eh_frame section
+     * @param row             The current row
+     * @param rows            The completed rows or nullptr for the initial instructions
+     * @return                Whether the instructions are valid
+     * @author                Cedric Hammes
+     * @since                 16/10/2026
+     */
+    static auto execute_instructions(DwarfReader& reader, std::size_t end, const CommonInformationEntry& entry,
+                                     const CallFrameRow& initial_row, kstd::u64 section_address, CallFrameRow& row,
+                                     std::vector<CallFrameRow>* rows) noexcept -> bool {
+        std::vector<CallFrameRow> remembered_rows {};
+        const auto set_rule = [&](kstd::u64 register_number, CallFrameRuleType type, kstd::i64 value) {
+            if(register_number < call_frame_register_count) {
+                row.rules[register_number] = {type, value};
+            }
+        };
+        const auto advance = [&](kstd::u64 address) {
+            if(rows != nullptr && address > row.address) {
+                rows->push_back(row);
+                row.address = address;
+            }
+        };
+
+        while(reader.get_offset() < end && !reader.is_failed()) {
+            const auto instruction = reader.read<kstd::u8>();
+            const auto operand = static_cast<kstd::u64>(instruction & 0x3F);
+            switch(instruction & 0xC0) {
+                case cfa_advance_loc: advance(row.address + operand * entry.code_alignment); continue;
+                case cfa_offset: {
+                    const auto offset = static_cast<kstd::i64>(reader.read_uleb128()) * entry.data_alignment;
+                    set_rule(operand, CallFrameRuleType::OFFSET, offset);
+                    continue;
+                }
+                case cfa_restore: {
+                    if(operand < call_frame_register_count) {
+                        row.rules[operand] = initial_row.rules[operand];
+                    }
+                    continue;
+                }
+                default: break;
+            }
+
+            switch(instruction) {
+                case cfa_nop: break;
+                case cfa_set_loc: advance(read_encoded_pointer(reader, entry.fde_encoding, section_address)); break;
+                case cfa_advance_loc1: advance(row.address + reader.read<kstd::u8>() * entry.code_alignment); break;
+                case cfa_advance_loc2: advance(row.address + reader.read<kstd::u16>() * entry.code_alignment); break;
+                case cfa_advance_loc4: advance(row.address + reader.read<kstd::u32>() * entry.code_alignment); break;
+                case cfa_offset_extended: {
+                    const auto register_number = reader.read_uleb128();
+                    const auto offset = static_cast<kstd::i64>(reader.read_uleb128()) * entry.data_alignment;
+                    set_rule(register_number, CallFrameRuleType::OFFSET, offset);
+                    break;
+                }
+                case cfa_restore_extended: {
+                    const auto register_number = reader.read_uleb128();
+                    if(register_number < call_frame_register_count) {
+                        row.rules[register_number] = initial_row.rules[register_number];
+                    }
+                    break;
+                }
+                case cfa_undefined: set_rule(reader.read_uleb128(), CallFrameRuleType::UNDEFINED, 0); break;
+                case cfa_same_value: set_rule(reader.read_uleb128(), CallFrameRuleType::SAME_VALUE, 0); break;
+                case cfa_register: {
+                    const auto register_number = reader.read_uleb128();
+                    const auto source_register = static_cast<kstd::i64>(reader.read_uleb128());
+                    set_rule(register_number, CallFrameRuleType::REGISTER, source_register);
+                    break;
+                }
+                case cfa_remember_state: remembered_rows.push_back(row); break;
+                case cfa_restore_state: {
+                    if(remembered_rows.empty()) {
+                        return false;
+                    }
+
+                    // The location isn't part of the remembered state
+                    const auto address = row.address;
+                    row = remembered_rows.back();
+                    row.address = address;
+                    remembered_rows.pop_back();
+                    break;
+                }
+                case cfa_def_cfa: {
+                    row.cfa_register = reader.read_uleb128();
+                    row.cfa_offset = static_cast<kstd::i64>(reader.read_uleb128());
+                    row.is_cfa_supported = true;
+                    break;
+                }
+                case cfa_def_cfa_register: {
+                    row.cfa_register = reader.read_uleb128();
+                    row.is_cfa_supported = true;
+                    break;
+                }
+                case cfa_def_cfa_offset: row.cfa_offset = static_cast<kstd::i64>(reader.read_uleb128()); break;
+                case cfa_def_cfa_expression: {
+                    reader.skip(reader.read_uleb128());
+                    row.is_cfa_supported = false;
+                    break;
+                }
+                case cfa_expression:
+                case cfa_val_expression: {
+                    const auto register_number = reader.read_uleb128();
+                    reader.skip(reader.read_uleb128());
+                    set_rule(register_number, CallFrameRuleType::UNSUPPORTED, 0);
+                    break;
+                }
+                case cfa_offset_extended_sf: {
+                    const auto register_number = reader.read_uleb128();
+                    const auto offset = reader.read_sleb128() * entry.data_alignment;
+                    set_rule(register_number, CallFrameRuleType::OFFSET, offset);
+                    break;
+                }
+                case cfa_def_cfa_sf: {
+                    row.cfa_register = reader.read_uleb128();
+                    row.cfa_offset = reader.read_sleb128() * entry.data_alignment;
+                    row.is_cfa_supported = true;
+                    break;
+                }
+                case cfa_def_cfa_offset_sf: row.cfa_offset = reader.read_sleb128() * entry.data_alignment; break;
+                case cfa_val_offset: {
+                    const auto register_number = reader.read_uleb128();
+                    const auto offset = static_cast<kstd::i64>(reader.read_uleb128()) * entry.data_alignment;
+                    set_rule(register_number, CallFrameRuleType::VALUE_OFFSET, offset);
+                    break;
+                }
+                case cfa_val_offset_sf: {
+                    const auto register_number = reader.read_uleb128();
+                    const auto offset = reader.read_sleb128() * entry.data_alignment;
+                    set_rule(register_number, CallFrameRuleType::VALUE_OFFSET, offset);
+                    break;
+                }
+                case cfa_gnu_args_size: static_cast<void>(reader.read_uleb128()); break;
+                case cfa_gnu_negative_offset_extended: {
+                    const auto register_number = reader.read_uleb128();
+                    const auto offset = -static_cast<kstd::i64>(reader.read_uleb128()) * entry.data_alignment;
+                    set_rule(register_number, CallFrameRuleType::OFFSET, offset);
+                    break;
+                }
+                default: return false;
+            }
+        }
+        return !reader.is_failed();
+    }
+
+    /**
+     * This constructor maps the specified ELF file and reads the index over the FDEs. No call frame instructions
+     * are decoded before the first lookup.
+     *
+     * @param path The path to the ELF file
+     * @author     Cedric Hammes
+     * @since      16/10/2026
+     */
+    CallFrameTable::CallFrameTable(const std::filesystem::path& path) ://NOLINT
+            _mapping {},
+            _eh_frame {},
+            _eh_frame_hdr {},
+            _segments {},
+            _index {},
+            _decoded_fdes {} {
+        auto mapping = platform::map_file(path);
+        if(mapping.is_error()) {
+            throw std::runtime_error {fmt::format("Unable to load call frame table: {}", mapping.get_error())};
+        }
+        _mapping = std::move(mapping.get());
+
+        const auto data = _mapping.get_data();
+        Elf64_Ehdr header {};
+        if(data.size() >= sizeof(header)) {
+            std::memcpy(&header, data.data(), sizeof(header));
+        }
+        if(data.size() < sizeof(header) || std::memcmp(header.e_ident, ELFMAG, SELFMAG) != 0 ||
+           header.e_ident[EI_CLASS] != ELFCLASS64 || header.e_shentsize != sizeof(Elf64_Shdr) ||
+           header.e_phentsize != sizeof(Elf64_Phdr) || header.e_shoff > data.size() ||
+           (data.size() - header.e_shoff) / sizeof(Elf64_Shdr) < header.e_shnum || header.e_phoff > data.size() ||
+           (data.size() - header.e_phoff) / sizeof(Elf64_Phdr) < header.e_phnum ||
+           header.e_shstrndx >= header.e_shnum) {
+            throw std::runtime_error {
+                    fmt::format("Unable to load call frame table: {} is no valid ELF file", path.string())};
+        }
+
+        // The load bias of a mapping is calculated with the loadable segments
+        for(std::size_t index = 0; index < header.e_phnum; ++index) {
+            Elf64_Phdr segment {};
+            std::memcpy(&segment, data.data() + header.e_phoff + index * sizeof(segment), sizeof(segment));
+            if(segment.p_type == PT_LOAD) {
+                _segments.push_back({segment.p_offset, segment.p_filesz, segment.p_vaddr});
+            }
+        }
+
+        const auto read_section = [&](std::size_t index) {
+            Elf64_Shdr section {};
+            std::memcpy(&section, data.data() + header.e_shoff + index * sizeof(section), sizeof(section));
+            return section;
+        };
+
+        const auto names = read_section(header.e_shstrndx);
+        for(std::size_t index = 0; index < header.e_shnum; ++index) {
+            const auto section = read_section(index);
+            if(section.sh_type == SHT_NOBITS || section.sh_offset > data.size() ||
+               data.size() - section.sh_offset < section.sh_size || section.sh_name >= names.sh_size ||
+               names.sh_offset + names.sh_size > data.size()) {
+                continue;
+            }
+
+            const auto* name_begin = reinterpret_cast<const char*>(data.data() + names.sh_offset + section.sh_name);
+            const std::string_view name {name_begin, ::strnlen(name_begin, names.sh_size - section.sh_name)};
+            const Section location {static_cast<std::size_t>(section.sh_offset),
+                                    static_cast<std::size_t>(section.sh_size), section.sh_addr};
+            if(name == ".eh_frame") {
+                _eh_frame = location;
+            }
+            else if(name == ".eh_frame_hdr") {
+                _eh_frame_hdr = location;
+            }
+        }
+
+        if(!read_table_index()) {
+            build_index();
+        }
+    }
+
+    /**
+     * This function returns the data of the specified section in the mapped file.
+     *
+     * @param section The location of the section
+     * @return        The data of the section
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto CallFrameTable::get_section_data(const Section& section) const noexcept -> std::span<const kstd::u8> {
+        return _mapping.get_data().subspan(section.offset, section.size);
+    }
+
+    /**
+     * This function reads the index over the FDEs from the binary search table in the .eh_frame_hdr section. The
+     * table is only used when it is encoded with signed 4-byte offsets, which is the encoding emitted by the linkers.
+     *
+     * @return Whether the index was read
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto CallFrameTable::read_table_index() noexcept -> bool {
+        const auto eh_frame_hdr = get_section_data(_eh_frame_hdr);
+        DwarfReader reader {eh_frame_hdr, 0};
+        const auto version = reader.read<kstd::u8>();
+        const auto eh_frame_pointer_encoding = reader.read<kstd::u8>();
+        const auto fde_count_encoding = reader.read<kstd::u8>();
+        const auto table_encoding = reader.read<kstd::u8>();
+        static_cast<void>(read_encoded_pointer(reader, eh_frame_pointer_encoding, _eh_frame_hdr.address));
+        const auto fde_count = read_encoded_pointer(reader, fde_count_encoding, _eh_frame_hdr.address);
+        if(reader.is_failed() || version != 1 || table_encoding != table_encoding_sdata4_data_relative ||
+           (eh_frame_hdr.size() - reader.get_offset()) / (2 * sizeof(kstd::i32)) < fde_count) {
+            return false;
+        }
+
+        _index.reserve(fde_count);
+        for(kstd::u64 index = 0; index < fde_count; ++index) {
+            const auto address = read_encoded_pointer(reader, table_encoding, _eh_frame_hdr.address);
+            const auto fde_address = read_encoded_pointer(reader, table_encoding, _eh_frame_hdr.address);
+            if(fde_address < _eh_frame.address || fde_address - _eh_frame.address >= _eh_frame.size) {
+                _index.clear();
+                return false;
+            }
+            _index.push_back({address, fde_address - _eh_frame.address});
+        }
+        return std::is_sorted(_index.cbegin(), _index.cend(),
+                              [](const auto& left, const auto& right) { return left.address < right.address; });
+    }
+
+    /**
+     * This function builds the index over the FDEs by reading all entries of the .eh_frame section. This is only
+     * required for files without a binary search table.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto CallFrameTable::build_index() noexcept -> void {
+        _index.clear();
+        const auto eh_frame = get_section_data(_eh_frame);
+        std::unordered_map<kstd::u64, kstd::u8> fde_encodings {};
+        DwarfReader reader {eh_frame, 0};
+        while(reader.get_offset() < eh_frame.size()) {
+            const auto offset = reader.get_offset();
+            bool is_64_bit = false;
+            const auto length = reader.read_unit_length(is_64_bit);
+            const auto end = reader.get_offset() + length;
+            if(length == 0 || reader.is_failed() || end > eh_frame.size()) {
+                break;
+            }
+
+            const auto id_offset = reader.get_offset();
+            const auto cie_pointer = reader.read<kstd::u32>();
+            if(cie_pointer != 0 && cie_pointer <= id_offset) {
+                const auto cie_offset = id_offset - cie_pointer;
+                auto encoding = fde_encodings.find(cie_offset);
+                if(encoding == fde_encodings.end()) {
+                    const auto entry = read_common_information_entry(eh_frame, cie_offset);
+                    const auto fde_encoding = entry.is_ok() ? entry.get().fde_encoding : pointer_omit;
+                    encoding = fde_encodings.emplace(cie_offset, fde_encoding).first;
+                }
+
+                if(encoding->second != pointer_omit) {
+                    const auto address = read_encoded_pointer(reader, encoding->second, _eh_frame.address);
+                    if(!reader.is_failed() && address != 0) {
+                        _index.push_back({address, offset});
+                    }
+                }
+            }
+            reader.set_offset(end);
+        }
+
+        std::sort(_index.begin(), _index.end(),
+                  [](const auto& left, const auto& right) { return left.address < right.address; });
+    }
+
+    /**
+     * This function decodes the rows of the FDE at the specified offset in the .eh_frame section. The rows are
+     * cached, so the instructions of every FDE are only executed once.
+     *
+     * @param fde_offset The offset of the FDE
+     * @return           The decoded FDE or an error
+     * @author           Cedric Hammes
+     * @since            16/10/2026
+     */
+    auto CallFrameTable::decode_fde(kstd::u64 fde_offset) noexcept -> kstd::Result<const DecodedFde*> {
+        if(const auto decoded_fde = _decoded_fdes.find(fde_offset); decoded_fde != _decoded_fdes.end()) {
+            return &decoded_fde->second;
+        }
+
+        const auto eh_frame = get_section_data(_eh_frame);
+        DwarfReader reader {eh_frame, static_cast<std::size_t>(fde_offset)};
+        bool is_64_bit = false;
+        const auto length = reader.read_unit_length(is_64_bit);
+        const auto end = reader.get_offset() + length;
+        const auto id_offset = reader.get_offset();
+        const auto cie_pointer = reader.read<kstd::u32>();
+        if(reader.is_failed() || end > eh_frame.size() || cie_pointer == 0 || cie_pointer > id_offset) {
+            return kstd::Error {fmt::format("Unable to decode FDE at {:#x}: Invalid header", fde_offset)};
+        }
+
+        const auto entry = read_common_information_entry(eh_frame, id_offset - cie_pointer);
+        if(entry.is_error()) {
+            return kstd::Error {fmt::format("Unable to decode FDE at {:#x}: {}", fde_offset, entry.get_error())};
+        }
+
+        // The size of the range has the format of the begin address, but is never relative
+        const auto& cie = entry.get();
+        const auto begin = read_encoded_pointer(reader, cie.fde_encoding, _eh_frame.address);
+        const auto size = read_encoded_pointer(reader, cie.fde_encoding & pointer_format_mask, _eh_frame.address);
+        if(cie.has_augmentation_data) {
+            reader.skip(reader.read_uleb128());
+        }
+
+        // The initial instructions of the CIE describe the registers at the first instruction of the function
+        CallFrameRow initial_row {};
+        initial_row.is_cfa_supported = true;
+        initial_row.address = begin;
+        for(auto& rule : initial_row.rules) {
+            rule = {CallFrameRuleType::SAME_VALUE, 0};
+        }
+
+        DwarfReader cie_reader {eh_frame, cie.instructions_begin};
+        if(!execute_instructions(cie_reader, cie.instructions_end, cie, initial_row, _eh_frame.address, initial_row,
+                                 nullptr)) {
+            return kstd::Error {fmt::format("Unable to decode FDE at {:#x}: Invalid CIE instructions", fde_offset)};
+        }
+
+        DecodedFde decoded_fde {begin, begin + size, {}};
+        auto row = initial_row;
+        if(reader.is_failed() || !execute_instructions(reader, end, cie, initial_row, _eh_frame.address, row,
+                                                       &decoded_fde.rows)) {
+            return kstd::Error {fmt::format("Unable to decode FDE at {:#x}: Invalid instructions", fde_offset)};
+        }
+        decoded_fde.rows.push_back(row);
+        return &_decoded_fdes.emplace(fde_offset, std::move(decoded_fde)).first->second;
+    }
+
+    /**
+     * This function returns the row of the call frame information, which describes the frame of the
+     * instruction at the specified address in the file.
+     *
+     * @param address The address in the file
+     * @return        The row, nullptr when the address has no call frame information or an error
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto CallFrameTable::find_row(kstd::u64 address) noexcept -> kstd::Result<const CallFrameRow*> {
+        const auto entry = std::upper_bound(_index.cbegin(), _index.cend(), address,
+                                            [](const auto value, const auto& entry) { return value < entry.address; });
+        if(entry == _index.cbegin()) {
+            return static_cast<const CallFrameRow*>(nullptr);
+        }
+
+        const auto decoded_fde = decode_fde(std::prev(entry)->fde_offset);
+        if(decoded_fde.is_error()) {
+            return kstd::Error {decoded_fde.get_error()};
+        }
+
+        const auto& fde = *decoded_fde.get();
+        if(address < fde.begin || address >= fde.end) {
+            return static_cast<const CallFrameRow*>(nullptr);
+        }
+
+        const auto row = std::upper_bound(fde.rows.cbegin(), fde.rows.cend(), address,
+                                          [](const auto value, const auto& row) { return value < row.address; });
+        return &*std::prev(row);
+    }
+
+    /**
+     * This function returns the difference between the addresses in the process and the addresses in the file
+     * for the mapping of the file at the specified address and file offset.
+     *
+     * @param begin  The address of the mapping in the process
+     * @param offset The offset of the mapping in the file
+     * @return       The load bias or no value, when no segment of the file is at the offset
+     * @author       Cedric Hammes
+     * @since        16/10/2026
+     */
+    auto CallFrameTable::get_load_bias(std::intptr_t begin, kstd::u64 offset) const noexcept
+            -> std::optional<std::intptr_t> {
+        for(const auto& segment : _segments) {
+            if(offset >= (segment.offset & segment_page_mask) && offset < segment.offset + segment.size) {
+                return begin - static_cast<std::intptr_t>(offset + segment.address - segment.offset);
+            }
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * This function returns the unwind module of the executable mapping at the specified address. The modules are
+     * cached until the memory map is invalidated, the call frame tables of the mapped files are cached until the
+     * process executes another image.
+     *
+     * @param address The address in the process
+     * @return        The module, nullptr when the address is not mapped or an error
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto ProcessContext::find_unwind_module(std::intptr_t address) noexcept -> kstd::Result<const UnwindModule*> {
+        // Mappings could have been replaced since the memory map was invalidated, so no cached module is trusted
+        if(_memory_map.is_stale()) {
+            _unwind_modules.clear();
+        }
+
+        const auto module = std::upper_bound(_unwind_modules.cbegin(), _unwind_modules.cend(), address,
+                                             [](const auto value, const auto& module) { return value < module.begin; });
+        if(module != _unwind_modules.cbegin() && address < std::prev(module)->end) {
+            return &*std::prev(module);
+        }
+
+        const auto memory_map = get_memory_map();
+        if(memory_map.is_error()) {
+            return kstd::Error {memory_map.get_error()};
+        }
+
+        const auto region = memory_map.get()->find_region(address);
+        if(!region.has_value() || !region->has_permission(MemoryPermission::EXECUTE)) {
+            return static_cast<const UnwindModule*>(nullptr);
+        }
+
+        // Mappings without a file (like the vDSO) and files without call frame information have no table
+        UnwindModule new_module {region->begin, region->end, 0, nullptr};
+        if(region->path.starts_with('/')) {
+            const std::string path {region->path};
+            auto table = _call_frame_tables.find(path);
+            if(table == _call_frame_tables.end()) {
+                std::unique_ptr<CallFrameTable> new_table {};
+                try {
+                    new_table = std::make_unique<CallFrameTable>(path);
+                }
+                catch(const std::exception&) {
+                }
+                table = _call_frame_tables.emplace(path, std::move(new_table)).first;
+            }
+
+            if(table->second != nullptr) {
+                if(const auto load_bias = table->second->get_load_bias(region->begin, region->offset)) {
+                    new_module.load_bias = *load_bias;
+                    new_module.table = table->second.get();
+                }
+            }
+        }
+
+        const auto position = std::upper_bound(
+                _unwind_modules.begin(), _unwind_modules.end(), new_module.begin,
+                [](const auto value, const auto& module) { return value < module.begin; });
+        return &*_unwind_modules.insert(position, new_module);
+    }
+
+    /**
+     * This function returns the return addresses on the stack of the specified stopped thread. The frames are
+     * unwound with the call frame information of the mapped files and with the frame pointer, when no call frame
+     * information is available. The top of the stack is read at once, so most frames don't require a memory read.
+     *
+     * @param thread_id The id of the thread
+     * @param max_depth The maximal count of frames
+     * @return          The instruction pointer followed by the return addresses or an error
+     * @author          Cedric Hammes
+     * @since           16/10/2026
+     */
+    auto ProcessContext::get_backtrace(platform::TaskId thread_id, std::size_t max_depth) noexcept
+            -> kstd::Result<std::vector<std::intptr_t>> {
+#ifdef ARCH_X86_64
+        const auto thread = _threads.find(thread_id);
+        if(thread == _threads.end()) {
+            return kstd::Error {fmt::format("Unable to unwind thread {}: Thread is not registered", thread_id)};
+        }
+
+        if(!thread->second.is_stopped()) {
+            return kstd::Error {fmt::format("Unable to unwind thread {}: Thread is not stopped", thread_id)};
+        }
+
+        const auto registers = thread->second.get_registers();
+        if(registers.is_error()) {
+            return kstd::Error {fmt::format("Unable to unwind thread {}: {}", thread_id, registers.get_error())};
+        }
+
+        // The registers in the order of the DWARF register numbers, the return address is the instruction pointer
+        const auto& general_registers = registers.get();
+        std::array<kstd::u64, call_frame_register_count> values {
+                general_registers.rax, general_registers.rdx, general_registers.rcx, general_registers.rbx,
+                general_registers.rsi, general_registers.rdi, general_registers.rbp, general_registers.rsp,
+                general_registers.r8,  general_registers.r9,  general_registers.r10, general_registers.r11,
+                general_registers.r12, general_registers.r13, general_registers.r14, general_registers.r15,
+                general_registers.rip};
+        std::array<bool, call_frame_register_count> is_valid {};
+        is_valid.fill(true);
+
+        // The stack is read from the stack pointer until the end of the page range, which is shrunk when the stack
+        // ends earlier
+        constexpr auto page_size = static_cast<std::intptr_t>(MemoryCache::page_size);
+        constexpr std::intptr_t stack_window_pages = 4;
+        const auto stack_begin = static_cast<std::intptr_t>(values[call_frame_stack_pointer]);
+        auto stack_end = MemoryCache::get_page_address(stack_begin) + stack_window_pages * page_size;
+        std::vector<kstd::u8> stack(static_cast<std::size_t>(stack_end - stack_begin));
+        while(stack_end > stack_begin &&
+              read_memory(stack_begin, {stack.data(), static_cast<std::size_t>(stack_end - stack_begin)}).is_error()) {
+            stack_end -= page_size;
+        }
+
+        const auto read_word = [&](std::intptr_t address) -> std::optional<kstd::u64> {
+            kstd::u64 value = 0;
+            if(address >= stack_begin && address <= stack_end - static_cast<std::intptr_t>(sizeof(value))) {
+                std::memcpy(&value, stack.data() + (address - stack_begin), sizeof(value));
+                return value;
+            }
+
+            if(read_memory(address, {reinterpret_cast<kstd::u8*>(&value), sizeof(value)}).is_error()) {
+                return std::nullopt;
+            }
+            return value;
+        };
+
+        std::vector<std::intptr_t> frames {};
+        frames.reserve(max_depth);
+        while(frames.size() < max_depth) {
+            const auto address = static_cast<std::intptr_t>(values[call_frame_return_address]);
+            frames.push_back(address);
+
+            // Return addresses point behind the call, which can be the first instruction of another function
+            const auto lookup_address = frames.size() == 1 ? address : address - 1;
+            const auto module = find_unwind_module(lookup_address);
+            if(module.is_error()) {
+                return kstd::Error {fmt::format("Unable to unwind thread {}: {}", thread_id, module.get_error())};
+            }
+
+            const CallFrameRow* row = nullptr;
+            if(module.get() != nullptr && module.get()->table != nullptr) {
+                const auto file_address = static_cast<kstd::u64>(lookup_address - module.get()->load_bias);
+                if(const auto found_row = module.get()->table->find_row(file_address); found_row.is_ok()) {
+                    row = found_row.get();
+                }
+            }
+
+            const auto stack_pointer = values[call_frame_stack_pointer];
+            if(row != nullptr && row->is_cfa_supported && row->cfa_register < call_frame_register_count &&
+               is_valid[row->cfa_register]) {
+                const auto cfa = values[row->cfa_register] + static_cast<kstd::u64>(row->cfa_offset);
+                auto next_values = values;
+                auto next_is_valid = is_valid;
+                for(std::size_t index = 0; index < call_frame_register_count; ++index) {
+                    const auto& rule = row->rules[index];
+                    switch(rule.type) {
+                        case CallFrameRuleType::SAME_VALUE: break;
+                        case CallFrameRuleType::OFFSET: {
+                            const auto value = read_word(static_cast<std::intptr_t>(cfa + rule.value));
+                            next_values[index] = value.value_or(0);
+                            next_is_valid[index] = value.has_value();
+                            break;
+                        }
+                        case CallFrameRuleType::VALUE_OFFSET: next_values[index] = cfa + rule.value; break;
+                        case CallFrameRuleType::REGISTER: {
+                            const auto source = static_cast<std::size_t>(rule.value);
+                            next_is_valid[index] = source < call_frame_register_count && is_valid[source];
+                            next_values[index] = next_is_valid[index] ? values[source] : 0;
+                            break;
+                        }
+                        default: next_is_valid[index] = false; break;
+                    }
+                }
+
+                values = next_values;
+                is_valid = next_is_valid;
+                values[call_frame_stack_pointer] = cfa;
+                is_valid[call_frame_stack_pointer] = true;
+            }
+            else {
+                // Each frame with frame pointer starts with the saved frame pointer followed by the return address
+                const auto frame_pointer = values[call_frame_frame_pointer];
+                if(!is_valid[call_frame_frame_pointer] || frame_pointer < stack_pointer ||
+                   frame_pointer % sizeof(kstd::u64) != 0) {
+                    break;
+                }
+
+                const auto saved_frame_pointer = read_word(static_cast<std::intptr_t>(frame_pointer));
+                const auto return_address = read_word(static_cast<std::intptr_t>(frame_pointer + sizeof(kstd::u64)));
+                if(!saved_frame_pointer.has_value() || !return_address.has_value()) {
+                    break;
+                }
+
+                values[call_frame_frame_pointer] = *saved_frame_pointer;
+                values[call_frame_return_address] = *return_address;
+                values[call_frame_stack_pointer] = frame_pointer + 2 * sizeof(kstd::u64);
+                is_valid[call_frame_return_address] = true;
+            }
+
+            // The stack grows down, so the stack pointer of every caller is above the stack pointer of its callee
+            if(!is_valid[call_frame_return_address] || values[call_frame_return_address] == 0 ||
+               values[call_frame_stack_pointer] <= stack_pointer) {
+                break;
+            }
+        }
+        return frames;
+#else
+        return kstd::Error {fmt::format("Unable to unwind thread {}: Unsupported architecture", thread_id)};
+#endif
+    }
+}// namespace libdebug
+#endif
\ No newline at end of file
@@ -0,0 +1,116 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#include "libdebug/memory.hpp"
+
+namespace libdebug {
+    MemoryCache::MemoryCache() noexcept ://NOLINT
+            _page_slots {},
+            _pages {},
+            _free_slots {},
+            _used_pages {0},
+            _hit_count {0},
+            _miss_count {0} {
+    }
+
+    /**
+     * This function returns the cached content of the specified page and counts a hit, or returns a null pointer
+     * and counts a miss when the page is not cached.
+     *
+     * @param page_address The page-aligned address of the page
+     * @return             The content of the page or nullptr
+     * @author             Cedric Hammes
+     * @since              16/10/2026
+     */
+    auto MemoryCache::find_page(std::intptr_t page_address) noexcept -> const Page* {
+        const auto slot = _page_slots.find(page_address);
+        if(slot == _page_slots.cend()) {
+            ++_miss_count;
+            return nullptr;
+        }
+
+        ++_hit_count;
+        return &_pages[slot->second];
+    }
+
+    /**
+     * This function allocates a slot for the specified page and returns it, so the caller can fill it with the
+     * content of the page. The address of the returned page stays stable until the page is removed.
+     *
+     * @param page_address The page-aligned address of the page
+     * @return             The slot of the page
+     * @author             Cedric Hammes
+     * @since              16/10/2026
+     */
+    auto MemoryCache::insert_page(std::intptr_t page_address) noexcept -> Page& {
+        if(const auto slot = _page_slots.find(page_address); slot != _page_slots.cend()) {
+            return _pages[slot->second];
+        }
+
+        // Reuse slot of a removed page, then slot of an invalidated page before growing the storage
+        std::size_t slot = 0;
+        if(!_free_slots.empty()) {
+            slot = _free_slots.back();
+            _free_slots.pop_back();
+        }
+        else {
+            slot = _used_pages++;
+            if(slot == _pages.size()) {
+                _pages.emplace_back();
+            }
+        }
+
+        _page_slots.emplace(page_address, slot);
+        return _pages[slot];
+    }
+
+    /**
+     * This function removes all cached pages overlapping the specified memory range.
+     *
+     * @param address The address of the memory range
+     * @param size    The size of the memory range
+     * @author        Cedric Hammes
+     * @since         16/10/2026
+     */
+    auto MemoryCache::invalidate(std::intptr_t address, std::size_t size) noexcept -> void {
+        if(_page_slots.empty() || size == 0) {
+            return;
+        }
+
+        const auto end_address = address + static_cast<std::intptr_t>(size);
+        for(auto page_address = get_page_address(address); page_address < end_address; page_address += page_size) {
+            if(const auto slot = _page_slots.find(page_address); slot != _page_slots.cend()) {
+                _free_slots.push_back(slot->second);
+                _page_slots.erase(slot);
+            }
+        }
+    }
+
+    /**
+     * This function removes all cached pages. The allocated slots are kept for reuse.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto MemoryCache::invalidate() noexcept -> void {
+        _page_slots.clear();
+        _free_slots.clear();
+        _used_pages = 0;
+    }
+}// namespace libdebug
@@ -0,0 +1,61 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  16/10/2026
+ */
+
+#include "libdebug/tracepoint.hpp"
+
+namespace libdebug {
+    /**
+     * This constructor creates an empty trace buffer with the specified capacity.
+     *
+     * @param capacity The maximal count of records
+     * @author         Cedric Hammes
+     * @since          16/10/2026
+     */
+    TraceBuffer::TraceBuffer(std::size_t capacity) noexcept ://NOLINT
+            _records {},
+            _capacity {0},
+            _dropped_count {0} {
+        set_capacity(capacity);
+    }
+
+    /**
+     * This function replaces the capacity of this buffer. All records are removed.
+     *
+     * @param capacity The maximal count of records
+     * @author         Cedric Hammes
+     * @since          16/10/2026
+     */
+    auto TraceBuffer::set_capacity(std::size_t capacity) noexcept -> void {
+        _records = {};
+        _records.reserve(capacity);
+        _capacity = capacity;
+        _dropped_count = 0;
+    }
+
+    /**
+     * This function removes all records and resets the count of dropped records. The memory is kept.
+     *
+     * @author Cedric Hammes
+     * @since  16/10/2026
+     */
+    auto TraceBuffer::clear() noexcept -> void {
+        _records.clear();
+        _dropped_count = 0;
+    }
+}// namespace libdebug
\ No newline at end of file
@@ -20,8 +20,111 @@
 #ifdef PLATFORM_WINDOWS
 #include "libdebug/platform/platform.hpp"
 #include <kstd/utils.hpp>
+#include <utility>
 
 namespace libdebug::platform {
+    OwnedHandle::OwnedHandle() noexcept ://NOLINT
+            _handle {INVALID_HANDLE_VALUE} {
+    }
+
+    OwnedHandle::OwnedHandle(FileHandle handle) noexcept ://NOLINT
+            _handle {handle} {
+    }
+
+    OwnedHandle::~OwnedHandle() noexcept {
+        if(is_valid()) {
+            ::CloseHandle(_handle);
+        }
+    }
+
+    OwnedHandle::OwnedHandle(OwnedHandle&& other) noexcept ://NOLINT
+            _handle {std::exchange(other._handle, INVALID_HANDLE_VALUE)} {
+    }
+
+    auto OwnedHandle::operator=(OwnedHandle&& other) noexcept -> OwnedHandle& {
+        if(this != &other) {
+            if(is_valid()) {
+                ::CloseHandle(_handle);
+            }
+            _handle = std::exchange(other._handle, INVALID_HANDLE_VALUE);
+        }
+        return *this;
+    }
+
+    auto OwnedHandle::is_valid() const noexcept -> bool {
+        return _handle != INVALID_HANDLE_VALUE && _handle != nullptr;
+    }
+
+    FileMapping::FileMapping() noexcept ://NOLINT
+            _data {nullptr},
+            _size {0} {
+    }
+
+    FileMapping::FileMapping(const kstd::u8* data, std::size_t size) noexcept ://NOLINT
+            _data {data},
+            _size {size} {
+    }
+
+    FileMapping::~FileMapping() noexcept {
+        if(_data != nullptr) {
+            ::UnmapViewOfFile(_data);
+        }
+    }
+
+    FileMapping::FileMapping(FileMapping&& other) noexcept ://NOLINT
+            _data {std::exchange(other._data, nullptr)},
+            _size {std::exchange(other._size, 0)} {
+    }
+
+    auto FileMapping::operator=(FileMapping&& other) noexcept -> FileMapping& {
+        if(this != &other) {
+            if(_data != nullptr) {
+                ::UnmapViewOfFile(_data);
+            }
+            _data = std::exchange(other._data, nullptr);
+            _size = std::exchange(other._size, 0);
+        }
+        return *this;
+    }
+
+    /**
+     * This function maps the whole specified file read-only into the memory of the debugger. The pages are loaded
+     * by the operating system when they are accessed first.
+     *
+     * @param path The path to the file
+     * @return     The mapping of the file or an error
+     * @author     Cedric Hammes
+     * @since      16/10/2026
+     */
+    auto map_file(const std::filesystem::path& path) noexcept -> kstd::Result<FileMapping> {
+        const OwnedHandle file {::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                              FILE_ATTRIBUTE_NORMAL, nullptr)};
+        if(!file.is_valid()) {
+            return kstd::Error {fmt::format("Unable to map {}: {}", path.string(), get_last_error())};
+        }
+
+        LARGE_INTEGER file_size {};
+        if(!::GetFileSizeEx(file.get(), &file_size)) {
+            return kstd::Error {fmt::format("Unable to map {}: {}", path.string(), get_last_error())};
+        }
+
+        if(file_size.QuadPart == 0) {
+            return kstd::Error {fmt::format("Unable to map {}: File is empty", path.string())};
+        }
+
+        // The view stays valid after the mapping object and the file are closed
+        const OwnedHandle mapping {::CreateFileMappingW(file.get(), nullptr, PAGE_READONLY, 0, 0, nullptr)};
+        if(!mapping.is_valid()) {
+            return kstd::Error {fmt::format("Unable to map {}: {}", path.string(), get_last_error())};
+        }
+
+        const auto* data = ::MapViewOfFile(mapping.get(), FILE_MAP_READ, 0, 0, 0);
+        if(data == nullptr) {
+            return kstd::Error {fmt::format("Unable to map {}: {}", path.string(), get_last_error())};
+        }
+        return FileMapping {static_cast<const kstd::u8*>(data), static_cast<std::size_t>(file_size.QuadPart)};
+    }
+
     /**
      * This method returns the last thrown error in this program. This is being used to print the error thrown by the
      * System API to the user.
@@ -0,0 +1,53 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include <gtest/gtest.h>
+#include <libdebug/breakpoint.hpp>
+#include <set>
+
+TEST(libdebug_BreakpointTable, test_insert_find_erase) {
+    libdebug::BreakpointTable table {};
+    ASSERT_TRUE(table.empty());
+    ASSERT_EQ(table.find(0x401000), nullptr);
+
+    // Insert enough neighboring addresses to force collisions and growth
+    for(std::intptr_t address = 0x401000; address < 0x401000 + 1000; ++address) {
+        ASSERT_TRUE(table.insert(libdebug::Breakpoint {address}));
+    }
+    ASSERT_FALSE(table.insert(libdebug::Breakpoint {0x401000}));
+    ASSERT_EQ(table.size(), 1000);
+
+    // Erase every second address, the remaining ones must still be found
+    for(std::intptr_t address = 0x401000; address < 0x401000 + 1000; address += 2) {
+        ASSERT_TRUE(table.erase(address));
+    }
+    ASSERT_FALSE(table.erase(0x401000));
+    ASSERT_EQ(table.size(), 500);
+    for(std::intptr_t address = 0x401000; address < 0x401000 + 1000; ++address) {
+        ASSERT_EQ(table.contains(address), address % 2 == 1);
+    }
+    ASSERT_EQ(table.at(0x401001).get_address(), 0x401001);
+    ASSERT_THROW(static_cast<void>(table.at(0x401000)), std::out_of_range);
+
+    // Iteration visits every breakpoint once
+    std::set<std::intptr_t> addresses {};
+    for(const auto& breakpoint : table) {
+        ASSERT_TRUE(addresses.insert(breakpoint.get_address()).second);
+    }
+    ASSERT_EQ(addresses.size(), 500);
+
+    table.clear();
+    ASSERT_TRUE(table.empty());
+    ASSERT_FALSE(table.contains(0x401001));
+}
@@ -0,0 +1,127 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include <array>
+#include <cstring>
+#include <elf.h>
+#include <gtest/gtest.h>
+#include <libdebug/process.hpp>
+#include <sys/procfs.h>
+
+TEST(libdebug_ProcessContext, test_write_core_file) {
+    using namespace std::chrono_literals;
+    auto process_context = libdebug::ProcessContext {SAMPLE_BACKTRACE_FILE, {}};
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+    const auto address = process_context.get_symbols().get()->find_address("backtrace_leaf");
+    ASSERT_TRUE(address.has_value());
+    ASSERT_FALSE(process_context.add_breakpoint(*address).is_error());
+
+    const auto core_path = std::filesystem::temp_directory_path() /
+                           fmt::format("libdebug-core-{}", process_context.get_process_id());
+    ASSERT_FALSE(process_context.write_core_file(core_path).is_error());
+    const auto mapping = libdebug::platform::map_file(core_path);
+    ASSERT_TRUE(mapping.is_ok());
+    const auto data = mapping.get().get_data();
+
+    Elf64_Ehdr header {};
+    std::memcpy(&header, data.data(), sizeof(header));
+    ASSERT_EQ(std::memcmp(header.e_ident, ELFMAG, SELFMAG), 0);
+    ASSERT_EQ(header.e_type, ET_CORE);
+    ASSERT_EQ(header.e_phnum, process_context.get_memory_map().get()->size() + 1);
+
+    // The first note of the main thread holds its registers
+    Elf64_Phdr note_segment {};
+    std::memcpy(&note_segment, data.data() + header.e_phoff, sizeof(note_segment));
+    ASSERT_EQ(note_segment.p_type, PT_NOTE);
+    std::optional<elf_prstatus> status {};
+    for(auto offset = note_segment.p_offset; offset < note_segment.p_offset + note_segment.p_filesz;) {
+        Elf64_Nhdr note {};
+        std::memcpy(&note, data.data() + offset, sizeof(note));
+        const auto description_offset = offset + sizeof(note) + ((note.n_namesz + 3) & ~3U);
+        if(note.n_type == NT_PRSTATUS && !status.has_value()) {
+            status.emplace();
+            std::memcpy(&*status, data.data() + description_offset, sizeof(elf_prstatus));
+        }
+        offset = description_offset + ((note.n_descsz + 3) & ~3U);
+    }
+    ASSERT_TRUE(status.has_value());
+    ASSERT_EQ(status->pr_pid, process_context.get_process_id());
+
+    libdebug::arch::GeneralRegisters registers {};
+    std::memcpy(&registers, &status->pr_reg, sizeof(registers));
+    const auto instruction_pointer = libdebug::arch::get_instruction_pointer(registers);
+    auto& thread = process_context.get_threads().at(process_context.get_process_id());
+    ASSERT_EQ(instruction_pointer, thread.get_instruction_pointer().get());
+
+    // The code in the file matches the memory, the breakpoint is replaced with the original code
+    bool found_leaf = false;
+    for(std::size_t index = 1; index < header.e_phnum; ++index) {
+        Elf64_Phdr segment {};
+        std::memcpy(&segment, data.data() + header.e_phoff + index * sizeof(segment), sizeof(segment));
+        const auto begin = static_cast<std::intptr_t>(segment.p_vaddr);
+        if(*address < begin || *address + 16 > begin + static_cast<std::intptr_t>(segment.p_filesz)) {
+            continue;
+        }
+
+        std::array<kstd::u8, 16> code {};
+        ASSERT_FALSE(process_context.read_memory(*address, code).is_error());
+        const auto* file_code = data.data() + segment.p_offset + (*address - begin);
+        ASSERT_NE(file_code[0], libdebug::Breakpoint::interrupt_instruction);
+        ASSERT_EQ(std::memcmp(file_code + 1, code.data() + 1, code.size() - 1), 0);
+        found_leaf = true;
+    }
+    ASSERT_TRUE(found_leaf);
+
+    std::filesystem::remove(core_path);
+    ::kill(process_context.get_process_id(), SIGKILL);
+}
+TEST(libdebug_ProcessContext, test_write_core_file_attached) {
+    using namespace std::chrono_literals;
+    const auto child_pid = ::fork();
+    if(child_pid == 0) {
+        ::execl(SAMPLE_SINGLETHREAD_FILE, SAMPLE_SINGLETHREAD_FILE, nullptr);
+    }
+
+    sleep(1);
+    auto process_context = libdebug::ProcessContext {child_pid};
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+    const auto core_path = std::filesystem::temp_directory_path() / fmt::format("libdebug-core-{}", child_pid);
+    ASSERT_FALSE(process_context.write_core_file(core_path).is_error());
+    const auto mapping = libdebug::platform::map_file(core_path);
+    ASSERT_TRUE(mapping.is_ok());
+    const auto data = mapping.get().get_data();
+
+    // The command name of an attached process is taken from the process instead of the executable link
+    Elf64_Ehdr header {};
+    std::memcpy(&header, data.data(), sizeof(header));
+    Elf64_Phdr note_segment {};
+    std::memcpy(&note_segment, data.data() + header.e_phoff, sizeof(note_segment));
+    std::optional<elf_prpsinfo> process_info {};
+    for(auto offset = note_segment.p_offset; offset < note_segment.p_offset + note_segment.p_filesz;) {
+        Elf64_Nhdr note {};
+        std::memcpy(&note, data.data() + offset, sizeof(note));
+        const auto description_offset = offset + sizeof(note) + ((note.n_namesz + 3) & ~3U);
+        if(note.n_type == NT_PRPSINFO) {
+            process_info.emplace();
+            std::memcpy(&*process_info, data.data() + description_offset, sizeof(elf_prpsinfo));
+        }
+        offset = description_offset + ((note.n_descsz + 3) & ~3U);
+    }
+    ASSERT_TRUE(process_info.has_value());
+    const auto file_name = std::filesystem::path {SAMPLE_SINGLETHREAD_FILE}.filename().string();
+    ASSERT_EQ(std::string {process_info->pr_fname}, file_name.substr(0, sizeof(process_info->pr_fname) - 1));
+
+    std::filesystem::remove(core_path);
+    ::kill(child_pid, SIGKILL);
+}
@@ -0,0 +1,81 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <libdebug/coverage.hpp>
+#include <sstream>
+
+TEST(libdebug_Coverage, test_cover_functions) {
+    using namespace std::chrono_literals;
+    auto process_context = libdebug::ProcessContext {SAMPLE_BACKTRACE_FILE, {}};
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+    const auto address = process_context.get_symbols().get()->find_address("backtrace_leaf");
+    ASSERT_TRUE(address.has_value());
+
+    auto coverage = libdebug::Coverage {process_context};
+    ASSERT_FALSE(coverage.install(libdebug::CoverageMode::FUNCTIONS).is_error());
+    ASSERT_GT(coverage.get_blocks().size(), 0);
+    ASSERT_FALSE(coverage.is_covered(*address));
+
+    // The breakpoint of the leaf removes itself on the first hit
+    ASSERT_FALSE(coverage.run(300ms).is_error());
+    ASSERT_TRUE(coverage.is_covered(*address));
+    ASSERT_EQ(process_context.get_tracepoints().at(*address).hit_count, 1);
+    ASSERT_FALSE(process_context.get_breakpoints().at(*address).is_enabled());
+    ASSERT_LT(coverage.get_covered_count(), coverage.get_blocks().size());
+    ASSERT_EQ(process_context.get_trace_buffer().size(), 0);
+    ASSERT_EQ(process_context.get_trace_buffer().get_dropped_count(), 0);
+
+    // The remaining breakpoints are removed, the coverage is kept
+    ASSERT_FALSE(coverage.uninstall().is_error());
+    ASSERT_TRUE(process_context.get_tracepoints().empty());
+    ASSERT_TRUE(coverage.is_covered(*address));
+
+    std::stringstream drcov {};
+    coverage.write_drcov(drcov);
+    const auto content = drcov.str();
+    ASSERT_TRUE(content.starts_with("DRCOV VERSION: 2\nDRCOV FLAVOR: drcov\n"));
+    const auto table_header = fmt::format("BB Table: {} bbs\n", coverage.get_covered_count());
+    const auto table_offset = content.find(table_header);
+    ASSERT_NE(table_offset, std::string::npos);
+    ASSERT_EQ(content.size() - table_offset - table_header.size(), coverage.get_covered_count() * 8);
+    ::kill(process_context.get_process_id(), SIGKILL);
+}
+
+TEST(libdebug_Coverage, test_cover_basic_blocks) {
+    using namespace std::chrono_literals;
+    auto process_context = libdebug::ProcessContext {SAMPLE_BACKTRACE_FILE, {}};
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+    const auto symbols = process_context.get_symbols().get();
+    const auto address = symbols->find_address("backtrace_middle");
+    ASSERT_TRUE(address.has_value());
+    const auto symbol = symbols->find_symbol(*address);
+    ASSERT_TRUE(symbol.has_value() && symbol->is_function);
+
+    // The call of the leaf ends the first block of the middle function
+    auto coverage = libdebug::Coverage {process_context};
+    ASSERT_FALSE(coverage.install(libdebug::CoverageMode::BASIC_BLOCKS).is_error());
+    const auto blocks = coverage.get_blocks();
+    const auto function_end = *address + static_cast<std::intptr_t>(symbol->size);
+    const auto function_blocks = std::count_if(blocks.begin(), blocks.end(), [&](const auto& block) {
+        return block.address >= *address && block.address < function_end;
+    });
+    ASSERT_GT(function_blocks, 1);
+
+    ASSERT_FALSE(coverage.run(300ms).is_error());
+    ASSERT_TRUE(coverage.is_covered(*address));
+    ASSERT_FALSE(coverage.uninstall().is_error());
+    ::kill(process_context.get_process_id(), SIGKILL);
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include <gtest/gtest.h>
+#include <libdebug/session.hpp>
+#include <map>
+#include <map>
+#include <set>
+#include <vector>
+
+TEST(libdebug_DebugSession, test_multi_process_poll) {
+    using namespace std::chrono_literals;
+    libdebug::DebugSession session {};
+    std::set<libdebug::platform::TaskId> signaled_processes {};
+    for(auto i = 0; i < 3; ++i) {
+        auto& process = session.add_process(libdebug::ProcessContext {SAMPLE_SINGLETHREAD_FILE, {}});
+        process.add_event_callback(
+                [](const libdebug::ProcessEvent& event, void* data) {
+                    ASSERT_EQ(event.event_type, libdebug::ProcessEventType::SIGNAL);
+                    ASSERT_EQ(event.signal_event.signal_info.si_signo, SIGTRAP);
+                    static_cast<std::set<libdebug::platform::TaskId>*>(data)->insert(event.signal_event.process_id);
+                },
+                &signaled_processes);
+    }
+
+    // Every child stops with SIGTRAP after exec
+    while(signaled_processes.size() < 3) {
+        const auto event_count = session.poll_events(5s);
+        ASSERT_FALSE(event_count.is_error());
+        ASSERT_GT(event_count.get(), 0);
+    }
+
+    // All children are stopped, so the poll must time out
+    const auto event_count = session.poll_events(50ms);
+    ASSERT_FALSE(event_count.is_error());
+    ASSERT_EQ(event_count.get(), 0);
+
+    for(const auto& [process_id, _] : session.get_processes()) {
+        ::kill(process_id, SIGKILL);
+    }
+}
+
+TEST(libdebug_DebugSession, test_process_exit) {
+    using namespace std::chrono_literals;
+    libdebug::DebugSession session {};
+    auto& process = session.add_process(libdebug::ProcessContext {SAMPLE_SINGLETHREAD_FILE, {}});
+    std::vector<libdebug::ProcessEvent> events {};
+    process.add_event_callback(
+            [](const libdebug::ProcessEvent& event, void* data) {
+                static_cast<std::vector<libdebug::ProcessEvent>*>(data)->push_back(event);
+            },
+            &events);
+    ASSERT_GT(session.poll_events(5s).get(), 0);
+
+    // The exit is reported through the session with its status
+    ::kill(process.get_process_id(), SIGKILL);
+    ASSERT_GT(session.poll_events(5s).get(), 0);
+    ASSERT_EQ(events.back().event_type, libdebug::ProcessEventType::SIGNAL);
+    ASSERT_TRUE(events.back().signal_event.is_exit);
+    ASSERT_TRUE(WIFSIGNALED(events.back().signal_event.exit_status));
+    ASSERT_EQ(WTERMSIG(events.back().signal_event.exit_status), SIGKILL);
+    ASSERT_FALSE(session.remove_process(process.get_process_id()).is_error());
+}
+
+TEST(libdebug_DebugSession, test_thread_lifecycle) {
+    using namespace std::chrono_literals;
+    struct LifecycleState {
+        libdebug::DebugSession* session;
+        std::map<kstd::u8, std::size_t> event_counts;
+    };
+
+    libdebug::DebugSession session {};
+    LifecycleState state {&session, {}};
+    auto& process = session.add_process(libdebug::ProcessContext {SAMPLE_THREADCHURN_FILE, {}});
+    process.add_event_callback(
+            [](const libdebug::ProcessEvent& event, void* data) {
+                auto* state = static_cast<LifecycleState*>(data);
+                ++state->event_counts[event.event_type];
+
+                // The child process is forked after all threads were joined
+                if(event.event_type == libdebug::ProcessEventType::CREATE_PROCESS) {
+                    state->session->wake();
+                }
+            },
+            &state);
+    ASSERT_GT(session.poll_events(5s).get(), 0);
+
+    // Lifecycle stops aren't counted, so the poll only returns after the wake. Threads created while polling are
+    // resolved, otherwise their start stop would be missed and the poll would never return.
+    ASSERT_FALSE(process.resume_thread(process.get_process_id()).is_error());
+    while(state.event_counts[libdebug::ProcessEventType::CREATE_PROCESS] == 0) {
+        ASSERT_FALSE(session.poll_events(std::nullopt).is_error());
+    }
+
+    ASSERT_EQ(state.event_counts[libdebug::ProcessEventType::CREATE_THREAD], 4);
+    ASSERT_EQ(state.event_counts[libdebug::ProcessEventType::DELETE_THREAD], 4);
+    ASSERT_EQ(process.get_threads().size(), 1);
+    ::kill(process.get_process_id(), SIGKILL);
+}
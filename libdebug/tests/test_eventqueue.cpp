@@ -0,0 +1,148 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include <gtest/gtest.h>
+#include <libdebug/process.hpp>
+#include <map>
+#include <thread>
+
+namespace {
+    auto make_event(libdebug::platform::TaskId thread_id) noexcept -> libdebug::ProcessEvent {
+        libdebug::ProcessEvent event {};
+        event.event_type = libdebug::ProcessEventType::CREATE_THREAD;
+        event.create_thread_event.thread_id = thread_id;
+        return event;
+    }
+
+    auto make_signal_event(libdebug::platform::TaskId thread_id, int signal_number) noexcept
+            -> libdebug::ProcessEvent {
+        libdebug::ProcessEvent event {};
+        event.event_type = libdebug::ProcessEventType::SIGNAL;
+        event.signal_event.thread_id = thread_id;
+        event.signal_event.signal_info.si_signo = signal_number;
+        return event;
+    }
+}// namespace
+
+TEST(libdebug_EventQueue, test_drop) {
+    libdebug::EventQueue queue {2, libdebug::BackpressurePolicy::DROP};
+    ASSERT_TRUE(queue.push(make_event(1)));
+    ASSERT_TRUE(queue.push(make_event(2)));
+    ASSERT_FALSE(queue.push(make_event(3)));
+    ASSERT_EQ(queue.size(), 2);
+    ASSERT_EQ(queue.get_dropped_count(), 1);
+
+    libdebug::ProcessEvent event {};
+    ASSERT_TRUE(queue.pop(event));
+    ASSERT_EQ(event.create_thread_event.thread_id, 1);
+    ASSERT_TRUE(queue.push(make_event(4)));
+    ASSERT_TRUE(queue.pop(event));
+    ASSERT_EQ(event.create_thread_event.thread_id, 2);
+    ASSERT_TRUE(queue.pop(event));
+    ASSERT_EQ(event.create_thread_event.thread_id, 4);
+
+    queue.close();
+    ASSERT_FALSE(queue.pop(event));
+}
+
+TEST(libdebug_EventQueue, test_coalesce) {
+    libdebug::EventQueue queue {2, libdebug::BackpressurePolicy::COALESCE};
+    ASSERT_TRUE(queue.push(make_event(1)));
+    ASSERT_TRUE(queue.push(make_event(2)));
+
+    // Only the signals of the same thread replace each other, the thread events are kept
+    for(auto signal_number = 1; signal_number <= 3; ++signal_number) {
+        ASSERT_FALSE(queue.push(make_signal_event(7, signal_number)));
+    }
+    ASSERT_FALSE(queue.push(make_event(3)));
+    ASSERT_EQ(queue.get_coalesced_count(), 2);
+
+    // The held back events are taken by the consumer without another push
+    libdebug::ProcessEvent event {};
+    ASSERT_TRUE(queue.pop(event));
+    ASSERT_EQ(event.create_thread_event.thread_id, 1);
+    ASSERT_TRUE(queue.pop(event));
+    ASSERT_EQ(event.create_thread_event.thread_id, 2);
+    ASSERT_TRUE(queue.pop(event));
+    ASSERT_EQ(event.event_type, libdebug::ProcessEventType::SIGNAL);
+    ASSERT_EQ(event.signal_event.signal_info.si_signo, 3);
+    ASSERT_TRUE(queue.pop(event));
+    ASSERT_EQ(event.create_thread_event.thread_id, 3);
+
+    queue.close();
+    ASSERT_FALSE(queue.pop(event));
+}
+
+TEST(libdebug_EventQueue, test_coalesce_race) {
+    // Thread events are never coalesced, so the consumer has to take every pushed event before the queue is closed
+    constexpr std::size_t event_count = 200000;
+    libdebug::EventQueue queue {2, libdebug::BackpressurePolicy::COALESCE};
+    std::size_t popped_count = 0;
+    std::thread consumer {[&] {
+        libdebug::ProcessEvent event {};
+        while(queue.pop(event)) {
+            ++popped_count;
+        }
+    }};
+
+    for(std::size_t index = 0; index < event_count; ++index) {
+        static_cast<void>(queue.push(make_event(static_cast<libdebug::platform::TaskId>(index))));
+        if(index % 64 == 0) {
+            queue.flush();
+        }
+    }
+    queue.close();
+    consumer.join();
+    ASSERT_EQ(popped_count, event_count);
+    ASSERT_EQ(queue.get_coalesced_count(), 0);
+}
+
+TEST(libdebug_EventQueue, test_async_dispatch) {
+    using namespace std::chrono_literals;
+    auto process_context = libdebug::ProcessContext {SAMPLE_THREADCHURN_FILE, {}};
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+
+    // The slow callback is executed on the consumer thread, the events are only counted after the dispatch is disabled
+    std::map<kstd::u8, std::size_t> event_counts {};
+    std::thread::id consumer_thread_id {};
+    process_context.enable_async_dispatch(4, libdebug::BackpressurePolicy::BLOCK);
+    process_context.add_event_callback(
+            [&](const libdebug::ProcessEvent& event, void*) {
+                std::this_thread::sleep_for(10ms);
+                consumer_thread_id = std::this_thread::get_id();
+                ++event_counts[event.event_type];
+            },
+            nullptr);
+    ASSERT_NE(process_context.get_event_dispatcher(), nullptr);
+
+    ASSERT_FALSE(process_context.resume_thread(process_context.get_process_id()).is_error());
+    while(true) {
+        const auto signal = process_context.wait_for_signal(1s);
+        ASSERT_FALSE(signal.is_error());
+        if(!signal.get().has_value()) {
+            break;
+        }
+
+        const auto thread_id = signal.get()->get_thread()->get_thread_id();
+        ASSERT_FALSE(process_context.resume_thread(thread_id, signal.get()->get_signal_info().si_signo).is_error());
+    }
+
+    process_context.disable_async_dispatch();
+    ASSERT_EQ(process_context.get_event_dispatcher(), nullptr);
+    ASSERT_NE(consumer_thread_id, std::this_thread::get_id());
+    ASSERT_EQ(event_counts[libdebug::ProcessEventType::CREATE_THREAD], 4);
+    ASSERT_EQ(event_counts[libdebug::ProcessEventType::DELETE_THREAD], 4);
+    ASSERT_EQ(event_counts[libdebug::ProcessEventType::CREATE_PROCESS], 1);
+    ::kill(process_context.get_process_id(), SIGKILL);
+}
\ No newline at end of file
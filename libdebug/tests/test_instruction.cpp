@@ -0,0 +1,72 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include <cstring>
+#include <gtest/gtest.h>
+#include <libdebug/arch/instruction.hpp>
+#include <vector>
+
+#ifdef ARCH_X86_64
+TEST(libdebug_Instruction, test_decode_instruction) {
+    const std::vector<std::vector<kstd::u8>> instructions {
+            {0x90},                                                       // nop
+            {0xF3, 0x0F, 0x1E, 0xFA},                                     // endbr64
+            {0x31, 0xED},                                                 // xor ebp, ebp
+            {0x48, 0x83, 0xE4, 0xF0},                                     // and rsp, -16
+            {0x48, 0xB8, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08}, // movabs rax, imm64
+            {0x66, 0x81, 0xC3, 0x34, 0x12},                               // add bx, 0x1234
+            {0xF7, 0x04, 0x24, 0x01, 0x00, 0x00, 0x00},                   // test dword [rsp], 1
+            {0xC5, 0xFC, 0x77},                                           // vzeroall
+            {0xC4, 0xE3, 0x7D, 0x18, 0xC1, 0x01},                         // vinsertf128 ymm0, ymm0, xmm1, 1
+            {0x0F, 0x05},                                                 // syscall
+    };
+
+    for(const auto& code : instructions) {
+        const auto instruction = libdebug::arch::decode_instruction(code);
+        ASSERT_FALSE(instruction.is_error());
+        ASSERT_EQ(instruction.get().size, code.size());
+    }
+    ASSERT_TRUE(libdebug::arch::decode_instruction(std::vector<kstd::u8> {0x48, 0x8B}).is_error());
+}
+
+TEST(libdebug_Instruction, test_relocate_instruction) {
+    // lea rdi, [rip + 0x10] moved 0x1000 bytes forward
+    const std::vector<kstd::u8> lea {0x48, 0x8D, 0x3D, 0x10, 0x00, 0x00, 0x00};
+    const auto relocated_lea = libdebug::arch::relocate_instruction(lea, 0x401000, 0x402000);
+    ASSERT_FALSE(relocated_lea.is_error());
+    ASSERT_EQ(relocated_lea.get().size, 7);
+    std::int32_t displacement = 0;
+    std::memcpy(&displacement, relocated_lea.get().code.data() + 3, sizeof(displacement));
+    ASSERT_EQ(displacement, 0x10 - 0x1000);
+
+    // jne +0x20 is widened to its 32-bit form
+    const std::vector<kstd::u8> jne {0x75, 0x20};
+    const auto relocated_jne = libdebug::arch::relocate_instruction(jne, 0x401000, 0x402000);
+    ASSERT_FALSE(relocated_jne.is_error());
+    ASSERT_EQ(relocated_jne.get().size, 6);
+    ASSERT_EQ(relocated_jne.get().original_size, 2);
+    ASSERT_EQ(relocated_jne.get().code[1], 0x85);
+    std::memcpy(&displacement, relocated_jne.get().code.data() + 2, sizeof(displacement));
+    ASSERT_EQ(0x402000 + 6 + displacement, 0x401000 + 2 + 0x20);
+
+    // Calls are marked, so the pushed return address can be fixed
+    const std::vector<kstd::u8> call {0xE8, 0x00, 0x00, 0x00, 0x00};
+    const auto relocated_call = libdebug::arch::relocate_instruction(call, 0x401000, 0x402000);
+    ASSERT_FALSE(relocated_call.is_error());
+    ASSERT_TRUE(relocated_call.get().is_call);
+
+    // RIP-relative operands out of range can't be relocated
+    ASSERT_TRUE(libdebug::arch::relocate_instruction(lea, 0x401000, 0x7F0000000000).is_error());
+}
+#endif
\ No newline at end of file
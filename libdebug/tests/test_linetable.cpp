@@ -0,0 +1,82 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <libdebug/process.hpp>
+#include <gtest/gtest.h>
+#include <libdebug/dwarf.hpp>
+#include <libdebug/process.hpp>
+#include <libdebug/symbols.hpp>
+
+TEST(libdebug_LineTable, test_find_location) {
+    libdebug::LineTable line_table {SAMPLE_SINGLETHREAD_FILE};
+    ASSERT_TRUE(line_table.has_line_information());
+
+    // The first instruction of main is located at the declaration of main
+    libdebug::SymbolTable symbols {SAMPLE_SINGLETHREAD_FILE};
+    const auto address = symbols.find_address("main");
+    ASSERT_TRUE(address.has_value());
+    const auto location = line_table.find_location(*address);
+    ASSERT_FALSE(location.is_error());
+    ASSERT_TRUE(location.get().has_value());
+    ASSERT_TRUE(location.get()->file.ends_with("singlethread.cpp"));
+    ASSERT_EQ(location.get()->line, 37);
+    ASSERT_FALSE(line_table.find_location(0).get().has_value());
+
+    // The addresses of the body of main are inside of main
+    const auto addresses = line_table.find_addresses("singlethread.cpp", 38);
+    ASSERT_FALSE(addresses.is_error());
+    ASSERT_FALSE(addresses.get().empty());
+    for(const auto body_address : addresses.get()) {
+        ASSERT_EQ(symbols.find_symbol(body_address)->name, "main");
+        ASSERT_EQ(line_table.find_location(body_address).get()->line, 38);
+    }
+    ASSERT_TRUE(line_table.find_addresses("other.cpp", 38).get().empty());
+    ASSERT_THROW(libdebug::LineTable {"/nonexistent"}, std::runtime_error);
+}
+
+TEST(libdebug_LineTable, test_line_cache) {
+    const auto cache_directory = std::filesystem::temp_directory_path() / "libdebug-line-cache";
+    std::filesystem::remove_all(cache_directory);
+
+    // The first line table creates the cache file on its first lookup, the second one is loaded from it
+    const auto addresses = libdebug::LineTable {SAMPLE_SINGLETHREAD_FILE, cache_directory}.find_addresses(
+            "singlethread.cpp", 38);
+    ASSERT_FALSE(addresses.get().empty());
+    ASSERT_FALSE(std::filesystem::is_empty(cache_directory));
+
+    libdebug::LineTable line_table {SAMPLE_SINGLETHREAD_FILE, cache_directory};
+    ASSERT_EQ(line_table.find_addresses("singlethread.cpp", 38).get(), addresses.get());
+    ASSERT_EQ(line_table.find_location(addresses.get().front()).get()->line, 38);
+    std::filesystem::remove_all(cache_directory);
+}
+
+TEST(libdebug_LineTable, test_line_breakpoint) {
+    using namespace std::chrono_literals;
+    auto process_context = libdebug::ProcessContext {SAMPLE_SINGLETHREAD_FILE, {}};
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+    ASSERT_TRUE(process_context.add_breakpoint("singlethread.cpp", 1000).is_error());
+    ASSERT_FALSE(process_context.add_breakpoint("singlethread.cpp", 38).is_error());
+
+    ASSERT_FALSE(process_context.resume_thread(process_context.get_process_id()).is_error());
+    const auto signal = process_context.wait_for_signal(5s);
+    ASSERT_FALSE(signal.is_error());
+    ASSERT_TRUE(signal.get().has_value());
+    ASSERT_TRUE(signal.get()->is_breakpoint());
+    const auto address = signal.get()->get_thread()->get_breakpoint_address();
+    ASSERT_TRUE(address.has_value());
+    ASSERT_EQ(process_context.get_line_table().get()->find_location(*address).get()->line, 38);
+    ::kill(process_context.get_process_id(), SIGKILL);
+}
\ No newline at end of file
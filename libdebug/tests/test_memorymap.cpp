@@ -0,0 +1,80 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <libdebug/memory_map.hpp>
+#include <libdebug/process.hpp>
+#include <sys/mman.h>
+#include <unistd.h>
+
+TEST(libdebug_MemoryMap, test_find_region) {
+    // The map of the test itself contains the stack and the code of this test
+    libdebug::MemoryMap memory_map {};
+    ASSERT_TRUE(memory_map.is_stale());
+    ASSERT_FALSE(memory_map.refresh(::getpid()).is_error());
+    ASSERT_FALSE(memory_map.is_stale());
+    ASSERT_GT(memory_map.size(), 0);
+    ASSERT_FALSE(memory_map.find_region(0).has_value());
+
+    int local = 0;
+    const auto stack_region = memory_map.find_region(reinterpret_cast<std::intptr_t>(&local));
+    ASSERT_TRUE(stack_region.has_value());
+    ASSERT_TRUE(stack_region->has_permission(libdebug::MemoryPermission::READ));
+    ASSERT_TRUE(stack_region->has_permission(libdebug::MemoryPermission::WRITE));
+    ASSERT_FALSE(stack_region->has_permission(libdebug::MemoryPermission::EXECUTE));
+    ASSERT_EQ(stack_region->path, "[stack]");
+
+    const auto code_region = memory_map.find_region(reinterpret_cast<std::intptr_t>(&::getpid));
+    ASSERT_TRUE(code_region.has_value());
+    ASSERT_TRUE(code_region->has_permission(libdebug::MemoryPermission::EXECUTE));
+    ASSERT_FALSE(code_region->path.empty());
+
+    // The regions are sorted, the vsyscall page is above the signed range, and a refresh of an unchanged map
+    // keeps them
+    for(std::size_t index = 1; index < memory_map.size(); ++index) {
+        ASSERT_LE(static_cast<std::uintptr_t>(memory_map.get_region(index - 1).end),
+                  static_cast<std::uintptr_t>(memory_map.get_region(index).begin));
+    }
+    const auto size = memory_map.size();
+    ASSERT_FALSE(memory_map.refresh(::getpid()).is_error());
+    ASSERT_EQ(memory_map.size(), size);
+    ASSERT_EQ(memory_map.find_region(reinterpret_cast<std::intptr_t>(&local))->path, "[stack]");
+
+    // A new mapping is found after the next refresh
+    auto* page = ::mmap(nullptr, 4096, PROT_READ | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(page, MAP_FAILED);
+    ASSERT_FALSE(memory_map.refresh(::getpid()).is_error());
+    const auto page_region = memory_map.find_region(reinterpret_cast<std::intptr_t>(page));
+    ::munmap(page, 4096);
+    ASSERT_TRUE(page_region.has_value());
+    ASSERT_TRUE(page_region->has_permission(libdebug::MemoryPermission::EXECUTE));
+    ASSERT_FALSE(page_region->has_permission(libdebug::MemoryPermission::WRITE));
+}
+
+TEST(libdebug_MemoryMap, test_process_memory_map) {
+    using namespace std::chrono_literals;
+    auto process_context = libdebug::ProcessContext {SAMPLE_SINGLETHREAD_FILE, {}};
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+
+    const auto memory_map = process_context.get_memory_map();
+    ASSERT_FALSE(memory_map.is_error());
+    const auto main_address = process_context.get_symbols().get()->find_address("main");
+    const auto region = memory_map.get()->find_region(*main_address);
+    ASSERT_TRUE(region.has_value());
+    ASSERT_TRUE(region->has_permission(libdebug::MemoryPermission::EXECUTE));
+    ASSERT_TRUE(region->path.ends_with("singlethread.out"));
+    ::kill(process_context.get_process_id(), SIGKILL);
+}
\ No newline at end of file
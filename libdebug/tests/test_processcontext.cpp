@@ -12,15 +12,20 @@
 //  See the License for the specific language governing permissions and
 //  limitations under the License.
 
+#include <algorithm>
 #include <gtest/gtest.h>
 #include <libdebug/process.hpp>
+#include <map>
+#include <numeric>
+#include <set>
+#include <sys/syscall.h>
 #include <thread>
 
 TEST(libdebug_ProcessContext, test_multi_thread_attach) {
     const auto child_pid = ::fork();
     if (child_pid == 0) {
         ::personality(ADDR_NO_RANDOMIZE);
-        ::execle(SAMPLE_MULTITHREAD_FILE, SAMPLE_MULTITHREAD_FILE);
+        ::execl(SAMPLE_MULTITHREAD_FILE, SAMPLE_MULTITHREAD_FILE, nullptr);
     } else {
         sleep(1);
         const auto process_context = libdebug::ProcessContext {child_pid};
@@ -33,7 +38,7 @@ TEST(libdebug_ProcessContext, test_single_thread_attach) {
     const auto child_pid = ::fork();
     if (child_pid == 0) {
         ::personality(ADDR_NO_RANDOMIZE);
-        ::execle(SAMPLE_SINGLETHREAD_FILE, SAMPLE_SINGLETHREAD_FILE);
+        ::execl(SAMPLE_SINGLETHREAD_FILE, SAMPLE_SINGLETHREAD_FILE, nullptr);
     } else {
         sleep(1);
         const auto process_context = libdebug::ProcessContext {child_pid};
@@ -41,3 +46,697 @@ TEST(libdebug_ProcessContext, test_single_thread_attach) {
         ::kill(child_pid, SIGKILL);
     }
 }
+
+TEST(libdebug_ProcessContext, test_seize_attach) {
+    using namespace std::chrono_literals;
+    const auto child_pid = ::fork();
+    if (child_pid == 0) {
+        ::personality(ADDR_NO_RANDOMIZE);
+        ::execl(SAMPLE_MULTITHREAD_FILE, SAMPLE_MULTITHREAD_FILE, nullptr);
+    } else {
+        sleep(1);
+        auto process_context = libdebug::ProcessContext {child_pid};
+        ASSERT_GT(process_context.get_attach_latency().count(), 0);
+
+        // Every seized thread reports the interrupt stop
+        std::set<libdebug::platform::TaskId> stopped_threads {};
+        while(stopped_threads.size() < process_context.get_threads().size()) {
+            const auto signal = process_context.wait_for_signal(5s);
+            ASSERT_FALSE(signal.is_error());
+            ASSERT_TRUE(signal.get().has_value());
+            ASSERT_EQ(signal.get()->get_signal_info().si_signo, SIGTRAP);
+            stopped_threads.insert(signal.get()->get_thread()->get_thread_id());
+        }
+        ASSERT_EQ(stopped_threads.size(), 2);
+        ::kill(child_pid, SIGKILL);
+    }
+}
+
+TEST(libdebug_ProcessContext, test_wait_for_signal) {
+    using namespace std::chrono_literals;
+    auto process_context = libdebug::ProcessContext {SAMPLE_SINGLETHREAD_FILE, {}};
+
+    // The child stops with SIGTRAP after exec
+    const auto signal = process_context.wait_for_signal(5s);
+    ASSERT_FALSE(signal.is_error());
+    ASSERT_TRUE(signal.get().has_value());
+    ASSERT_EQ(signal.get()->get_thread()->get_thread_id(), process_context.get_process_id());
+    ASSERT_EQ(signal.get()->get_signal_info().si_signo, SIGTRAP);
+
+    // The child is stopped, so the wait must time out
+    const auto timed_out_signal = process_context.wait_for_signal(50ms);
+    ASSERT_FALSE(timed_out_signal.is_error());
+    ASSERT_FALSE(timed_out_signal.get().has_value());
+    ::kill(process_context.get_process_id(), SIGKILL);
+}
+
+TEST(libdebug_ProcessContext, test_wait_ignores_other_children) {
+    using namespace std::chrono_literals;
+    auto process_context = libdebug::ProcessContext {SAMPLE_SINGLETHREAD_FILE, {}};
+    const auto other_child_pid = ::fork();
+    if (other_child_pid == 0) {
+        ::_exit(42);
+    }
+
+    // The exit of the other child is neither reported nor reaped by the debugger
+    const auto signal = process_context.wait_for_signal(5s);
+    ASSERT_FALSE(signal.is_error());
+    ASSERT_TRUE(signal.get().has_value());
+    ASSERT_EQ(signal.get()->get_thread()->get_thread_id(), process_context.get_process_id());
+
+    int status = 0;
+    ASSERT_EQ(::waitpid(other_child_pid, &status, 0), other_child_pid);
+    ASSERT_TRUE(WIFEXITED(status));
+    ASSERT_EQ(WEXITSTATUS(status), 42);
+    ::kill(process_context.get_process_id(), SIGKILL);
+}
+
+TEST(libdebug_ProcessContext, test_exit_signal) {
+    using namespace std::chrono_literals;
+    auto process_context = libdebug::ProcessContext {SAMPLE_SINGLETHREAD_FILE, {}};
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+
+    // The exit is reported with its status instead of a signal
+    ::kill(process_context.get_process_id(), SIGKILL);
+    const auto signal = process_context.wait_for_signal(5s);
+    ASSERT_FALSE(signal.is_error());
+    ASSERT_TRUE(signal.get().has_value());
+    ASSERT_TRUE(signal.get()->is_exit());
+    ASSERT_EQ(signal.get()->get_signal_info().si_signo, 0);
+    ASSERT_TRUE(WIFSIGNALED(*signal.get()->get_exit_status()));
+    ASSERT_EQ(WTERMSIG(*signal.get()->get_exit_status()), SIGKILL);
+}
+
+TEST(libdebug_ProcessContext, test_read_write_memory) {
+    using namespace std::chrono_literals;
+    auto process_context = libdebug::ProcessContext {SAMPLE_SINGLETHREAD_FILE, {}};
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+
+    // The sample is linked without PIE, so the ELF header is mapped at the default base address
+    constexpr std::intptr_t base_address = 0x400000;
+    std::array<kstd::u8, 4> magic {};
+    std::array<kstd::u8, 2> elf_class {};
+    const std::array<libdebug::MemoryReadRequest, 2> requests {{{base_address, magic}, {base_address + 4, elf_class}}};
+    ASSERT_FALSE(process_context.read_memory(requests).is_error());
+    ASSERT_EQ(magic, (std::array<kstd::u8, 4> {0x7F, 'E', 'L', 'F'}));
+    ASSERT_EQ(elf_class[0], 2);
+
+    // The header page is read-only, so the write has to fall back to /proc/pid/mem
+    const std::array<kstd::u8, 2> patch {0xAB, 0xCD};
+    ASSERT_FALSE(process_context.write_memory(base_address + 8, patch).is_error());
+    std::array<kstd::u8, 2> patched {};
+    ASSERT_FALSE(process_context.read_memory(base_address + 8, patched).is_error());
+    ASSERT_EQ(patched, patch);
+    ::kill(process_context.get_process_id(), SIGKILL);
+}
+
+TEST(libdebug_ProcessContext, test_memory_cache) {
+    using namespace std::chrono_literals;
+    auto process_context = libdebug::ProcessContext {SAMPLE_SINGLETHREAD_FILE, {}};
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+
+    // The first read misses, all following reads of the same page are hits
+    constexpr std::intptr_t base_address = 0x400000;
+    std::array<kstd::u8, 8> data {};
+    ASSERT_FALSE(process_context.read_memory(base_address, data).is_error());
+    ASSERT_FALSE(process_context.read_memory(base_address + 16, data).is_error());
+    ASSERT_EQ(process_context.get_memory_cache().get_miss_count(), 1);
+    ASSERT_EQ(process_context.get_memory_cache().get_hit_count(), 1);
+
+    // Writes invalidate the written page and are visible to following reads
+    const std::array<kstd::u8, 1> patch {0xAB};
+    ASSERT_FALSE(process_context.write_memory(base_address + 16, patch).is_error());
+    ASSERT_EQ(process_context.get_memory_cache().get_page_count(), 0);
+    ASSERT_FALSE(process_context.read_memory(base_address + 16, data).is_error());
+    ASSERT_EQ(data[0], 0xAB);
+    ASSERT_EQ(process_context.get_memory_cache().get_miss_count(), 2);
+    ::kill(process_context.get_process_id(), SIGKILL);
+}
+
+TEST(libdebug_ProcessContext, test_add_remove_breakpoints) {
+    using namespace std::chrono_literals;
+    auto process_context = libdebug::ProcessContext {SAMPLE_SINGLETHREAD_FILE, {}};
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+
+    // Read entry point from ELF header
+    std::intptr_t entry_address = 0;
+    ASSERT_FALSE(process_context.read_memory(0x400018, {reinterpret_cast<kstd::u8*>(&entry_address), 8}).is_error());
+    std::array<kstd::u8, 4> original {};
+    ASSERT_FALSE(process_context.read_memory(entry_address, original).is_error());
+
+    // Add breakpoints, the unmapped address and the duplicate must fail
+    const std::array<std::intptr_t, 4> addresses {entry_address + 2, entry_address, 0x10, entry_address};
+    const auto add_results = process_context.add_breakpoints(addresses);
+    ASSERT_FALSE(add_results[0].is_error());
+    ASSERT_FALSE(add_results[1].is_error());
+    ASSERT_TRUE(add_results[2].is_error());
+    ASSERT_TRUE(add_results[3].is_error());
+    ASSERT_EQ(process_context.get_breakpoints().size(), 2);
+
+    std::array<kstd::u8, 4> patched {};
+    ASSERT_FALSE(process_context.read_memory(entry_address, patched).is_error());
+    ASSERT_EQ(patched, (std::array<kstd::u8, 4> {0xCC, original[1], 0xCC, original[3]}));
+
+    // Remove breakpoints, the original bytes must be restored
+    const std::array<std::intptr_t, 2> removed_addresses {entry_address, entry_address + 2};
+    for(const auto& result : process_context.remove_breakpoints(removed_addresses)) {
+        ASSERT_FALSE(result.is_error());
+    }
+    ASSERT_FALSE(process_context.read_memory(entry_address, patched).is_error());
+    ASSERT_EQ(patched, original);
+    ASSERT_TRUE(process_context.get_breakpoints().empty());
+    ::kill(process_context.get_process_id(), SIGKILL);
+}
+
+TEST(libdebug_ProcessContext, test_multi_thread_breakpoint) {
+    const auto child_pid = ::fork();
+    if(child_pid == 0) {
+        ::personality(ADDR_NO_RANDOMIZE);
+        ::execl(SAMPLE_MULTITHREAD_FILE, SAMPLE_MULTITHREAD_FILE, nullptr);
+    }
+    else {
+        sleep(1);
+        auto process_context = libdebug::ProcessContext {child_pid};
+        ASSERT_EQ(process_context.get_threads().size(), 2);
+
+        // The breakpoint is patched once for the address space, so the original byte survives the removal
+        std::intptr_t entry_address = 0;
+        ASSERT_FALSE(
+                process_context.read_memory(0x400018, {reinterpret_cast<kstd::u8*>(&entry_address), 8}).is_error());
+        kstd::u8 original = 0;
+        ASSERT_FALSE(process_context.read_memory(entry_address, {&original, 1}).is_error());
+        ASSERT_FALSE(process_context.add_breakpoint(entry_address).is_error());
+        ASSERT_TRUE(process_context.get_breakpoints().at(entry_address).is_enabled());
+
+        kstd::u8 data = 0;
+        ASSERT_FALSE(process_context.read_memory(entry_address, {&data, 1}).is_error());
+        ASSERT_EQ(data, libdebug::Breakpoint::interrupt_instruction);
+        ASSERT_FALSE(process_context.remove_breakpoint(entry_address).is_error());
+        ASSERT_FALSE(process_context.read_memory(entry_address, {&data, 1}).is_error());
+        ASSERT_EQ(data, original);
+        ::kill(child_pid, SIGKILL);
+    }
+}
+
+TEST(libdebug_ProcessContext, test_step_over_breakpoint) {
+    using namespace std::chrono_literals;
+    auto process_context = libdebug::ProcessContext {SAMPLE_SINGLETHREAD_FILE, {}};
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+    const auto thread_id = process_context.get_process_id();
+
+    // Add breakpoints at the entry point and the following instruction
+    std::intptr_t entry_address = 0;
+    ASSERT_FALSE(process_context.read_memory(0x400018, {reinterpret_cast<kstd::u8*>(&entry_address), 8}).is_error());
+    std::array<kstd::u8, libdebug::arch::max_instruction_size> code {};
+    ASSERT_FALSE(process_context.read_memory(entry_address, code).is_error());
+    const auto instruction = libdebug::arch::decode_instruction(code);
+    ASSERT_FALSE(instruction.is_error());
+    const auto next_address = entry_address + static_cast<std::intptr_t>(instruction.get().size);
+    const std::array<std::intptr_t, 2> addresses {entry_address, next_address};
+    for(const auto& result : process_context.add_breakpoints(addresses)) {
+        ASSERT_FALSE(result.is_error());
+    }
+
+    // Both breakpoints are hit in order, the first one is stepped over out-of-line
+    for(const auto address : addresses) {
+        ASSERT_FALSE(process_context.resume_thread(thread_id).is_error());
+        const auto signal = process_context.wait_for_signal(5s);
+        ASSERT_FALSE(signal.is_error());
+        ASSERT_TRUE(signal.get().has_value());
+        ASSERT_TRUE(signal.get()->is_breakpoint());
+        ASSERT_EQ(signal.get()->get_thread()->get_breakpoint_address(), address);
+
+        kstd::u8 data = 0;
+        ASSERT_FALSE(process_context.read_memory(entry_address, {&data, 1}).is_error());
+        ASSERT_EQ(data, libdebug::Breakpoint::interrupt_instruction);
+    }
+
+    // The process runs into its endless loop without crashing
+    ASSERT_FALSE(process_context.resume_thread(thread_id).is_error());
+    const auto signal = process_context.wait_for_signal(100ms);
+    ASSERT_FALSE(signal.is_error());
+    ASSERT_FALSE(signal.get().has_value());
+    ::kill(process_context.get_process_id(), SIGKILL);
+}
+
+TEST(libdebug_ProcessContext, test_step_over_far_breakpoints) {
+    using namespace std::chrono_literals;
+    auto process_context = libdebug::ProcessContext {SAMPLE_SINGLETHREAD_FILE, {}};
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+    const auto thread_id = process_context.get_process_id();
+    const auto main_address = process_context.get_symbols().get()->find_address("main");
+    ASSERT_TRUE(main_address.has_value());
+    ASSERT_FALSE(process_context.add_breakpoint(*main_address).is_error());
+    ASSERT_FALSE(process_context.resume_thread(thread_id).is_error());
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+
+    // The printf function of libc is mapped far away from the executable
+    std::optional<std::intptr_t> printf_address {};
+    const auto* memory_map = process_context.get_memory_map().get();
+    for(std::size_t index = 0; index < memory_map->size(); ++index) {
+        const auto region = memory_map->get_region(index);
+        if(region.path.find("/libc.so") == std::string_view::npos) {
+            continue;
+        }
+
+        libdebug::SymbolTable symbols {std::filesystem::path {region.path}};
+        symbols.set_load_bias(region.begin - static_cast<std::intptr_t>(region.offset) - symbols.get_base_address());
+        printf_address = symbols.find_address("printf");
+        break;
+    }
+    ASSERT_TRUE(printf_address.has_value());
+    ASSERT_GT(std::abs(*printf_address - *main_address), libdebug::ScratchPage::reach);
+    ASSERT_FALSE(process_context.add_breakpoint(*printf_address).is_error());
+    ASSERT_FALSE(process_context.resume_thread(thread_id).is_error());
+    const auto signal = process_context.wait_for_signal(5s);
+    ASSERT_TRUE(signal.get().has_value());
+    ASSERT_EQ(signal.get()->get_thread()->get_breakpoint_address(), *printf_address);
+    ASSERT_FALSE(process_context.resume_thread(thread_id).is_error());
+    ASSERT_FALSE(process_context.wait_for_signal(100ms).get().has_value());
+
+    // Each breakpoint was stepped over in a scratch page in its reach
+    memory_map = process_context.get_memory_map().get();
+    for(const auto address : {*main_address, *printf_address}) {
+        auto has_scratch_page = false;
+        for(std::size_t index = 0; index < memory_map->size(); ++index) {
+            const auto region = memory_map->get_region(index);
+            has_scratch_page |= region.path.empty() && region.has_permission(libdebug::MemoryPermission::EXECUTE) &&
+                                !region.has_permission(libdebug::MemoryPermission::WRITE) &&
+                                std::abs(region.begin - libdebug::MemoryCache::get_page_address(address)) <=
+                                        libdebug::ScratchPage::reach;
+        }
+        ASSERT_TRUE(has_scratch_page);
+    }
+    ::kill(process_context.get_process_id(), SIGKILL);
+}
+
+TEST(libdebug_ProcessContext, test_registers) {
+    using namespace std::chrono_literals;
+    auto process_context = libdebug::ProcessContext {SAMPLE_SINGLETHREAD_FILE, {}};
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+    const auto thread_id = process_context.get_process_id();
+
+    // Add breakpoints at the entry point and the following instruction
+    std::intptr_t entry_address = 0;
+    ASSERT_FALSE(process_context.read_memory(0x400018, {reinterpret_cast<kstd::u8*>(&entry_address), 8}).is_error());
+    std::array<kstd::u8, libdebug::arch::max_instruction_size> code {};
+    ASSERT_FALSE(process_context.read_memory(entry_address, code).is_error());
+    const auto instruction = libdebug::arch::decode_instruction(code);
+    ASSERT_FALSE(instruction.is_error());
+    const auto next_address = entry_address + static_cast<std::intptr_t>(instruction.get().size);
+    const std::array<std::intptr_t, 2> addresses {entry_address, next_address};
+    for(const auto& result : process_context.add_breakpoints(addresses)) {
+        ASSERT_FALSE(result.is_error());
+    }
+
+    // The thread is rewound to the breakpoint when it's hit
+    ASSERT_FALSE(process_context.resume_thread(thread_id).is_error());
+    auto signal = process_context.wait_for_signal(5s);
+    ASSERT_FALSE(signal.is_error());
+    ASSERT_TRUE(signal.get().has_value());
+    auto* thread = signal.get()->get_thread();
+    ASSERT_EQ(thread->get_instruction_pointer().get(), entry_address);
+    ASSERT_NE(thread->get_stack_pointer().get(), 0);
+
+    // The changed instruction pointer is written back on resume, so the next breakpoint is hit without a step
+    ASSERT_FALSE(thread->set_instruction_pointer(next_address).is_error());
+    ASSERT_EQ(libdebug::arch::get_instruction_pointer(thread->get_registers().get()), next_address);
+    ASSERT_FALSE(process_context.resume_thread(thread_id).is_error());
+    signal = process_context.wait_for_signal(5s);
+    ASSERT_FALSE(signal.is_error());
+    ASSERT_TRUE(signal.get().has_value());
+    ASSERT_EQ(signal.get()->get_thread()->get_breakpoint_address(), next_address);
+    ASSERT_EQ(signal.get()->get_thread()->get_instruction_pointer().get(), next_address);
+    ::kill(process_context.get_process_id(), SIGKILL);
+}
+
+TEST(libdebug_ProcessContext, test_extended_state) {
+    using namespace std::chrono_literals;
+    auto process_context = libdebug::ProcessContext {SAMPLE_SINGLETHREAD_FILE, {}};
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+    const auto thread_id = process_context.get_process_id();
+    auto& thread = process_context.get_threads().at(thread_id);
+    ASSERT_FALSE(thread.get_extended_state_components().is_error());
+    ASSERT_FALSE(thread.get_x87_register(0).is_error());
+    ASSERT_TRUE(thread.get_x87_register(8).is_error());
+
+    // The modified register is read from the cache until it's written back by the step
+    std::array<kstd::u8, 16> value {};
+    std::iota(value.begin(), value.end(), 1);
+    ASSERT_FALSE(thread.set_vector_register(0, value).is_error());
+    ASSERT_TRUE(std::equal(value.cbegin(), value.cend(), thread.get_vector_register(0).get().cbegin()));
+    ASSERT_FALSE(process_context.step_thread(thread_id).is_error());
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+    ASSERT_TRUE(std::equal(value.cbegin(), value.cend(), thread.get_vector_register(0).get().cbegin()));
+    ::kill(process_context.get_process_id(), SIGKILL);
+}
+
+TEST(libdebug_ProcessContext, test_hardware_breakpoint) {
+    using namespace std::chrono_literals;
+    auto process_context = libdebug::ProcessContext {SAMPLE_SINGLETHREAD_FILE, {}};
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+    const auto thread_id = process_context.get_process_id();
+
+    // Misaligned watchpoints and wide execute breakpoints are rejected
+    std::intptr_t entry_address = 0;
+    ASSERT_FALSE(process_context.read_memory(0x400018, {reinterpret_cast<kstd::u8*>(&entry_address), 8}).is_error());
+    using libdebug::HardwareBreakpointType;
+    ASSERT_TRUE(process_context.add_hardware_breakpoint({entry_address | 1, HardwareBreakpointType::WRITE, 8})
+                        .is_error());
+    ASSERT_TRUE(process_context.add_hardware_breakpoint({entry_address, HardwareBreakpointType::EXECUTE, 4})
+                        .is_error());
+
+    // The breakpoint is reported with its slot, the memory stays untouched
+    std::array<kstd::u8, libdebug::arch::max_instruction_size> code {};
+    ASSERT_FALSE(process_context.read_memory(entry_address, code).is_error());
+    const auto next_address = entry_address + static_cast<std::intptr_t>(
+                                                      libdebug::arch::decode_instruction(code).get().size);
+    const auto slot = process_context.add_hardware_breakpoint({next_address, HardwareBreakpointType::EXECUTE, 1});
+    ASSERT_FALSE(slot.is_error());
+    ASSERT_TRUE(process_context.get_threads().at(thread_id).get_hardware_breakpoints()[slot.get()].has_value());
+
+    ASSERT_FALSE(process_context.resume_thread(thread_id).is_error());
+    const auto signal = process_context.wait_for_signal(5s);
+    ASSERT_FALSE(signal.is_error());
+    ASSERT_TRUE(signal.get().has_value());
+    ASSERT_TRUE(signal.get()->is_breakpoint());
+    ASSERT_EQ(signal.get()->get_hardware_breakpoint_slot(), slot.get());
+    std::array<kstd::u8, libdebug::arch::max_instruction_size> current_code {};
+    ASSERT_FALSE(process_context.read_memory(entry_address, current_code).is_error());
+    ASSERT_EQ(code, current_code);
+
+    // Removed breakpoints are cleared in the threads
+    const auto watchpoint = process_context.add_hardware_breakpoint({0x400000, HardwareBreakpointType::WRITE, 8});
+    ASSERT_FALSE(watchpoint.is_error());
+    ASSERT_NE(watchpoint.get(), slot.get());
+    ASSERT_FALSE(process_context.remove_hardware_breakpoint(watchpoint.get()).is_error());
+    ASSERT_FALSE(process_context.get_threads().at(thread_id).get_hardware_breakpoints()[watchpoint.get()].has_value());
+
+    // The breakpoint doesn't trigger again when resuming from it
+    ASSERT_FALSE(process_context.resume_thread(thread_id).is_error());
+    ASSERT_FALSE(process_context.wait_for_signal(100ms).get().has_value());
+    ::kill(process_context.get_process_id(), SIGKILL);
+}
+
+TEST(libdebug_ProcessContext, test_step_over_breakpoint_traps) {
+    using namespace std::chrono_literals;
+    auto process_context = libdebug::ProcessContext {SAMPLE_SINGLETHREAD_FILE, {}};
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+    const auto thread_id = process_context.get_process_id();
+
+    // Replace the entry point with a push instruction and add breakpoints at it and the following instruction
+    std::intptr_t entry_address = 0;
+    ASSERT_FALSE(process_context.read_memory(0x400018, {reinterpret_cast<kstd::u8*>(&entry_address), 8}).is_error());
+    constexpr std::array<kstd::u8, 1> push_instruction {0x50};
+    ASSERT_FALSE(process_context.write_memory(entry_address, push_instruction).is_error());
+    const std::array<std::intptr_t, 2> addresses {entry_address, entry_address + 1};
+    for(const auto& result : process_context.add_breakpoints(addresses)) {
+        ASSERT_FALSE(result.is_error());
+    }
+
+    ASSERT_FALSE(process_context.resume_thread(thread_id).is_error());
+    auto signal = process_context.wait_for_signal(5s);
+    ASSERT_TRUE(signal.get().has_value());
+    ASSERT_EQ(signal.get()->get_thread()->get_breakpoint_address(), entry_address);
+
+    // The watchpoint hit by the stepped push is reported before the signal is delivered
+    const auto stack_pointer = signal.get()->get_thread()->get_stack_pointer().get();
+    const auto watchpoint = process_context.add_hardware_breakpoint(
+            {stack_pointer - 8, libdebug::HardwareBreakpointType::WRITE, 8});
+    ASSERT_FALSE(watchpoint.is_error());
+    ASSERT_FALSE(process_context.resume_thread(thread_id, SIGWINCH).is_error());
+    signal = process_context.wait_for_signal(5s);
+    ASSERT_TRUE(signal.get().has_value());
+    ASSERT_EQ(signal.get()->get_hardware_breakpoint_slot(), watchpoint.get());
+    ASSERT_EQ(signal.get()->get_thread()->get_instruction_pointer().get(), entry_address + 1);
+    ASSERT_FALSE(process_context.remove_hardware_breakpoint(watchpoint.get()).is_error());
+
+    // The signal is delivered after the step, so the next breakpoint is hit instead of the stepped one
+    ASSERT_FALSE(process_context.resume_thread(thread_id).is_error());
+    signal = process_context.wait_for_signal(5s);
+    ASSERT_TRUE(signal.get().has_value());
+    ASSERT_EQ(signal.get()->get_signal_info().si_signo, SIGWINCH);
+    ASSERT_FALSE(process_context.resume_thread(thread_id, SIGWINCH).is_error());
+    signal = process_context.wait_for_signal(5s);
+    ASSERT_TRUE(signal.get().has_value());
+    ASSERT_EQ(signal.get()->get_thread()->get_breakpoint_address(), entry_address + 1);
+    ::kill(process_context.get_process_id(), SIGKILL);
+}
+
+TEST(libdebug_ProcessContext, test_exec_restores_breakpoints) {
+    using namespace std::chrono_literals;
+    auto process_context = libdebug::ProcessContext {SAMPLE_REEXEC_FILE, {}};
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+    const auto thread_id = process_context.get_process_id();
+
+    const auto symbols = process_context.get_symbols();
+    ASSERT_FALSE(symbols.is_error());
+    const auto first_address = symbols.get()->find_address("first_call");
+    const auto second_address = symbols.get()->find_address("second_call");
+    ASSERT_TRUE(first_address.has_value());
+    ASSERT_TRUE(second_address.has_value());
+    ASSERT_FALSE(process_context.add_breakpoint(*first_address).is_error());
+    using libdebug::HardwareBreakpointType;
+    const auto slot = process_context.add_hardware_breakpoint({*second_address, HardwareBreakpointType::EXECUTE, 1});
+    ASSERT_FALSE(slot.is_error());
+
+    // The sample executes itself again, so the breakpoints are restored at the exec stop
+    ASSERT_FALSE(process_context.resume_thread(thread_id).is_error());
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+    ASSERT_TRUE(process_context.get_breakpoints().contains(*first_address));
+    ASSERT_TRUE(process_context.get_dropped_breakpoints().empty());
+
+    ASSERT_FALSE(process_context.resume_thread(thread_id).is_error());
+    const auto signal = process_context.wait_for_signal(5s);
+    ASSERT_TRUE(signal.get().has_value());
+    ASSERT_TRUE(signal.get()->is_breakpoint());
+    ASSERT_EQ(process_context.get_threads().at(thread_id).get_instruction_pointer().get(), *first_address);
+
+    ASSERT_FALSE(process_context.resume_thread(thread_id).is_error());
+    const auto hardware_signal = process_context.wait_for_signal(5s);
+    ASSERT_TRUE(hardware_signal.get().has_value());
+    ASSERT_EQ(hardware_signal.get()->get_hardware_breakpoint_slot(), slot.get());
+    ::kill(process_context.get_process_id(), SIGKILL);
+}
+
+TEST(libdebug_ProcessContext, test_breakpoints_survive_children) {
+    using namespace std::chrono_literals;
+    auto process_context = libdebug::ProcessContext {SAMPLE_SPAWN_FILE, {}};
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+    const auto address = process_context.get_symbols().get()->find_address("hot");
+    ASSERT_TRUE(address.has_value());
+    ASSERT_FALSE(process_context.add_breakpoint(*address).is_error());
+
+    // The vfork child shares the breakpoints, the fork child gets the original code, so only the process traps
+    std::size_t hit_count = 0;
+    std::optional<std::intptr_t> execve_address {};
+    ASSERT_FALSE(process_context.resume_thread(process_context.get_process_id()).is_error());
+    while(true) {
+        const auto signal = process_context.wait_for_signal(1s);
+        ASSERT_FALSE(signal.is_error());
+        if(!signal.get().has_value()) {
+            break;
+        }
+
+        const auto thread_id = signal.get()->get_thread()->get_thread_id();
+        const auto is_breakpoint = signal.get()->is_breakpoint();
+        hit_count += is_breakpoint ? 1 : 0;
+
+        // The vfork child runs execve of libc, so it is stepped over the tracepoint instead of dying at the trap
+        if(is_breakpoint && !execve_address.has_value()) {
+            const auto* memory_map = process_context.get_memory_map().get();
+            for(std::size_t index = 0; index < memory_map->size(); ++index) {
+                const auto region = memory_map->get_region(index);
+                if(region.path.find("/libc.so") == std::string_view::npos) {
+                    continue;
+                }
+
+                libdebug::SymbolTable symbols {std::filesystem::path {region.path}};
+                symbols.set_load_bias(region.begin - static_cast<std::intptr_t>(region.offset) -
+                                      symbols.get_base_address());
+                execve_address = symbols.find_address("execve");
+                break;
+            }
+            ASSERT_TRUE(execve_address.has_value());
+            ASSERT_FALSE(process_context.add_tracepoint(*execve_address).is_error());
+        }
+
+        const auto delivered_signal = is_breakpoint ? 0 : signal.get()->get_signal_info().si_signo;
+        ASSERT_FALSE(process_context.resume_thread(thread_id, delivered_signal).is_error());
+    }
+
+    ASSERT_EQ(hit_count, 3);
+    ASSERT_EQ(process_context.get_tracepoints().at(*execve_address).hit_count, 1);
+    ASSERT_TRUE(process_context.get_child_threads().empty());
+    ::kill(process_context.get_process_id(), SIGKILL);
+}
+
+TEST(libdebug_ProcessContext, test_thread_lifecycle) {
+    using namespace std::chrono_literals;
+    auto process_context = libdebug::ProcessContext {SAMPLE_THREADCHURN_FILE, {}};
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+
+    std::map<kstd::u8, std::size_t> event_counts {};
+    process_context.add_event_callback(
+            [](const libdebug::ProcessEvent& event, void* data) {
+                ++(*static_cast<std::map<kstd::u8, std::size_t>*>(data))[event.event_type];
+            },
+            &event_counts);
+
+    // The lifecycle stops are handled while waiting, only the SIGCHLD of the forked child is reported
+    ASSERT_FALSE(process_context.resume_thread(process_context.get_process_id()).is_error());
+    while(true) {
+        const auto signal = process_context.wait_for_signal(1s);
+        ASSERT_FALSE(signal.is_error());
+        if(!signal.get().has_value()) {
+            break;
+        }
+
+        ASSERT_FALSE(signal.get()->is_exit());
+        ASSERT_EQ(signal.get()->get_signal_info().si_signo, SIGCHLD);
+        const auto thread_id = signal.get()->get_thread()->get_thread_id();
+        ASSERT_FALSE(process_context.resume_thread(thread_id, SIGCHLD).is_error());
+    }
+
+    ASSERT_EQ(event_counts[libdebug::ProcessEventType::CREATE_THREAD], 4);
+    ASSERT_EQ(event_counts[libdebug::ProcessEventType::DELETE_THREAD], 4);
+    ASSERT_EQ(event_counts[libdebug::ProcessEventType::CREATE_PROCESS], 1);
+    ASSERT_EQ(process_context.get_threads().size(), 1);
+    ::kill(process_context.get_process_id(), SIGKILL);
+}
+
+TEST(libdebug_ProcessContext, test_non_stop) {
+    using namespace std::chrono_literals;
+    auto process_context = libdebug::ProcessContext {SAMPLE_MULTITHREAD_FILE, {}};
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+    const auto main_thread_id = process_context.get_process_id();
+    ASSERT_TRUE(process_context.get_threads().at(main_thread_id).is_stopped());
+
+    // The creation of the second thread is handled while waiting
+    ASSERT_FALSE(process_context.resume_thread(main_thread_id).is_error());
+    ASSERT_TRUE(process_context.resume_thread(main_thread_id).is_error());
+    ASSERT_FALSE(process_context.wait_for_signal(500ms).get().has_value());
+    ASSERT_EQ(process_context.get_threads().size(), 2);
+    ASSERT_EQ(process_context.get_running_thread_count(), 2);
+
+    // Only the interrupted thread stops, the main thread keeps running
+    const auto thread_id = std::find_if(process_context.get_threads().begin(), process_context.get_threads().end(),
+                                        [&](const auto& thread) { return thread.first != main_thread_id; })
+                                   ->first;
+    ASSERT_FALSE(process_context.interrupt_thread(thread_id).is_error());
+    const auto signal = process_context.wait_for_signal(5s);
+    ASSERT_FALSE(signal.is_error());
+    ASSERT_TRUE(signal.get().has_value());
+    ASSERT_EQ(signal.get()->get_thread()->get_thread_id(), thread_id);
+    ASSERT_EQ(signal.get()->get_signal_info().si_signo, SIGSTOP);
+    ASSERT_EQ(process_context.get_threads().at(thread_id).get_state(), libdebug::ThreadState::STOPPED);
+    ASSERT_EQ(process_context.get_threads().at(main_thread_id).get_state(), libdebug::ThreadState::RUNNING);
+    ASSERT_EQ(process_context.get_running_thread_count(), 1);
+    ASSERT_FALSE(process_context.get_threads().at(thread_id).get_registers().is_error());
+
+    // The interrupted thread is stepped and resumed on its own
+    ASSERT_FALSE(process_context.step_thread(thread_id).is_error());
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+    ASSERT_FALSE(process_context.resume_thread(thread_id).is_error());
+    ASSERT_EQ(process_context.get_running_thread_count(), 2);
+    ASSERT_FALSE(process_context.wait_for_signal(100ms).get().has_value());
+    ::kill(process_context.get_process_id(), SIGKILL);
+}
+
+TEST(libdebug_ProcessContext, test_non_stop_hardware_breakpoint) {
+    using namespace std::chrono_literals;
+    auto process_context = libdebug::ProcessContext {SAMPLE_MULTITHREAD_FILE, {}};
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+    const auto main_thread_id = process_context.get_process_id();
+    ASSERT_FALSE(process_context.resume_thread(main_thread_id).is_error());
+    ASSERT_FALSE(process_context.wait_for_signal(500ms).get().has_value());
+    const auto thread_id = std::find_if(process_context.get_threads().begin(), process_context.get_threads().end(),
+                                        [&](const auto& thread) { return thread.first != main_thread_id; })
+                                   ->first;
+    ASSERT_FALSE(process_context.interrupt_thread(thread_id).is_error());
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+
+    // The running main thread gets the breakpoint at its next stop
+    using libdebug::HardwareBreakpointType;
+    const auto& threads = process_context.get_threads();
+    const auto slot = process_context.add_hardware_breakpoint({0x400000, HardwareBreakpointType::WRITE, 8});
+    ASSERT_FALSE(slot.is_error());
+    ASSERT_TRUE(threads.at(thread_id).get_hardware_breakpoints()[slot.get()].has_value());
+    ASSERT_FALSE(threads.at(main_thread_id).get_hardware_breakpoints()[slot.get()].has_value());
+    ASSERT_FALSE(process_context.interrupt_thread(main_thread_id).is_error());
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+    ASSERT_TRUE(threads.at(main_thread_id).get_hardware_breakpoints()[slot.get()].has_value());
+
+    // The slot of a removed breakpoint stays in use until the running main thread cleared it at its next stop
+    ASSERT_FALSE(process_context.resume_thread(main_thread_id).is_error());
+    ASSERT_FALSE(process_context.remove_hardware_breakpoint(slot.get()).is_error());
+    ASSERT_FALSE(threads.at(thread_id).get_hardware_breakpoints()[slot.get()].has_value());
+    ASSERT_TRUE(threads.at(main_thread_id).get_hardware_breakpoints()[slot.get()].has_value());
+    const auto other_slot = process_context.add_hardware_breakpoint({0x400008, HardwareBreakpointType::WRITE, 8});
+    ASSERT_FALSE(other_slot.is_error());
+    ASSERT_NE(other_slot.get(), slot.get());
+
+    ASSERT_FALSE(process_context.interrupt_thread(main_thread_id).is_error());
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+    ASSERT_FALSE(threads.at(main_thread_id).get_hardware_breakpoints()[slot.get()].has_value());
+    ASSERT_TRUE(threads.at(main_thread_id).get_hardware_breakpoints()[other_slot.get()].has_value());
+    ::kill(process_context.get_process_id(), SIGKILL);
+}
+
+TEST(libdebug_ProcessContext, test_syscall_tracing) {
+    using namespace std::chrono_literals;
+    auto process_context = libdebug::ProcessContext {SAMPLE_SINGLETHREAD_FILE, {}, {SYS_getpid, SYS_gettid}};
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+    ASSERT_EQ(process_context.get_traced_syscalls().size(), 2);
+
+    std::vector<libdebug::ProcessEvent> events {};
+    process_context.add_event_callback(
+            [](const libdebug::ProcessEvent& event, void* data) {
+                static_cast<std::vector<libdebug::ProcessEvent>*>(data)->push_back(event);
+            },
+            &events);
+
+    // Only the selected syscalls stop the process, the stops are handled while waiting
+    ASSERT_FALSE(process_context.resume_thread(process_context.get_process_id()).is_error());
+    ASSERT_FALSE(process_context.wait_for_signal(500ms).get().has_value());
+    ASSERT_EQ(events.size(), 4);
+    const auto process_id = static_cast<kstd::i64>(process_context.get_process_id());
+    for(std::size_t index = 0; index < events.size(); ++index) {
+        const auto& event = events[index];
+        const auto expected_type = index % 2 == 0 ? libdebug::ProcessEventType::SYSCALL_ENTER
+                                                  : libdebug::ProcessEventType::SYSCALL_EXIT;
+        ASSERT_EQ(event.event_type, expected_type);
+        ASSERT_EQ(event.syscall_event.thread_id, process_context.get_process_id());
+        ASSERT_EQ(event.syscall_event.number, index < 2 ? SYS_gettid : SYS_getpid);
+        if(event.event_type == libdebug::ProcessEventType::SYSCALL_EXIT) {
+            ASSERT_EQ(event.syscall_event.return_value, process_id);
+        }
+    }
+    ::kill(process_context.get_process_id(), SIGKILL);
+}
+
+TEST(libdebug_ProcessContext, test_syscall_tracing_forked_child) {
+    using namespace std::chrono_literals;
+    auto process_context = libdebug::ProcessContext {SAMPLE_THREADCHURN_FILE, {}, {SYS_exit_group}};
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+
+    std::vector<libdebug::ProcessEvent> events {};
+    process_context.add_event_callback(
+            [](const libdebug::ProcessEvent& event, void* data) {
+                static_cast<std::vector<libdebug::ProcessEvent>*>(data)->push_back(event);
+            },
+            &events);
+
+    // The forked child inherits the filter, so it stays traced and its exit is reported instead of failing
+    ASSERT_FALSE(process_context.resume_thread(process_context.get_process_id()).is_error());
+    ASSERT_FALSE(process_context.wait_for_signal(1s).get().has_value());
+    const auto syscall_event = std::find_if(events.begin(), events.end(), [](const auto& event) {
+        return event.event_type == libdebug::ProcessEventType::SYSCALL_ENTER;
+    });
+    ASSERT_NE(syscall_event, events.end());
+    ASSERT_NE(syscall_event->syscall_event.process_id, process_context.get_process_id());
+    ASSERT_EQ(syscall_event->syscall_event.thread_id, syscall_event->syscall_event.process_id);
+    ASSERT_EQ(syscall_event->syscall_event.number, SYS_exit_group);
+    ASSERT_TRUE(process_context.get_child_threads().empty());
+    ::kill(process_context.get_process_id(), SIGKILL);
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include <gtest/gtest.h>
+#include <libdebug/profiler.hpp>
+#include <sstream>
+#include <sys/personality.h>
+
+TEST(libdebug_Profiler, test_profile_attached_process) {
+    using namespace std::chrono_literals;
+    const auto child_pid = ::fork();
+    if (child_pid == 0) {
+        ::personality(ADDR_NO_RANDOMIZE);
+        ::execl(SAMPLE_MULTITHREAD_FILE, SAMPLE_MULTITHREAD_FILE, nullptr);
+    } else {
+        sleep(1);
+        auto process_context = libdebug::ProcessContext {child_pid};
+        auto profiler = libdebug::Profiler {process_context};
+        ASSERT_FALSE(profiler.run(1ms, 300ms).is_error());
+        ASSERT_GT(profiler.get_sample_count(), 50);
+        ASSERT_GT(profiler.get_sample_overhead().count(), 0);
+
+        // The second thread spins in print_tid, which is called by the thread entry of the standard library
+        std::stringstream folded_stacks {};
+        profiler.write_folded(folded_stacks);
+        auto print_tid_samples = 0UL;
+        auto join_samples = 0UL;
+        for(std::string line {}; std::getline(folded_stacks, line);) {
+            if(line.find("print_tid") != std::string::npos) {
+                print_tid_samples += std::stoul(line.substr(line.rfind(' ') + 1));
+            }
+
+            // The main thread waits in the join of the standard library, which is symbolized with its own symbols
+            if(line.find("_ZNSt6thread4joinEv") != std::string::npos) {
+                join_samples += std::stoul(line.substr(line.rfind(' ') + 1));
+            }
+        }
+        ASSERT_EQ(print_tid_samples, profiler.get_sample_count());
+        ASSERT_EQ(join_samples, profiler.get_sample_count());
+        ::kill(child_pid, SIGKILL);
+    }
+}
\ No newline at end of file
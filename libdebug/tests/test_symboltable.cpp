@@ -0,0 +1,79 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <libdebug/process.hpp>
+#include <libdebug/symbols.hpp>
+
+TEST(libdebug_SymbolTable, test_find_symbol) {
+    libdebug::SymbolTable symbols {SAMPLE_SINGLETHREAD_FILE};
+    ASSERT_GT(symbols.size(), 0);
+    ASSERT_FALSE(symbols.find_address("not_a_symbol").has_value());
+
+    // The name and the address index resolve each other
+    const auto address = symbols.find_address("main");
+    ASSERT_TRUE(address.has_value());
+    const auto symbol = symbols.find_symbol(*address);
+    ASSERT_TRUE(symbol.has_value());
+    ASSERT_EQ(symbol->name, "main");
+    ASSERT_EQ(symbols.find_symbol(*address + static_cast<std::intptr_t>(symbol->size) - 1)->name, "main");
+
+    symbols.set_load_bias(0x1000);
+    ASSERT_EQ(symbols.find_address("main"), *address + 0x1000);
+    ASSERT_EQ(symbols.find_symbol(*address + 0x1000)->name, "main");
+    ASSERT_THROW(libdebug::SymbolTable {"/nonexistent"}, std::runtime_error);
+}
+
+TEST(libdebug_SymbolTable, test_symbol_breakpoint) {
+    using namespace std::chrono_literals;
+    auto process_context = libdebug::ProcessContext {SAMPLE_SINGLETHREAD_FILE, {}};
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+    ASSERT_TRUE(process_context.add_breakpoint("not_a_symbol").is_error());
+    ASSERT_FALSE(process_context.add_breakpoint("main").is_error());
+
+    ASSERT_FALSE(process_context.resume_thread(process_context.get_process_id()).is_error());
+    const auto signal = process_context.wait_for_signal(5s);
+    ASSERT_FALSE(signal.is_error());
+    ASSERT_TRUE(signal.get().has_value());
+    ASSERT_TRUE(signal.get()->is_breakpoint());
+    const auto address = signal.get()->get_thread()->get_breakpoint_address();
+    ASSERT_TRUE(address.has_value());
+    ASSERT_EQ(process_context.get_symbols().get()->find_symbol(*address)->name, "main");
+    ::kill(process_context.get_process_id(), SIGKILL);
+}
+
+TEST(libdebug_SymbolTable, test_symbol_cache) {
+    const auto cache_directory = std::filesystem::temp_directory_path() / "libdebug-symbol-cache";
+    std::filesystem::remove_all(cache_directory);
+
+    // The first symbol table creates the cache file, the second one is loaded from it
+    const auto address = libdebug::SymbolTable {SAMPLE_SINGLETHREAD_FILE, cache_directory}.find_address("main");
+    ASSERT_TRUE(address.has_value());
+    ASSERT_FALSE(std::filesystem::is_empty(cache_directory));
+
+    libdebug::SymbolTable symbols {SAMPLE_SINGLETHREAD_FILE, cache_directory};
+    ASSERT_EQ(symbols.size(), libdebug::SymbolTable {SAMPLE_SINGLETHREAD_FILE}.size());
+    ASSERT_EQ(symbols.find_address("main"), address);
+    ASSERT_EQ(symbols.find_symbol(*address)->name, "main");
+    ASSERT_FALSE(symbols.find_address("not_a_symbol").has_value());
+
+    // A damaged cache file is ignored
+    for(const auto& entry : std::filesystem::directory_iterator {cache_directory}) {
+        std::ofstream {entry.path(), std::ios::binary | std::ios::trunc} << "damaged";
+    }
+    ASSERT_EQ(libdebug::SymbolTable(SAMPLE_SINGLETHREAD_FILE, cache_directory).find_address("main"), address);
+    std::filesystem::remove_all(cache_directory);
+}
\ No newline at end of file
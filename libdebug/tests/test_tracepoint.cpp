@@ -0,0 +1,67 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include <array>
+#include <gtest/gtest.h>
+#include <libdebug/process.hpp>
+#include <libdebug/tracepoint.hpp>
+
+TEST(libdebug_TraceBuffer, test_push_drop) {
+    libdebug::TraceBuffer buffer {2};
+    ASSERT_EQ(buffer.get_capacity(), 2);
+    ASSERT_TRUE(buffer.push({1, 0x1000, 1, {}}));
+    ASSERT_TRUE(buffer.push({2, 0x1000, 1, {}}));
+    ASSERT_FALSE(buffer.push({3, 0x1000, 1, {}}));
+    ASSERT_EQ(buffer.size(), 2);
+    ASSERT_EQ(buffer.get_dropped_count(), 1);
+    ASSERT_EQ(buffer.get_records()[1].timestamp, 2);
+
+    buffer.clear();
+    ASSERT_EQ(buffer.size(), 0);
+    ASSERT_EQ(buffer.get_dropped_count(), 0);
+    ASSERT_EQ(buffer.get_capacity(), 2);
+}
+
+TEST(libdebug_TraceBuffer, test_tracepoint_budget) {
+    using namespace std::chrono_literals;
+    auto process_context = libdebug::ProcessContext {SAMPLE_BACKTRACE_FILE, {}};
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+    const auto address = process_context.get_symbols().get()->find_address("backtrace_leaf");
+    ASSERT_TRUE(address.has_value());
+
+    // The hits are recorded while waiting, no signal is reported
+    constexpr std::array registers {libdebug::TraceRegister::ARGUMENT_0, libdebug::TraceRegister::INSTRUCTION_POINTER};
+    ASSERT_FALSE(process_context.add_tracepoint(*address, registers, 5).is_error());
+    ASSERT_FALSE(process_context.resume_thread(process_context.get_process_id()).is_error());
+    ASSERT_FALSE(process_context.wait_for_signal(200ms).get().has_value());
+
+    // The breakpoint is disabled after the budget, so the leaf is called with consecutive values
+    const auto& tracepoint = process_context.get_tracepoints().at(*address);
+    ASSERT_EQ(tracepoint.hit_count, 5);
+    ASSERT_FALSE(process_context.get_breakpoints().at(*address).is_enabled());
+    const auto records = process_context.get_trace_buffer().get_records();
+    ASSERT_EQ(records.size(), 5);
+    for(std::size_t index = 0; index < records.size(); ++index) {
+        ASSERT_EQ(records[index].thread_id, process_context.get_process_id());
+        ASSERT_EQ(records[index].address, *address);
+        ASSERT_EQ(records[index].registers[0], records[0].registers[0] + index);
+        ASSERT_EQ(records[index].registers[1], static_cast<kstd::u64>(*address));
+        ASSERT_GE(records[index].timestamp, records[0].timestamp);
+    }
+
+    // Removing the breakpoint removes the tracepoint
+    ASSERT_FALSE(process_context.remove_breakpoint(*address).is_error());
+    ASSERT_TRUE(process_context.get_tracepoints().empty());
+    ::kill(process_context.get_process_id(), SIGKILL);
+}
\ No newline at end of file
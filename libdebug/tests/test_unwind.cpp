@@ -0,0 +1,65 @@
+//  Copyright 2026 Cach30verfl0w
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include <gtest/gtest.h>
+#include <libdebug/process.hpp>
+#include <libdebug/unwind.hpp>
+
+TEST(libdebug_CallFrameTable, test_find_row) {
+    libdebug::CallFrameTable table {SAMPLE_BACKTRACE_FILE};
+    ASSERT_GT(table.size(), 0);
+
+    // The return address is saved at the canonical frame address at the first instruction of every function
+    const auto address = libdebug::SymbolTable {SAMPLE_BACKTRACE_FILE}.find_address("backtrace_middle");
+    ASSERT_TRUE(address.has_value());
+    const auto row = table.find_row(static_cast<kstd::u64>(*address));
+    ASSERT_FALSE(row.is_error());
+    ASSERT_NE(row.get(), nullptr);
+    ASSERT_TRUE(row.get()->is_cfa_supported);
+    ASSERT_EQ(row.get()->cfa_register, libdebug::call_frame_stack_pointer);
+    ASSERT_EQ(row.get()->cfa_offset, 8);
+    ASSERT_EQ(row.get()->rules[libdebug::call_frame_return_address].type, libdebug::CallFrameRuleType::OFFSET);
+    ASSERT_EQ(row.get()->rules[libdebug::call_frame_return_address].value, -8);
+
+    // The decoded rows are cached
+    ASSERT_EQ(table.find_row(static_cast<kstd::u64>(*address)).get(), row.get());
+    ASSERT_EQ(table.find_row(0).get(), nullptr);
+    ASSERT_THROW(libdebug::CallFrameTable {"/nonexistent"}, std::runtime_error);
+}
+
+TEST(libdebug_CallFrameTable, test_backtrace) {
+    using namespace std::chrono_literals;
+    auto process_context = libdebug::ProcessContext {SAMPLE_BACKTRACE_FILE, {}};
+    ASSERT_TRUE(process_context.wait_for_signal(5s).get().has_value());
+    ASSERT_FALSE(process_context.add_breakpoint("backtrace_leaf").is_error());
+    ASSERT_FALSE(process_context.resume_thread(process_context.get_process_id()).is_error());
+    const auto signal = process_context.wait_for_signal(5s);
+    ASSERT_FALSE(signal.is_error());
+    ASSERT_TRUE(signal.get().has_value());
+    ASSERT_TRUE(signal.get()->is_breakpoint());
+
+    // The functions are compiled without frame pointer, so the frames are only found with the call frame information
+    const auto backtrace = process_context.get_backtrace(process_context.get_process_id());
+    ASSERT_FALSE(backtrace.is_error());
+    ASSERT_GE(backtrace.get().size(), 4);
+    const auto* symbols = process_context.get_symbols().get();
+    const std::array<std::string_view, 4> names {"backtrace_leaf", "backtrace_middle", "backtrace_outer", "main"};
+    for(std::size_t index = 0; index < names.size(); ++index) {
+        const auto address = backtrace.get()[index] - (index == 0 ? 0 : 1);
+        const auto symbol = symbols->find_symbol(address);
+        ASSERT_TRUE(symbol.has_value());
+        ASSERT_EQ(symbol->name, names[index]);
+    }
+    ::kill(process_context.get_process_id(), SIGKILL);
+}
\ No newline at end of file